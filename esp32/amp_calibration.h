@@ -0,0 +1,91 @@
+#ifndef AMP_CALIBRATION_H
+#define AMP_CALIBRATION_H
+
+// ------------------- Kalibrasi Kode DAC -> Arus -------------------
+// Tabel interpolasi yang dipelajari selama injeksi: tiap bucket (16 kode DAC)
+// menyimpan satu titik (kode, mA) hasil pengukuran saat kode stabil. Dipakai
+// untuk lompat langsung ke kode DAC prediksi sebelum PID melakukan trimming.
+// Ukuran tetap dan POD supaya bisa disimpan ke NVS apa adanya (putBytes).
+
+#include <stdint.h>
+
+#define CALIB_BUCKET_SHIFT 4
+#define CALIB_BUCKETS      (256 >> CALIB_BUCKET_SHIFT)
+#define CALIB_VERSION      1
+
+struct CalibPoint {
+  uint8_t code;
+  uint8_t hits;        // jumlah pengukuran, jenuh di 255; 0 = kosong
+  uint16_t milliamps;
+};
+
+struct CalibTable {
+  uint8_t version;
+  uint8_t reserved;
+  uint16_t runs;       // jumlah run yang menyumbang titik
+  CalibPoint points[CALIB_BUCKETS];
+};
+
+inline void calibClear(CalibTable& table) {
+  table.version = CALIB_VERSION;
+  table.reserved = 0;
+  table.runs = 0;
+  for (uint8_t i = 0; i < CALIB_BUCKETS; i++) {
+    table.points[i].code = 0;
+    table.points[i].hits = 0;
+    table.points[i].milliamps = 0;
+  }
+}
+
+inline uint8_t calibValidPoints(const CalibTable& table) {
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < CALIB_BUCKETS; i++) {
+    if (table.points[i].hits > 0) n++;
+  }
+  return n;
+}
+
+// Catat satu pengukuran. Kode yang sama dirata-rata (EMA 1/4 setelah titik
+// punya beberapa hit); kode lain di bucket yang sama menggantikan titik lama
+// supaya tabel mengikuti perubahan fixture.
+inline void calibRecord(CalibTable& table, uint8_t code, int32_t milliamps) {
+  if (milliamps < 0) milliamps = 0;
+  if (milliamps > 65535) milliamps = 65535;
+  CalibPoint& p = table.points[code >> CALIB_BUCKET_SHIFT];
+
+  if (p.hits == 0 || p.code != code) {
+    p.code = code;
+    p.milliamps = (uint16_t)milliamps;
+    p.hits = 1;
+    return;
+  }
+  int32_t weight = p.hits < 4 ? p.hits + 1 : 4;
+  p.milliamps = (uint16_t)(p.milliamps + (milliamps - (int32_t)p.milliamps) / weight);
+  if (p.hits < 255) p.hits++;
+}
+
+// Kode DAC untuk arus target dengan interpolasi linear antar titik valid.
+// Titik (0, 0 mA) dianggap selalu ada; titik yang tidak monoton naik
+// (noise) dilewati. Return -1 jika tabel belum cukup untuk memprediksi
+// target ini (tidak ada titik di atas target).
+inline int16_t calibPredictCode(const CalibTable& table, int32_t targetMa) {
+  if (targetMa <= 0) return 0;
+
+  int32_t prevCode = 0;
+  int32_t prevMa = 0;
+  for (uint8_t i = 0; i < CALIB_BUCKETS; i++) {
+    const CalibPoint& p = table.points[i];
+    if (p.hits == 0 || p.code <= prevCode || p.milliamps <= prevMa) continue;
+
+    if (p.milliamps >= targetMa) {
+      int32_t code = prevCode + ((targetMa - prevMa) * (p.code - prevCode) + (p.milliamps - prevMa) / 2) /
+                                    (p.milliamps - prevMa);
+      return (int16_t)(code > 255 ? 255 : code);
+    }
+    prevCode = p.code;
+    prevMa = p.milliamps;
+  }
+  return -1;
+}
+
+#endif
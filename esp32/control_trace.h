@@ -0,0 +1,61 @@
+#ifndef CONTROL_TRACE_H
+#define CONTROL_TRACE_H
+
+// ------------------- Trace Loop Kontrol -------------------
+// Ring buffer statis berisi satu record 16 byte per iterasi kontrol. Tanpa
+// alokasi; record lama ditimpa. Tiap record punya nomor urut (seq) global
+// sehingga klien bisa minta "sejak seq N" dan tahu jika ada yang terlewat.
+
+#include <stdint.h>
+
+#define TRACE_FLAG_FRESH          0x01  // ada sample DUT baru di iterasi ini
+#define TRACE_FLAG_RAMP_DONE      0x02
+#define TRACE_FLAG_TARGET_REACHED 0x04
+#define TRACE_FLAG_FEED_FORWARD   0x08
+// Mode iterasi: tanpa salah satu flag di bawah berarti PID injeksi aktif
+#define TRACE_FLAG_STALE_HOLD     0x10  // injeksi aktif, amplitude ditahan karena sample basi
+#define TRACE_FLAG_SWEEP          0x20  // sweep karakterisasi
+#define TRACE_FLAG_MANUAL         0x40  // amplitude dari operator (quick test / idle)
+
+struct __attribute__((packed)) ControlTraceRecord {
+  uint32_t timestampMs;
+  int16_t setpointMa;
+  int16_t measuredMa;
+  int16_t errorMa;
+  uint16_t dacLevel;     // 8.8 fixed-point (lihat dac_dither.h)
+  int16_t integralQ12;   // integrator PID, amplitude * 4096
+  uint8_t flags;         // TRACE_FLAG_*
+  uint8_t sampleAgeMs;   // jenuh di 255
+};
+
+template <uint16_t N>
+class ControlTrace {
+ public:
+  ControlTrace() : _next(0) {}
+
+  void record(const ControlTraceRecord& rec) {
+    _records[_next % N] = rec;
+    _next++;
+  }
+
+  // Seq record berikutnya yang akan ditulis
+  uint32_t next() const { return _next; }
+
+  // Seq tertua yang masih tersimpan
+  uint32_t oldest() const { return _next > N ? _next - N : 0; }
+
+  // Salin record seq; false jika sudah tertimpa atau belum ada
+  bool read(uint32_t seq, ControlTraceRecord& out) const {
+    if (seq >= _next || seq < oldest()) return false;
+    out = _records[seq % N];
+    return true;
+  }
+
+  static uint16_t capacity() { return N; }
+
+ private:
+  ControlTraceRecord _records[N];
+  uint32_t _next;
+};
+
+#endif
@@ -0,0 +1,100 @@
+#ifndef CURRENT_CONTROLLER_H
+#define CURRENT_CONTROLLER_H
+
+// ------------------- Kontroler Arus PID -------------------
+// PID diskrit dengan feed-forward, anti-windup, dan slew limit output.
+// Input dalam mA (integer dari Measurement), output amplitude 0.0-1.0.
+//   output = ff + kp*e + I - kd*d(measured)/dt
+// Derivative dihitung dari measurement (bukan error) supaya perubahan
+// setpoint tidak menimbulkan kick.
+
+#include <stdint.h>
+
+struct PidGains {
+  float kp;             // amplitude per mA error
+  float ki;             // amplitude per (mA * s)
+  float kd;             // amplitude per (mA / s)
+  float kff;            // feed-forward: amplitude per mA setpoint
+  float maxSlewPerSec;  // perubahan output maksimum per detik
+  float outMin;
+  float outMax;
+};
+
+class CurrentController {
+ public:
+  CurrentController() : _integral(0), _output(0), _lastMeasured(0), _primed(false), _slewLimited(false) {
+    PidGains defaults = { 0.002f, 0.004f, 0.0f, 0.0f, 0.4f, 0.0f, 1.0f };
+    _gains = defaults;
+  }
+
+  void configure(const PidGains& gains) { _gains = gains; }
+  const PidGains& gains() const { return _gains; }
+
+  // Mulai dari output tertentu (mis. 0 saat injeksi baru dimulai)
+  void reset(float output) {
+    _output = clamp(output);
+    _integral = 0;
+    _primed = false;
+    _slewLimited = false;
+  }
+
+  // Transfer bumpless: feed-forward berubah delta bukan karena setpoint
+  // (ganti sumber, model diperbarui). Integrator menyerap delta supaya
+  // output tidak melompat; sesudahnya PID menyesuaikan dengan laju biasa.
+  void shiftFeedForward(float delta) {
+    if (_primed) _integral -= delta;
+  }
+
+  float step(int32_t setpointMa, int32_t measuredMa, float dtSec, float feedForward) {
+    if (dtSec <= 0) return _output;
+
+    float error = (float)(setpointMa - measuredMa);
+    float derivative = _primed ? (float)(measuredMa - _lastMeasured) / dtSec : 0.0f;
+    float base = feedForward + _gains.kff * setpointMa;
+
+    // Step pertama setelah reset: integrator mulai dari output terakhir
+    if (!_primed) _integral = _output - base;
+    _lastMeasured = measuredMa;
+    _primed = true;
+
+    float candidateIntegral = _integral + _gains.ki * error * dtSec;
+    float unclamped = base + _gains.kp * error + candidateIntegral - _gains.kd * derivative;
+
+    // Anti-windup: integrator hanya bertambah jika output tidak saturasi
+    // ke arah yang sama dengan error
+    bool saturatedHigh = unclamped > _gains.outMax && error > 0;
+    bool saturatedLow = unclamped < _gains.outMin && error < 0;
+    if (!saturatedHigh && !saturatedLow) _integral = candidateIntegral;
+
+    float target = clamp(base + _gains.kp * error + _integral - _gains.kd * derivative);
+
+    // Slew limit
+    float maxDelta = _gains.maxSlewPerSec * dtSec;
+    _slewLimited = target > _output + maxDelta || target < _output - maxDelta;
+    if (target > _output + maxDelta) target = _output + maxDelta;
+    if (target < _output - maxDelta) target = _output - maxDelta;
+    _output = target;
+    return _output;
+  }
+
+  float output() const { return _output; }
+  float integral() const { return _integral; }
+  // Langkah terakhir dipotong slew limit (output tertinggal dari PID)
+  bool slewLimited() const { return _slewLimited; }
+
+ private:
+  float clamp(float v) const {
+    if (v < _gains.outMin) return _gains.outMin;
+    if (v > _gains.outMax) return _gains.outMax;
+    return v;
+  }
+
+  PidGains _gains;
+  float _integral;
+  float _output;
+  int32_t _lastMeasured;
+  bool _primed;
+  bool _slewLimited;
+};
+
+#endif
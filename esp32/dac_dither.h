@@ -0,0 +1,49 @@
+#ifndef DAC_DITHER_H
+#define DAC_DITHER_H
+
+// ------------------- Pola Dither DAC -------------------
+// DAC bawaan ESP32 hanya 8 bit. Level 8.8 fixed-point (0..255.0) dipecah
+// menjadi pola kode 8 bit dengan sigma-delta orde satu: rata-rata pola sama
+// persis dengan level, dan error kuantisasi tersebar merata (frekuensi tinggi)
+// sehingga mudah diredam filter analog. Pola diputar terus oleh DMA I2S.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DITHER_FRAC_BITS 8
+#define DITHER_LEVEL_MAX (255u << DITHER_FRAC_BITS)
+
+// Amplitude 0.0-1.0 ke level 8.8
+inline uint16_t ditherLevelFromAmp(float amp) {
+  if (amp <= 0.0f) return 0;
+  if (amp >= 1.0f) return DITHER_LEVEL_MAX;
+  return (uint16_t)(amp * DITHER_LEVEL_MAX + 0.5f);
+}
+
+// Kode 8 bit terdekat dengan level 8.8 (pembulatan half-up). Dipakai di mana
+// pun level perlu dinyatakan sebagai kode (kalibrasi, fallback dacWrite),
+// supaya error maksimal 0.5 LSB dan tidak bias ke bawah.
+inline uint8_t ditherCodeFromLevel(uint16_t level) {
+  if (level > DITHER_LEVEL_MAX) level = DITHER_LEVEL_MAX;
+  return (level + (1u << (DITHER_FRAC_BITS - 1))) >> DITHER_FRAC_BITS;
+}
+
+// Isi out[0..n) dengan kode 8 bit. Jika n kelipatan 256, jumlah pola persis
+// n * level / 256 (tanpa error rata-rata).
+inline void ditherFill(uint8_t* out, size_t n, uint16_t level) {
+  if (level > DITHER_LEVEL_MAX) level = DITHER_LEVEL_MAX;
+  uint8_t base = level >> DITHER_FRAC_BITS;
+  uint16_t frac = level & ((1u << DITHER_FRAC_BITS) - 1);
+  uint16_t acc = 0;
+  for (size_t i = 0; i < n; i++) {
+    acc += frac;
+    if (acc >= (1u << DITHER_FRAC_BITS)) {
+      acc -= 1u << DITHER_FRAC_BITS;
+      out[i] = base + 1;
+    } else {
+      out[i] = base;
+    }
+  }
+}
+
+#endif
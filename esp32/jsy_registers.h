@@ -0,0 +1,110 @@
+#ifndef JSY_REGISTERS_H
+#define JSY_REGISTERS_H
+
+// ------------------- Peta Register JSY1050 -------------------
+// Tabel deklaratif: register mana dipakai fitur apa. Planner menggabungkan
+// register yang diminta menjadi read kontigu sesedikit mungkin per siklus,
+// jadi V/I saja cukup 2 register, bukan blok 10 register.
+
+#include <stdint.h>
+
+enum JsyField : uint8_t {
+  JSY_FIELD_VOLTAGE = 0,  // 0.01 V
+  JSY_FIELD_CURRENT,      // 0.01 A
+  JSY_FIELD_POWER,        // W
+  JSY_FIELD_ENERGY,       // 32-bit, 0.001 kWh
+  JSY_FIELD_COUNT
+};
+
+enum JsyFeature : uint8_t {
+  JSY_FEATURE_VI     = 1 << 0,  // kontrol arus, TFT, /status
+  JSY_FEATURE_POWER  = 1 << 1,
+  JSY_FEATURE_ENERGY = 1 << 2
+};
+
+struct JsyRegister {
+  JsyField field;
+  uint16_t address;
+  uint8_t words;
+  uint8_t features;  // fitur yang membutuhkan register ini
+};
+
+// Harus urut berdasarkan address (blok data 0x0048)
+static const JsyRegister JSY_REGISTER_MAP[] = {
+  { JSY_FIELD_VOLTAGE, 0x0048, 1, JSY_FEATURE_VI },
+  { JSY_FIELD_CURRENT, 0x0049, 1, JSY_FEATURE_VI },
+  { JSY_FIELD_POWER,   0x004A, 1, JSY_FEATURE_POWER },
+  { JSY_FIELD_ENERGY,  0x004B, 2, JSY_FEATURE_ENERGY },
+};
+static const uint8_t JSY_REGISTER_COUNT = sizeof(JSY_REGISTER_MAP) / sizeof(JSY_REGISTER_MAP[0]);
+
+// Register komunikasi: high byte = alamat slave, low byte = kode baud
+#define JSY_REG_COMM_CONFIG 0x0004
+
+struct JsyBaudCode {
+  uint32_t baud;
+  uint8_t code;
+};
+
+// Urut dari tercepat; negosiasi mencoba dari atas
+static const JsyBaudCode JSY_BAUD_CODES[] = {
+  { 38400, 8 },
+  { 19200, 7 },
+  { 9600,  6 },
+};
+static const uint8_t JSY_BAUD_CODE_COUNT = sizeof(JSY_BAUD_CODES) / sizeof(JSY_BAUD_CODES[0]);
+#define JSY_DEFAULT_BAUD 9600
+
+// Celah sampai 6 register lebih murah dibaca sekalian (12 byte data) daripada
+// transaksi baru (8 byte request + 5 byte overhead response + 2 jeda frame).
+#define JSY_MERGE_GAP_WORDS 6
+#define JSY_MAX_SPANS       4
+
+struct JsyReadSpan {
+  uint16_t start;
+  uint8_t count;
+};
+
+struct JsyReadPlan {
+  JsyReadSpan spans[JSY_MAX_SPANS];
+  uint8_t spanCount;
+  uint8_t features;
+};
+
+inline JsyReadPlan jsyBuildReadPlan(uint8_t features) {
+  JsyReadPlan plan;
+  plan.spanCount = 0;
+  plan.features = features;
+
+  for (uint8_t i = 0; i < JSY_REGISTER_COUNT; i++) {
+    const JsyRegister& r = JSY_REGISTER_MAP[i];
+    if (!(r.features & features)) continue;
+
+    if (plan.spanCount > 0) {
+      JsyReadSpan& last = plan.spans[plan.spanCount - 1];
+      uint16_t lastEnd = last.start + last.count;
+      if (r.address <= lastEnd + JSY_MERGE_GAP_WORDS || plan.spanCount == JSY_MAX_SPANS) {
+        uint16_t end = r.address + r.words;
+        if (end > lastEnd) last.count = end - last.start;
+        continue;
+      }
+    }
+    plan.spans[plan.spanCount].start = r.address;
+    plan.spans[plan.spanCount].count = r.words;
+    plan.spanCount++;
+  }
+  return plan;
+}
+
+// Offset field di dalam span, -1 jika field tidak tercakup span ini
+inline int jsyFieldOffset(const JsyReadSpan& span, JsyField field) {
+  for (uint8_t i = 0; i < JSY_REGISTER_COUNT; i++) {
+    const JsyRegister& r = JSY_REGISTER_MAP[i];
+    if (r.field != field) continue;
+    if (r.address < span.start || r.address + r.words > span.start + span.count) return -1;
+    return r.address - span.start;
+  }
+  return -1;
+}
+
+#endif
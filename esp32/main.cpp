@@ -1,13 +1,32 @@
 #include <Arduino.h>
 #include <TFT_eSPI.h>
 #include <ezButton.h>
-#include <ModbusMaster.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <AsyncTCP.h>
+#include <ESPAsyncWebServer.h>
 #include <DNSServer.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include <Preferences.h>
+#include <atomic>
+#include <driver/uart.h>
+#include <esp_timer.h>
+#include <driver/i2s.h>
+#include "modbus_rtu.h"
+#include "jsy_registers.h"
+#include "sample_ring.h"
+#include "meter_scheduler.h"
+#include "measurement_filter.h"
+#include "measurement.h"
+#include "current_controller.h"
+#include "amp_calibration.h"
+#include "dac_dither.h"
+#include "ramp_profile.h"
+#include "settling_detector.h"
+#include "control_trace.h"
+#include "test_plan.h"
+#include "plant_estimator.h"
+#include "web_assets.h"
 
 // ------------------- TFT Setup -------------------
 TFT_eSPI tft = TFT_eSPI();  // ST7789 240x240
@@ -19,8 +38,47 @@ ezButton keyUp(26);
 // ------------------- JSY1050 Setup -------------------
 #define RXD_JSY 16
 #define TXD_JSY 17
-HardwareSerial SerialJSY(2);
-ModbusMaster node;
+#define JSY_DUT_SLAVE_ID  1
+#define JSY_DUT_METER     0    // index meter DUT di jsyMeters[]
+#define JSY_DUT_WEIGHT    3    // saat bus jenuh DUT dapat 3x jatah meter referensi
+#define JSY_REF_WEIGHT    1
+#define JSY_TURNAROUND_MS 5
+#define JSY_UART_NUM      UART_NUM_2
+#define JSY_UART_RX_BUF   512
+#define JSY_UART_QUEUE    16
+#define JSY_RX_IDLE_CHARS 4    // RX timeout interrupt setelah 3.5 char diam = akhir frame RTU
+QueueHandle_t jsyUartQueue = NULL;
+ModbusAsyncMaster jsyBus;  // protokol murni; UART event queue di bawah memberi byte + akhir frame
+
+// Task akuisisi JSY1050 berjalan di core 0, loop() (web, TFT) dan controlTask di core 1
+#define ACQ_TASK_CORE     0
+#define ACQ_TASK_PRIORITY 3
+#define ACQ_TASK_STACK    4096
+
+// Satu sample mentah dari register JSY1050 (lihat jsy_registers.h untuk satuan)
+struct JsySample {
+  uint32_t timestampMs;
+  uint16_t voltageRaw;
+  uint16_t currentRaw;
+  uint16_t powerRaw;
+  uint32_t energyRaw;
+  uint8_t features;  // field yang terisi, sesuai read plan saat sample diambil
+};
+// Fitur yang meminta register tambahan cukup OR-kan bit JSY_FEATURE_* di sini
+std::atomic<uint8_t> jsyFeatureMask(JSY_FEATURE_VI);
+TaskHandle_t acquisitionTaskHandle = NULL;
+
+// Satu meter di bus RS-485 dengan stream sample dan statistik link sendiri
+struct JsyMeter {
+  uint8_t slaveId;
+  const char* role;
+  MeterSlot slot;
+  ModbusLinkStats stats;
+  SampleRing<JsySample, 32> samples;  // producer: acquisitionTask, consumer: controlTask
+  JsySample latest;                   // hanya ditulis controlTask, baca di bawah readingMux
+};
+JsyMeter jsyMeters[JSY_MAX_METERS];
+uint8_t jsyMeterCount = 0;
 
 // ------------------- LED & Relay -------------------
 #define LED_RUNTIME 13
@@ -36,11 +94,65 @@ ModbusMaster node;
 // DAC Pin
 #define DAC_PIN 25   // GPIO 25 untuk DAC output
 
+// DAC lewat I2S built-in DMA: pola dither 256 frame (8 bit tambahan resolusi)
+// diputar terus oleh DMA tanpa CPU. Fallback ke dacWrite jika driver gagal.
+#define DAC_I2S_PORT        I2S_NUM_0
+#define DAC_I2S_SAMPLE_RATE 100000  // pola 256 frame = 2.56 ms
+#define DAC_PATTERN_LEN     256
+#define DAC_DMA_BUF_LEN     64
+#define DAC_DMA_BUF_COUNT   (DAC_PATTERN_LEN / DAC_DMA_BUF_LEN)
+bool dacDmaActive = false;
+SemaphoreHandle_t dacMutex = NULL;  // applyDAC dipanggil dari loop() dan controlTask
+
  // ------------------- WiFi & Web Server -------------------
 const char* ap_ssid = "CORE Test";      // Access Point SSID
 const char* ap_password = "12345678";     // Access Point Password (8+ chars)
-WebServer server(80);
+AsyncWebServer server(80);
+AsyncEventSource events("/events");
+AsyncWebSocket controlSocket("/ws");
+#define WS_MAX_CLIENTS 4    // tablet/ponsel operator yang boleh memegang kanal kontrol
+#define WS_MAX_FRAME   48   // "<seq> <cmd> <arg>" selalu pendek
+std::atomic<bool> liveResync(false);  // klien /events baru: kirim snapshot penuh
 bool webServerMode = false;
+#define WEB_MAX_BODY 4096  // batas body JSON (plan, submit-data); lebih besar dijawab 413
+
+// Handler async tidak boleh blocking, jadi koneksi WiFi dan POST ke cloud
+// dijalankan loop(). Handler hanya mengisi input saat !pending, loop() hanya
+// menyentuh input/result saat pending; klien polling GET untuk hasilnya.
+struct WebJob {
+  std::atomic<bool> pending;
+  String input;
+  String result;  // JSON respons terakhir
+  WebJob() : pending(false) {}
+};
+WebJob wifiJob;
+WebJob cloudJob;
+// Input wifiJob dan simpan MQTT; aturan akses sama dengan WebJob::input
+struct WifiJobInput {
+  String ssid;
+  String password;
+  String cloudServer;
+};
+WifiJobInput wifiJobInput;
+struct MqttSaveInput {
+  String host;
+  int port;
+  String user;
+  String pass;
+  String clientId;
+  String topic;
+};
+MqttSaveInput mqttSaveInput;
+std::atomic<bool> mqttSavePending(false);
+// NVS hanya ditulis loop() (persistSettings): tulis flash memblok beberapa
+// ms dan tidak boleh di task AsyncTCP. Handler cukup menandai yang disimpan.
+std::atomic<bool> filterSavePending(false);
+std::atomic<bool> controllerSavePending(false);
+std::atomic<bool> calibSavePending(false);
+std::atomic<int8_t> calibFixturePending(-1);  // ganti fixture: simpan tabel lama, muat yang baru
+std::atomic<bool> wifiResetPending(false);
+std::atomic<uint32_t> restartAtMs(0);          // ESP.restart() tertunda dari /api/wifi-reset
+std::atomic<bool> statusRedrawPending(false);  // TFT hanya digambar dari loop()
 
 // DNS server untuk memetakan nama domain lokal (mis. core.local) ke IP AP (192.168.4.1)
 const byte DNS_PORT = 53;
@@ -64,6 +176,10 @@ String mqttUser = "esp1";
 String mqttPass = "password";
 String mqttClientId = "esp32_01";
 String mqttTopic = "sensor/esp32";
+// Setting WiFi/cloud/MQTT di atas hanya diganti setup()/loop() di bawah
+// settingsMutex; handler async yang menampilkannya menyalin di bawah mutex
+// yang sama (String yang sedang di-assign tidak aman dibaca).
+SemaphoreHandle_t settingsMutex = NULL;
 
 // WiFi Connection Status
 bool wifiConnected = false;
@@ -97,9 +213,37 @@ const int WIDTH = 240;
 const int HEIGHT = 240;
 int lastSecond = -1;
 // ------------------- Variabel -------------------
-float voltage = 0.0f, currentA = 0.0f, resistanceVal = 0.0f;
-unsigned long lastRead = 0;
-const unsigned long READ_INTERVAL = 500; // ms
+// Nilai terakhir hasil drain ring buffer setelah filter; hanya ditulis oleh controlTask.
+// Kontrol, TFT, dan /status membaca nilai terfilter ini, bukan sample mentah.
+// Pembaca di luar controlTask memakai readingSnapshot().
+Measurement dutReading = {};
+portMUX_TYPE readingMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Filter per channel, satuan mentah register (0.01 V / 0.01 A)
+MeasurementFilter voltageFilter;
+MeasurementFilter currentFilter;
+const FilterConfig DEFAULT_VOLTAGE_FILTER = { 3, 1, 500, 3 };  // median-3, EMA 1/2, tolak lompatan > 5 V
+const FilterConfig DEFAULT_CURRENT_FILTER = { 3, 1, 10, 3 };   // median-3, EMA 1/2, tolak lompatan > 100 mA
+const unsigned long READ_INTERVAL = 500; // ms (READY)
+
+// Jadwal sampling adaptif: secepat bus saat RUN / auto injection / recording,
+// heartbeat lambat saat STOPPED supaya UART tidak sibuk ketika rig idle
+const uint32_t SAMPLE_INTERVAL_FAST_MS = 0;     // back-to-back, dibatasi waktu transaksi
+const uint32_t SAMPLE_INTERVAL_IDLE_MS = 2000;  // heartbeat STOPPED
+const uint32_t MODBUS_FRAME_GAP_MS = 5;         // jeda antar frame (> 3.5 char @ 9600)
+std::atomic<uint32_t> sampleIntervalMs(READ_INTERVAL);
+
+// Kesehatan link Modbus: ditulis task akuisisi, dibaca /api/diagnostics
+uint32_t jsyBaudRate = JSY_DEFAULT_BAUD;
+unsigned long lastModbusReport = 0;
+
+// Maks 2 retry dengan backoff 5 lalu 10 ms; tiap backoff dibatasi 20 ms
+const uint8_t JSY_MAX_RETRIES = 2;
+const uint32_t JSY_RETRY_BACKOFF_MS = 5;
+const uint32_t JSY_RETRY_BACKOFF_MAX_MS = 20;
+
+// Sample lebih tua dari ini tidak boleh dipakai untuk kontrol arus
+const uint32_t JSY_STALE_LIMIT_MS = 250;
 
 enum State { READY, RUN, STOPPED };
 State systemState = STOPPED;  // posisi awal STOPPED
@@ -115,13 +259,156 @@ bool countdownActive = false;
  // 200mA Injection Variables
 bool autoInjectionMode = false;
 bool targetReached = false;
-// JSY current is in Amperes, so 200mA = 0.2A
-float targetCurrent = 0.2f; // 200mA
-float autoIncrementStep = 0.01f; // 1% increment (in amplitude units)
-unsigned long autoIncrementDelay = 5000; // 5 seconds between increments
-unsigned long lastAutoIncrement = 0; // Track last auto increment time
-// User-configurable countdown for special test mode (milliseconds)
-unsigned long userCountdownDuration = 2 * 60 * 1000UL; // default 120s
+int32_t targetCurrentMa = 200;           // 200mA
+const int32_t CURRENT_TOLERANCE_MA = 5;  // ±5mA
+
+// PID arus menggantikan step bang-bang +1/+0.5/+0.1%
+const unsigned long CONTROL_PERIOD_MS = 50;
+CurrentController currentController;
+
+// Ramp setpoint saat injeksi dimulai (setting di /api/controller). Default
+// S-curve minimal 3 detik; durasi aktual dikirim balik ke UI saat inject.
+RampProfile rampProfile;
+uint32_t rampMinDurationMs = 3000;
+uint32_t rampMaxSlewMaPerSec = 200;
+struct RampState {
+  int32_t fromMa;
+  int32_t toMa;
+  uint32_t startMs;
+  uint32_t durationMs;
+  bool feedForward;  // tabel kalibrasi mencakup target -> dipakai sebagai feed-forward
+};
+RampState currentRamp = {};
+
+// targetReached hanya diset setelah window sample settle (bukan satu sample
+// kebetulan masuk ±5 mA). Setting di /api/controller.
+uint8_t settleWindow = 8;            // sample
+int32_t settleMaxVarianceMa2 = 9;    // sigma 3 mA
+SettlingDetector settlingDetector;
+// Snapshot saat target settled, diisi controlTask, dicetak loop()
+struct SettleReport {
+  bool pending;
+  int32_t targetMa;
+  int32_t meanMa;
+  int32_t varianceMa2;
+  float amp;
+};
+SettleReport settleReport = {};
+
+// Model R dan gain drive (RLS) dari sample yang masuk; setelah siap, drive untuk
+// setpoint dihitung langsung dan dipakai sebagai feed-forward PID
+PlantEstimator plantModel;
+// Sumber feed-forward langkah PID sebelumnya, untuk transfer bumpless saat
+// model siap / diperbarui atau tabel kalibrasi mulai/berhenti dipakai
+struct FeedForwardState {
+  PlantEstimator model;
+  bool calib;
+};
+FeedForwardState lastFeedForward;
+
+// Trace tiap iterasi kontrol (512 x 16 byte = 25.6 s pada 50 ms), dibaca lewat /api/trace
+#define TRACE_CAPACITY 512
+ControlTrace<TRACE_CAPACITY> controlTrace;
+ControlTraceRecord traceSnapshot[TRACE_CAPACITY];  // salinan untuk dikirim tanpa memegang controlMutex
+int32_t controlSetpointMa = 0;  // setpoint langkah PID terakhir; tetap dicatat saat hold
+
+// Test plan di device (test_plan.h): diunggah lewat /api/plan, dijalankan
+// controlTask sehingga timing tidak bergantung pada browser / WiFi.
+#define PLAN_MAX_RESULTS 32
+struct PlanResult {
+  uint8_t step;
+  uint8_t fixture;
+  uint32_t durationMs;
+  uint32_t samples;
+  int32_t millivolts;  // rata-rata selama hold
+  int32_t milliamps;
+  int32_t milliohms;
+};
+class DevicePlanHooks : public PlanHooks {
+ public:
+  void planRamp(int32_t milliamps);
+  bool planSettled();
+  void planRecord(bool on, uint8_t step);
+  bool planFixture(uint8_t fixture);
+  void planStop();
+};
+PlanRunner planRunner;
+DevicePlanHooks planHooks;
+PlanResult planResults[PLAN_MAX_RESULTS];
+uint8_t planResultCount = 0;
+bool planRecording = false;
+uint32_t planRecordStartMs = 0;
+uint32_t planSamples = 0;
+int64_t planSumMv = 0;
+int64_t planSumMa = 0;
+int8_t planFixtureRequest = -1;  // ganti fixture butuh NVS, dikerjakan loop(); controlMutex
+bool planFinished = false;       // diset controlTask, dibereskan loop()
+// Buffer handlePlan: di luar stack task AsyncTCP yang kecil. Handler web
+// berjalan berurutan di satu task, jadi satu salinan cukup.
+TestPlan planUpload;
+PlanResult planResultsSnapshot[PLAN_MAX_RESULTS];
+
+// Loop kontrol periode tetap: esp_timer (hardware timer) membangunkan controlTask
+// prioritas tinggi, jadi WiFi connect / handler yang blocking di loop() tidak
+// menahan langkah kontrol.
+#define CONTROL_TASK_CORE     1
+#define CONTROL_TASK_PRIORITY 10
+#define CONTROL_TASK_STACK    4096
+TaskHandle_t controlTaskHandle = NULL;
+esp_timer_handle_t controlTimer = NULL;
+SemaphoreHandle_t controlMutex = NULL;  // start/stop injeksi vs langkah kontrol
+
+// Jitter periode kontrol (selisih periode aktual terhadap nominal)
+struct ControlTiming {
+  uint32_t ticks;
+  uint32_t overruns;      // notifikasi timer yang terlewat
+  uint32_t minPeriodUs;
+  uint32_t maxPeriodUs;
+  uint32_t maxJitterUs;
+  uint64_t sumJitterUs;
+};
+ControlTiming controlTiming = { 0, 0, UINT32_MAX, 0, 0, 0 };
+
+// Tabel kalibrasi kode DAC -> mA per fixture (NVS namespace "core-calib").
+// Diisi selama injeksi, dipakai untuk titik awal injeksi berikutnya.
+#define CALIB_FIXTURES  4
+#define CALIB_SETTLE_MS 150  // kode DAC harus stabil sekian lama sebelum sample dicatat
+uint8_t activeFixture = 0;
+CalibTable calibTable;
+bool calibDirty = false;
+uint8_t calibLastCode = 0;
+uint32_t calibCodeSinceMs = 0;
+uint32_t calibLastSampleMs = 0;
+// Kode DAC lompatan awal dari tabel (diisi controlTask, dicetak loop()); 0 = tidak ada
+uint8_t calibJumpReport = 0;
+
+// Sweep karakterisasi: DAC dinaikkan bertahap 0..255, tiap step menunggu arus
+// settle lalu mencatat V/I/R. Dijalankan controlTask; hasil juga masuk calibTable.
+#define SWEEP_MAX_POINTS     64
+#define SWEEP_DEFAULT_STEP   8
+#define SWEEP_MIN_DWELL_MS   CALIB_SETTLE_MS
+#define SWEEP_MAX_DWELL_MS   1500  // step dicatat walau belum settle (settled=false)
+#define SWEEP_STABLE_MA      2     // selisih antar sample yang dianggap stabil
+#define SWEEP_STABLE_SAMPLES 3
+struct SweepPoint {
+  uint8_t code;
+  bool settled;
+  int32_t millivolts;
+  int32_t milliamps;
+  int32_t milliohms;
+};
+struct SweepState {
+  bool active;
+  bool finished;     // diset controlTask, dibereskan loop()
+  uint8_t step;
+  uint16_t code;
+  uint32_t stepStartMs;
+  uint8_t stableCount;
+  int32_t lastMa;
+  uint8_t count;
+  SweepPoint points[SWEEP_MAX_POINTS];
+};
+SweepState sweep = {};
 
 // Time-based lamp variables
 bool lampTimeBased = false;
@@ -145,6 +432,7 @@ String lastSubmissionStatus = "";
 #define Y_I      95
 void handleRotaryEncoder();
 void updateDAC();
+void logDAC();
 #define Y_R      140
 #define Y_TIME   185
 #define Y_STATUS 215
@@ -152,34 +440,110 @@ void updateDAC();
 // ------------------- Prototypes -------------------
 void drawHeader();
 void drawFrame();
-void updateValues(float v, float i, float r);
+void updateValues(const Measurement& m);
 void updateTime();
 void updateStatus();
 void executeMenu(MenuItem menu);
-void readJSY1050();
+void addJSYMeter(uint8_t slaveId, const char* role, uint8_t weight, uint16_t turnaroundMs);
+void loadJSYMeters();
+void startJSY1050Read(uint8_t slaveId, const JsyReadSpan& span);
+bool jsyUartBegin(uint32_t baud);
+void jsyUartSetBaud(uint32_t baud);
+void jsyUartSend();
+void extractJSYFields(const JsyReadSpan& span, JsySample& sample);
+bool readJSY1050Sample(JsyMeter& meter, const JsyReadPlan& plan, JsySample& sample);
+ModbusStatus awaitJSY1050();
+ModbusStatus readJSY1050Span(JsyMeter& meter, const JsyReadSpan& span);
+String linkStatsJson(const ModbusLinkStats& stats);
+uint32_t sampleAgeMs();
+Measurement readingSnapshot();
+void controlTimerCallback(void* arg);
+void controlTask(void* param);
+void runCurrentControl(float dt, bool fresh);
+float feedForwardAmp(const PlantEstimator& model, bool calib, int32_t setpointMa);
+void recordControlTrace(bool fresh, uint8_t modeFlags);
+void applyDAC();
+String controlTimingJson();
+String plantModelJson();
+void handleTrace(AsyncWebServerRequest* request);
+uint8_t ampToDacCode(float amp);
+bool dacOutputBegin();
+void loadCalibration(uint8_t fixture);
+void saveCalibration();
+void persistSettings();
+void calibrationObserve();
+float calibratedStartAmp(int32_t targetMa);
+uint32_t startCurrentRamp(int32_t targetMa);
+void beginRamp(int32_t fromMa, int32_t targetMa);
+void finishPlan();
+bool parsePlan(JsonArrayConst steps, TestPlan& plan, String& error);
+void handlePlan(AsyncWebServerRequest* request);
+void handleCalibration(AsyncWebServerRequest* request);
+void startSweep(uint8_t step);
+void runSweepStep();
+void finishSweep();
+void reportSettled();
+void reportCalibJump();
+void handleSweep(AsyncWebServerRequest* request);
+void handleDiagnostics(AsyncWebServerRequest* request);
+void loadFilterSettings();
+void saveFilterSettings();
+void loadControllerSettings();
+void saveControllerSettings();
+void handleControllerSettings(AsyncWebServerRequest* request);
+void handleFilterSettings(AsyncWebServerRequest* request);
+bool probeJSY1050(uint8_t slaveId, uint8_t attempts);
+bool probeAllJSY1050(uint32_t baud, uint8_t attempts);
+bool writeJSY1050BaudCode(uint8_t slaveId, uint8_t code);
+uint8_t jsyBaudCodeFor(uint32_t baud);
+void negotiateJSY1050Baud();
+void acquisitionTask(void* param);
+uint32_t selectSampleInterval();
+void updateSamplingRate();
+bool drainJSYSamples();
 void handleButtons();
 void updateLEDsAndRelay();
 void starfieldIntro();
 void handleWebServer();
-void handleRoot();
-void handleSetAmplitude();
-void handleGetStatus();
+void setupWebRoutes();
+void collectRequestBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total);
+bool rejectOversizedBody(AsyncWebServerRequest* request);
+String currentWifiSSID();
+String requestBody(AsyncWebServerRequest* request);
+bool sendNotModified(AsyncWebServerRequest* request, const char* etag, const char* cacheControl);
+void sendWebAsset(AsyncWebServerRequest* request, const WebAsset& asset);
+void handleRoot(AsyncWebServerRequest* request);
+void handleSetAmplitude(AsyncWebServerRequest* request);
+void handleGetStatus(AsyncWebServerRequest* request);
 void checkWebServerSwitch();
 void displayWebServerMode();
 void refreshWebServerDisplay();
-void handleSettings();
-void handleMainMenu();
-void handleInjection();
-void handleInjection();
-void handleDataSubmission();
+void handleSettings(AsyncWebServerRequest* request);
+void handleMainMenu(AsyncWebServerRequest* request);
+void handleInjection(AsyncWebServerRequest* request);
+void handleInjection(AsyncWebServerRequest* request);
+void handleDataSubmission(AsyncWebServerRequest* request);
+void handleLiveScript(AsyncWebServerRequest* request);
 void connectToWiFi();
-void handleWiFiSettings();
-void handleCloudSettings();
-void handleWiFiReset();
-void handleAutoInjection();
-void sendDataToCloud();
-void handleInjectAPI();
-void handleStopAPI();
+void handleWiFiSettings(AsyncWebServerRequest* request);
+void sendJobStatus(AsyncWebServerRequest* request, WebJob& job);
+void runWebJobs();
+void onEventsConnect(AsyncEventSourceClient* client);
+void pushLiveEvents();
+void onControlSocketEvent(AsyncWebSocket* socket, AsyncWebSocketClient* client, AwsEventType type, void* arg,
+                          uint8_t* data, size_t len);
+void handleCloudSettings(AsyncWebServerRequest* request);
+void handleWiFiReset(AsyncWebServerRequest* request);
+void handleAutoInjection(AsyncWebServerRequest* request);
+void sendDataToCloud(AsyncWebServerRequest* request);
+void handleInjectAPI(AsyncWebServerRequest* request);
+void handleStopAPI(AsyncWebServerRequest* request);
+void stopAllOutput();
+bool outputBusy();
+bool startTargetInjection(uint32_t& rampMs);
+bool startRecording(String& reason);
+bool setAmplitudePercent(float percent);
+void applyMenuState(const String& state);
 void loadSettingsFromMemory();
 void saveSettingsToMemory(const String& ssid, const String& password, const String& cloudServer);
 void resetWiFiSettings();
@@ -187,7 +551,7 @@ void stopAutoInjection();
 void handleWiFiInterference();
 void updateTimeBasedLamp();
 bool sendDataToCloudServer(const String& jsonData, String& response);
-void handleInjection();
+void handleInjection(AsyncWebServerRequest* request);
 
 // ------------------- STARFIELD INTRO -------------------
 void starfieldIntro() {
@@ -329,19 +693,7 @@ void checkWebServerSwitch() {
         }
       }
       
-      // Start web server
-      server.on("/", handleRoot);
-      server.on("/main", handleMainMenu);
-      server.on("/settings", handleSettings);
-      server.on("/api/wifi", handleWiFiSettings);
-      server.on("/api/wifi-reset", handleWiFiReset);
-      server.on("/api/cloud", handleCloudSettings);
-      server.on("/api/auto-injection", handleAutoInjection);
-      server.on("/api/submit-data", sendDataToCloud);
-      server.on("/status", handleGetStatus);
-      server.on("/set_amplitude", handleSetAmplitude);
-      server.on("/api/inject", HTTP_POST, handleInjectAPI);
-      server.on("/api/stop", HTTP_POST, handleStopAPI);
+      // Start web server (route didaftarkan sekali di setupWebRoutes)
       server.begin();
       Serial.println("Web server started");
       
@@ -357,14 +709,14 @@ void checkWebServerSwitch() {
       
       // Exit web server mode
       Serial.println("Stopping web server...");
-      server.stop();
+      server.end();
       dnsServer.stop();
       WiFi.softAPdisconnect(true);
       Serial.println("Web server stopped");
       
       // Redraw normal interface
       drawFrame();
-      updateValues(voltage, currentA, resistanceVal);
+      updateValues(readingSnapshot());
       updateTime();
       updateStatus();
       switchHandled = true;
@@ -374,1204 +726,111 @@ void checkWebServerSwitch() {
   lastSwitchState = currentSwitchState;
 }
 
+// AsyncWebServer melayani request di task AsyncTCP (event lwIP), banyak koneksi
+// sekaligus. Handler tidak boleh blocking; pekerjaan lama dititipkan ke loop()
+// lewat WebJob. Route cukup didaftarkan sekali, begin()/end() mengikuti switch.
+void setupWebRoutes() {
+  server.on("/", HTTP_GET, handleRoot);
+  server.on("/main", handleMainMenu);
+  server.on("/settings", HTTP_GET, handleSettings);
+  server.on("/live.js", HTTP_GET, handleLiveScript);
+  server.on("/api/wifi", handleWiFiSettings);
+  server.on("/api/wifi-reset", handleWiFiReset);
+  server.on("/api/cloud", handleCloudSettings);
+  server.on("/api/auto-injection", handleAutoInjection);
+  server.on("/api/submit-data", HTTP_ANY, sendDataToCloud, NULL, collectRequestBody);
+  server.on("/status", handleGetStatus);
+  server.on("/api/diagnostics", handleDiagnostics);
+  server.on("/api/filter", handleFilterSettings);
+  server.on("/api/controller", handleControllerSettings);
+  server.on("/api/calibration", handleCalibration);
+  server.on("/api/sweep", handleSweep);
+  server.on("/api/trace", handleTrace);
+  server.on("/api/plan", HTTP_ANY, handlePlan, NULL, collectRequestBody);
+  server.on("/set_amplitude", handleSetAmplitude);
+  server.on("/api/inject", HTTP_POST, handleInjectAPI, NULL, collectRequestBody);
+  server.on("/api/stop", HTTP_POST, handleStopAPI);
+  events.onConnect(onEventsConnect);
+  server.addHandler(&events);
+  controlSocket.onEvent(onControlSocketEvent);
+  server.addHandler(&controlSocket);
+}
+
 void handleWebServer() {
   if (webServerMode) {
     dnsServer.processNextRequest();
-    server.handleClient();
   }
 }
 
-void handleRoot() {
-  // Stop auto injection when returning to injection dashboard
-  if (autoInjectionMode) {
-    stopAutoInjection();
+// Body JSON tidak masuk ke arg() seperti form; kumpulkan per chunk ke
+// _tempObject (dibebaskan AsyncWebServerRequest saat selesai).
+void collectRequestBody(AsyncWebServerRequest* request, uint8_t* data, size_t len, size_t index, size_t total) {
+  if (index == 0) {
+    if (total > WEB_MAX_BODY) return;
+    request->_tempObject = malloc(total + 1);
+    if (request->_tempObject != NULL) ((char*)request->_tempObject)[total] = '\0';
   }
+  if (request->_tempObject == NULL) return;
+  memcpy((uint8_t*)request->_tempObject + index, data, len);
+}
 
-  String html = R"(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>CORE Test - Conductive Suite Resistance Evaluator</title>
-    <meta charset='UTF-8'>
-    <meta name='viewport' content='width=device-width, initial-scale=1.0'>
-    <style>
-        * { margin: 0; padding: 0; box-sizing: border-box; }
-        
-        @keyframes slideIn {
-            from { opacity: 0; transform: translateY(20px); }
-            to { opacity: 1; transform: translateY(0); }
-        }
-        
-        body {
-            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-            background: linear-gradient(135deg, #06b6d4 0%, #14b8a6 100%);
-            min-height: 100vh;
-            padding: 20px;
-            color: #1a202c;
-        }
-        
-        .container { max-width: 1100px; margin: 0 auto; animation: slideIn 0.5s; }
-        
-        .header {
-            background: white;
-            border-radius: 20px;
-            padding: 24px;
-            margin-bottom: 20px;
-            display: flex;
-            justify-content: space-between;
-            align-items: center;
-            box-shadow: 0 4px 20px rgba(0,0,0,0.1);
-        }
-        
-        .header h1 {
-            font-size: 28px;
-            font-weight: 700;
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            -webkit-background-clip: text;
-            -webkit-text-fill-color: transparent;
-        }
-        
-        .settings-btn {
-            padding: 10px 20px;
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            border: none;
-            border-radius: 10px;
-            color: white;
-            text-decoration: none;
-            font-weight: 600;
-            transition: transform 0.2s;
-        }
-        
-        .settings-btn:hover { transform: translateY(-2px); }
-        
-        .wifi-status {
-            display: inline-flex;
-            align-items: center;
-            gap: 8px;
-            padding: 10px 18px;
-            border-radius: 10px;
-            font-size: 13px;
-            font-weight: 600;
-            margin-bottom: 20px;
-        }
-        
-        .wifi-connected { background: #10b981; color: white; }
-        .wifi-disconnected { background: #ef4444; color: white; }
-        
-        .gauges-grid {
-            display: grid;
-            grid-template-columns: repeat(4, 1fr);
-            gap: 20px;
-            margin-bottom: 20px;
-            max-width: 1000px;
-            margin-left: auto;
-            margin-right: auto;
-        }
-        
-        .gauge-card {
-            background: white;
-            border-radius: 16px;
-            padding: 20px;
-            text-align: center;
-            box-shadow: 0 4px 15px rgba(0,0,0,0.08);
-            transition: transform 0.2s;
-            display: flex;
-            flex-direction: column;
-            align-items: center;
-            justify-content: center;
-        }
-        
-        .gauge-card:hover { transform: translateY(-4px); box-shadow: 0 8px 25px rgba(0,0,0,0.12); }
-        
-        .gauge {
-            width: 120px;
-            height: 120px;
-            margin: 0 auto 12px;
-            position: relative;
-            display: flex;
-            align-items: center;
-            justify-content: center;
-        }
-        
-        .gauge svg { transform: rotate(-90deg); }
-        
-        .gauge-bg {
-            fill: none;
-            stroke: #e5e7eb;
-            stroke-width: 10;
-        }
-        
-        .gauge-fill {
-            fill: none;
-            stroke-width: 10;
-            stroke-linecap: round;
-            transition: stroke-dashoffset 0.5s ease;
-        }
-        
-        .gauge-value {
-            position: absolute;
-            top: 50%;
-            left: 50%;
-            transform: translate(-50%, -50%);
-            font-size: 18px;
-            font-weight: 700;
-            color: #1a202c;
-        }
-        
-        .gauge-label {
-            font-size: 12px;
-            color: #6b7280;
-            font-weight: 600;
-            text-transform: uppercase;
-            letter-spacing: 0.5px;
-        }
-        
-        .control-section {
-            background: white;
-            border-radius: 16px;
-            padding: 20px;
-            margin-bottom: 16px;
-            box-shadow: 0 4px 15px rgba(0,0,0,0.08);
-            max-width: 1000px;
-            margin-left: auto;
-            margin-right: auto;
-        }
-        
-        .section-title {
-            font-size: 17px;
-            font-weight: 700;
-            margin-bottom: 16px;
-            color: #1a202c;
-        }
-        
-        .form-group { margin-bottom: 16px; }
-        
-        label {
-            display: block;
-            margin-bottom: 6px;
-            font-size: 13px;
-            font-weight: 600;
-            color: #374151;
-        }
-        
-        select, input {
-            width: 100%;
-            padding: 12px;
-            background: #f9fafb;
-            border: 2px solid #e5e7eb;
-            border-radius: 10px;
-            color: #1a202c;
-            font-size: 14px;
-            transition: all 0.2s;
-        }
-        
-        select:focus, input:focus {
-            outline: none;
-            border-color: #667eea;
-            background: white;
-        }
-        
-        .control-card {
-            background: #f9fafb;
-            border-radius: 12px;
-            padding: 20px;
-            margin: 16px 0;
-        }
-        
-        .numeric-control {
-            display: flex;
-            align-items: center;
-            justify-content: center;
-            gap: 12px;
-            margin: 16px 0;
-        }
-        
-        .numeric-btn {
-            width: 48px;
-            height: 48px;
-            border-radius: 12px;
-            border: none;
-            font-size: 22px;
-            font-weight: 700;
-            color: white;
-            cursor: pointer;
-            transition: all 0.2s;
-        }
-        
-        .numeric-btn.dec { background: #ef4444; }
-        .numeric-btn.inc { background: #3b82f6; }
-        .numeric-btn:hover { transform: scale(1.05); }
-        .numeric-btn:active { transform: scale(0.95); }
-        
-        .numeric-value {
-            width: 90px;
-            text-align: center;
-            padding: 12px;
-            font-size: 22px;
-            font-weight: 700;
-            background: white;
-            border: 2px solid #667eea;
-            border-radius: 10px;
-            color: #667eea;
-        }
-        
-        .slider-container { margin: 16px 0; }
-        
-        input[type="range"] {
-            width: 100%;
-            height: 6px;
-            background: #e5e7eb;
-            border-radius: 3px;
-            outline: none;
-        }
-        
-        input[type="range"]::-webkit-slider-thumb {
-            -webkit-appearance: none;
-            width: 20px;
-            height: 20px;
-            background: linear-gradient(135deg, #667eea, #764ba2);
-            border-radius: 50%;
-            cursor: pointer;
-        }
-        
-        .button-group {
-            display: flex;
-            gap: 12px;
-            justify-content: center;
-            margin: 20px 0;
-        }
-        
-        .btn {
-            padding: 14px 30px;
-            border: none;
-            border-radius: 10px;
-            font-size: 15px;
-            font-weight: 600;
-            cursor: pointer;
-            transition: all 0.2s;
-            color: white;
-        }
-        
-        .btn-primary { background: linear-gradient(135deg, #667eea, #764ba2); }
-        .btn-stop { background: #ef4444; }
-        .btn-success { background: #10b981; }
-        
-        .btn:hover { transform: translateY(-2px); box-shadow: 0 4px 12px rgba(0,0,0,0.15); }
-        .btn:active { transform: translateY(0); }
-        
-        .status-message {
-            padding: 20px 24px;
-            border-radius: 16px;
-            margin: 20px 0;
-            font-size: 14px;
-            border: none;
-            box-shadow: 0 4px 16px rgba(0,0,0,0.08);
-        }
-        
-        .status-info { 
-            background: linear-gradient(135deg, rgba(219, 234, 254, 0.8) 0%, rgba(147, 197, 253, 0.6) 100%);
-            backdrop-filter: blur(10px);
-            color: #1e40af;
-        }
-        .status-success { 
-            background: linear-gradient(135deg, rgba(209, 250, 229, 0.8) 0%, rgba(134, 239, 172, 0.6) 100%);
-            backdrop-filter: blur(10px);
-            color: #065f46;
-        }
-        .status-error { 
-            background: linear-gradient(135deg, rgba(254, 226, 226, 0.8) 0%, rgba(252, 165, 165, 0.6) 100%);
-            backdrop-filter: blur(10px);
-            color: #991b1b;
-        }
-        
-        .form-section {
-            margin-top: 20px;
-            padding-top: 20px;
-            border-top: 2px solid #e5e7eb;
-        }
-        
-        @media (max-width: 768px) {
-            .header { flex-direction: column; gap: 12px; text-align: center; }
-            .gauges-grid { grid-template-columns: 1fr; }
-            .button-group { flex-direction: column; }
-            .btn { width: 100%; }
-        }
-    </style>
-</head>
-<body>
-    <div class='container'>
-        <div class='header'>
-            <h1>⚡ CORE Test</h1>
-            <small>Conductive Suite Resistance Evaluator</small>
-            <a href='/settings' class='settings-btn'>⚙️ Settings</a>
-        </div>
-        
-        <div id='wifiStatus' class='wifi-status wifi-disconnected'>
-            <span>📡</span>
-            <span id='wifiText'>Disconnected</span>
-        </div>
-        
-        <!-- User Selection -->
-        <div class='control-section' style='margin-bottom: 20px;'>
-            <div style='display: grid; grid-template-columns: 2fr 3fr 2.5fr; gap: 20px; align-items: end;'>
-                <div class='form-group' style='margin-bottom: 0;'>
-                    <label for='uptSelect'>UPT:</label>
-                    <select id='uptSelect' onchange='updateNameList()'>
-                        <option value=''>-- Pilih UPT --</option>
-                        <option value='Pulogadung'>UPT Pulogadung</option>
-                        <option value='Cawang'>UPT Cawang</option>
-                        <option value='Durikosambi'>UPT Durikosambi</option>
-                        <option value='Cilegon'>UPT Cilegon</option>
-                        <option value='Gandul'>UPT Gandul</option>
-                        <option value='Cikupa'>UPT Cikupa</option>
-                    </select>
-                </div>
-                <div class='form-group' style='margin-bottom: 0;'>
-                    <label for='namaInput'>Nama:</label>
-                    <input type='text' id='namaInput' placeholder='Tulis Nama Lengkap' disabled onchange='updateRList()' style='width: 100%; padding: 12px; border: 2px solid #e5e7eb; border-radius: 12px; font-size: 14px; transition: all 0.3s;' onfocus='this.style.borderColor="#667eea"' onblur='this.style.borderColor="#e5e7eb"'>
-                </div>
-                <div class='form-group' style='margin-bottom: 0;'>
-                    <label for='rSelect'>Titik Ukur:</label>
-                    <select id='rSelect' disabled onchange='updateRekapTable()'>
-                        <option value=''>-- Pilih Titik Uji --</option>
-                    </select>
-                </div>
-            </div>
-        </div>
-        
-        <!-- Real-time Gauge Meters -->
-        <div class='gauges-grid'>
-            <div class='gauge-card'>
-                <div class='gauge'>
-                    <svg width='120' height='120'>
-                        <circle class='gauge-bg' cx='60' cy='60' r='52' />
-                        <circle id='voltageGauge' class='gauge-fill' cx='60' cy='60' r='52' 
-                                stroke='#ef4444' stroke-dasharray='326.73' stroke-dashoffset='326.73' />
-                    </svg>
-                    <div class='gauge-value' id='voltageValue'>0V</div>
-                </div>
-                <div class='gauge-label'>Voltage</div>
-            </div>
-            
-            <div class='gauge-card'>
-                <div class='gauge'>
-                    <svg width='120' height='120'>
-                        <circle class='gauge-bg' cx='60' cy='60' r='52' />
-                        <circle id='currentGauge' class='gauge-fill' cx='60' cy='60' r='52' 
-                                stroke='#10b981' stroke-dasharray='326.73' stroke-dashoffset='326.73' />
-                    </svg>
-                    <div class='gauge-value' id='currentValue'>0mA</div>
-                </div>
-                <div class='gauge-label'>Current</div>
-            </div>
-            
-            <div class='gauge-card'>
-                <div class='gauge'>
-                    <svg width='120' height='120'>
-                        <circle class='gauge-bg' cx='60' cy='60' r='52' />
-                        <circle id='resistanceGauge' class='gauge-fill' cx='60' cy='60' r='52' 
-                                stroke='#3b82f6' stroke-dasharray='326.73' stroke-dashoffset='326.73' />
-                    </svg>
-                    <div class='gauge-value' id='resistanceValue'>0Ω</div>
-                </div>
-                <div class='gauge-label'>Resistance</div>
-            </div>
-            
-            <div class='gauge-card'>
-                <div class='gauge'>
-                    <svg width='120' height='120'>
-                        <circle class='gauge-bg' cx='60' cy='60' r='52' />
-                        <circle id='amplitudeGauge' class='gauge-fill' cx='60' cy='60' r='52' 
-                                stroke='#a78bfa' stroke-dasharray='326.73' stroke-dashoffset='326.73' />
-                    </svg>
-                    <div class='gauge-value' id='amplitudeValue'>0%</div>
-                </div>
-                <div class='gauge-label'>Amplitude</div>
-            </div>
-        </div>
-
-        <div class='control-section'>
-            <div class='section-title'>Test Mode Selection</div>
-            <div class='form-group'>
-                <select id='testMode' onchange='updateModeDisplay()'>
-                    <option value='quick'>Manual Mode</option>
-                    <option value='special'>Automatic Mode</option>
-                </select>
-            </div>
-            
-            <div id='modeDisplay' class='status-message status-info'>
-                <div style='font-size: 18px; font-weight: 700; background: linear-gradient(135deg, #667eea 0%, #764ba2 100%); -webkit-background-clip: text; -webkit-text-fill-color: transparent;'><span id='currentModeText'>Manual Mode</span></div>
-                <div style='margin-top: 10px; font-size: 14px; color: #6b7280;' id='modeDescription'>Tes cepat dengan kontrol amplitudo manual</div>
-            </div>
-            
-            <div class='control-card' id='quickControl'>
-                <div class='control-title'>Manual Mode Amplitude</div>
-                <div class='numeric-control'>
-                    <button type='button' class='numeric-btn dec' onclick='changeQuickAmplitude(-1)'>-</button>
-                    <input type='number' id='quickAmplitude' class='numeric-value' min='0' max='100' step='1' value='0' onchange='updateQuickAmplitude(this.value)'>
-                    <button type='button' class='numeric-btn inc' onclick='changeQuickAmplitude(1)'>+</button>
-                </div>
-                <div class='slider-container'>
-                    <input type='range' id='quickAmplitudeSlider' class='slider-inline' min='0' max='100' step='1' value='0' oninput='updateQuickFromSlider(this.value)'>
-                </div>
-                <div class='control-subtitle'>Atur besar injeksi (%) dengan tombol - / + atau geser slide.</div>
-            </div>
-            <div class='control-card' id='specialControl' style='display: none;'>
-            </div>
-            
-            <!-- Shared Timer Display (for both Manual and Automatic modes) -->
-            <div id='timerDisplay' style='display: none; background: linear-gradient(135deg, #10b981 0%, #059669 100%); padding: 28px; border-radius: 16px; text-align: center; margin-bottom: 16px; box-shadow: 0 10px 40px rgba(16, 185, 129, 0.3);'>
-                <div style='font-size: 15px; color: rgba(255,255,255,0.95); margin-bottom: 12px; font-weight: 600; letter-spacing: 1px;'>🕒 RECORDING...</div>
-                <div style='font-size: 48px; font-weight: 700; color: white; text-shadow: 0 4px 8px rgba(0,0,0,0.2);' id='countdownTimer'>02:00</div>
-            </div>
-            
-            <div class='button-group'>
-                <button class='btn btn-primary' id='startBtn' onclick='startTest()'>Start Test</button>
-                <button class='btn btn-primary' id='injectBtn' onclick='injectCurrent()' style='display: none;'>⚡ Inject 200mA</button>
-                <button class='btn btn-success' id='recordBtn' onclick='startRecord()' style='display: none;'>🔴 Record (2 min)</button>
-                <button class='btn btn-stop' id='stopBtn' onclick='stopTest()' style='display: none;'>Stop</button>
-            </div>
-            
-        </div>
-        
-        <!-- Rekap Hasil Uji -->
-        <div class='control-section'>
-            <div class='section-title'>Hasil Pengujian</div>
-            <div style='overflow-x: auto;'>
-                <table style='width: 100%; border-collapse: collapse; font-size: 14px;'>
-                    <thead>
-                        <tr style='background: linear-gradient(135deg, #667eea 0%, #764ba2 100%); color: white;'>
-                            <th style='padding: 12px; border: 1px solid #e5e7eb; text-align: left;'>Titik Pengujian</th>
-                            <th style='padding: 12px; border: 1px solid #e5e7eb; text-align: center;'>Hasil (Ohm)</th>
-                            <th style='padding: 12px; border: 1px solid #e5e7eb; text-align: center;'>Status</th>
-                        </tr>
-                    </thead>
-                    <tbody id='rekapTable'>
-                        <tr>
-                            <td colspan='3' style='padding: 20px; text-align: center; color: #9ca3af;'>Belum ada data</td>
-                        </tr>
-                    </tbody>
-                </table>
-            </div>
-            <div style='text-align: center; margin-top: 20px;'>
-                <button class='btn btn-success' onclick='submitAllData()' style='padding: 15px 40px; font-size: 16px;'>Submit Hasil Pengujian</button>
-            </div>
-            <div id='submissionStatus' class='status-panel' style='display: none;'></div>
-        </div>
-    </div>
-
-    <script>
-        let currentTestMode = 'quick';
-        let testActive = false;
-        let recordingActive = false;
-        let countdownInterval = null;
-
-        // Data nama per UPT
-        const namaPerUPT = {
-            'Pulogadung': [
-                'Hamzah Muntoha',
-                'Dimas Harry Laksana Fajar',
-                'Okky Andreas Triono',
-                'Muhammad Wahyudi',
-                'Andi Arjuna Caesarea',
-                'Anggi Yusuf',
-                'Awang Ibrahim',
-                'Julianus Pellupessy',
-                'Fridom Tusano Hadi',
-                'Afdhal',
-                'Aji Nugraha Yusuf'
-            ],
-            'Cawang': [
-                'Munirul Anam',
-                'Wahyu Ngainur Rofik',
-                'Nur Ali',
-                'Pahala Kemala Simanjuntak'
-            ],
-            'Durikosambi': [
-                'Aris Fardila',
-                'Arif Al Khairi',
-                'Sayiful Elmi'
-            ],
-            'Cilegon': [
-                'Muhammad Asyhari',
-                'Muhammad Abu Rizal',
-                'Pradhitya Wastu Nurjito'
-            ],
-            'Gandul': [
-                'Soni Sofyan',
-                'Muhammad Aditia'
-            ],
-            'Cikupa': [
-                'Zulfikar Hidayat',
-                'Kresna Bayu',
-                'Prisma Panji Pratama'
-            ]
-        };
-        // Note: namaPerUPT is kept for potential future use but nama is now free text input
-        
-        // Data titik ukur R1-R8
-        const titikUkurList = [
-            'R1 - Sarung tangan & tali celana',
-            'R2 - Tali celana & tudung',
-            'R3 - Tali celana & tudung',
-            'R4 - Sarung tangan & tali celana',
-            'R5 - Kaos kaki & tali celana',
-            'R6 - Kaos kaki & tali celana',
-            'R7 - Tali bonding & baju konduktif',
-            'R8 - Tali bonding & baju konduktif'
-        ];
-        
-        // Storage untuk hasil uji
-        let hasilUji = {};
-        
-        function updateNameList() {
-            // Nama is now text input, just enable R dropdown if UPT is selected
-            const uptSelect = document.getElementById('uptSelect');
-            const namaInput = document.getElementById('namaInput');
-            const rSelect = document.getElementById('rSelect');
-            const selectedUPT = uptSelect.value;
-            
-            if (selectedUPT) {
-                namaInput.disabled = false;
-            } else {
-                namaInput.disabled = true;
-                namaInput.value = '';
-            }
-            
-            // Reset R dropdown
-            rSelect.innerHTML = '<option value="">-- Tulis Nama dulu --</option>';
-            rSelect.disabled = true;
-        }
-        
-        function updateRList() {
-            const namaInput = document.getElementById('namaInput');
-            const rSelect = document.getElementById('rSelect');
-            const selectedNama = namaInput.value.trim();
-            
-            if (!selectedNama) {
-                rSelect.disabled = true;
-                rSelect.innerHTML = '<option value="">-- Tulis Nama dulu --</option>';
-                return;
-            }
-            
-            rSelect.disabled = false;
-            rSelect.innerHTML = '<option value="">-- Pilih Titik Ukur --</option>';
-            
-            titikUkurList.forEach((titik, index) => {
-                const option = document.createElement('option');
-                const rKey = 'R' + (index + 1);
-                option.value = rKey;
-                option.textContent = titik;
-                
-                // Tandai jika sudah diisi
-                if (hasilUji[selectedNama] && hasilUji[selectedNama][rKey]) {
-                    option.textContent += ' ✓';
-                    option.style.color = '#10b981';
-                }
-                
-                rSelect.appendChild(option);
-            });
-            
-            // Auto-select R pertama yang belum diisi
-            if (hasilUji[selectedNama]) {
-                for (let i = 1; i <= 8; i++) {
-                    const rKey = 'R' + i;
-                    if (!hasilUji[selectedNama][rKey]) {
-                        rSelect.value = rKey;
-                        break;
-                    }
-                }
-            } else {
-                rSelect.value = 'R1'; // Default R1
-            }
-            
-            updateRekapTable();
-        }
-
-        function updateModeDisplay() {
-            const mode = document.getElementById('testMode').value;
-            const display = document.getElementById('modeDisplay');
-            const currentModeText = document.getElementById('currentModeText');
-            const modeDescription = document.getElementById('modeDescription');
-            const quickControl = document.getElementById('quickControl');
-            const specialControl = document.getElementById('specialControl');
-            
-            currentTestMode = mode;
-            
-            if (mode === 'quick') {
-                currentModeText.textContent = 'Manual Mode';
-                modeDescription.textContent = '';
-                display.className = 'status-panel status-info';
-                display.style.display = 'none';
-                quickControl.style.display = 'block';
-                specialControl.style.display = 'none';
-                // Reset buttons
-                document.getElementById('startBtn').style.display = 'inline-block';
-                document.getElementById('injectBtn').style.display = 'none';
-                document.getElementById('recordBtn').style.display = 'none';
-                document.getElementById('stopBtn').style.display = 'none';
-            } else if (mode === 'special') {
-                currentModeText.textContent = 'Automatic Mode';
-                modeDescription.textContent = '';
-                display.className = 'status-panel status-info';
-                display.style.display = 'none';
-                quickControl.style.display = 'none';
-                specialControl.style.display = 'block';
-                // Show inject button
-                document.getElementById('startBtn').style.display = 'none';
-                document.getElementById('injectBtn').style.display = 'inline-block';
-                document.getElementById('recordBtn').style.display = 'none';
-                document.getElementById('stopBtn').style.display = 'none';
-            }
-        }
-        
-        function injectCurrent() {
-            // Validasi UPT, Nama, dan R harus dipilih
-            if (!validateSelection()) {
-                return;
-            }
-            
-            // Start injecting 200mA in 3 seconds
-            updateStatusMessage('⚡ Injecting 200mA... (3 seconds)');
-            document.getElementById('injectBtn').disabled = true;
-            
-            // Simulate 3 second injection (in real implementation, ESP32 will ramp up)
-            fetch('/api/auto-injection?action=inject&target=200', {method: 'POST'})
-                .then(response => response.json())
-                .then(data => {
-                    setTimeout(() => {
-                        document.getElementById('injectBtn').style.display = 'none';
-                        document.getElementById('recordBtn').style.display = 'inline-block';
-                        document.getElementById('stopBtn').style.display = 'inline-block';
-                        updateStatusMessage('✅ 200mA tercapai! Klik Record untuk mulai timer.');
-                    }, 3000);
-                });
-        }
-        
-        function startRecord() {
-            // Start 2 minute recording
-            recordingActive = true;
-            document.getElementById('recordBtn').style.display = 'none';
-            document.getElementById('timerDisplay').style.display = 'block';
-            updateStatusMessage('🔴 Recording... Timer berjalan 2 menit.');
-            
-            // Panggil API record ke ESP32 (works for both manual and automatic mode)
-            if (currentTestMode === 'special') {
-                fetch('/api/auto-injection?action=record', {method: 'POST'})
-                    .then(response => response.json())
-                    .then(data => {
-                        console.log('Recording started on ESP32 (Automatic Mode)');
-                    });
-            } else {
-                // Manual mode - just start timer, injection already running
-                console.log('Recording started (Manual Mode)');
-            }
-            
-            // Start countdown timer
-            let timeLeft = 120; // 2 minutes in seconds
-            countdownInterval = setInterval(() => {
-                timeLeft--;
-                const minutes = Math.floor(timeLeft / 60);
-                const seconds = timeLeft % 60;
-                document.getElementById('countdownTimer').textContent = 
-                    String(minutes).padStart(2, '0') + ':' + String(seconds).padStart(2, '0');
-                
-                if (timeLeft <= 0) {
-                    clearInterval(countdownInterval);
-                    recordingActive = false;
-                    document.getElementById('timerDisplay').style.display = 'none';
-                    updateStatusMessage('✅ Recording selesai! Menyimpan data...');
-                    
-                    // Auto-submit data setelah recording selesai
-                    autoSaveAndNext();
-                    
-                    // Stop injection after timer ends
-                    if (currentTestMode === 'quick') {
-                        // Manual Mode - stop and reset amplitude to 0
-                        fetch('/set_amplitude?state=STOP')
-                            .then(response => response.text())
-                            .then(() => {
-                                const ampEl = document.getElementById('quickAmplitude');
-                                const slider = document.getElementById('quickAmplitudeSlider');
-                                if (ampEl) {
-                                    ampEl.value = 0;
-                                    ampEl.readOnly = false;
-                                }
-                                if (slider) {
-                                    slider.value = 0;
-                                    slider.disabled = false;
-                                }
-                            });
-                    } else {
-                        // Automatic Mode - stop auto injection
-                        fetch('/api/auto-injection?action=stop', {method: 'POST'});
-                    }
-                }
-            }, 1000);
-        }
-        
-        function autoSaveAndNext() {
-            const namaInput = document.getElementById('namaInput');
-            const rSelect = document.getElementById('rSelect');
-            const selectedNama = namaInput.value.trim();
-            const selectedR = rSelect.value;
-            
-            // Ambil nilai resistance dari sensor
-            fetch('/status')
-                .then(response => response.json())
-                .then(statusData => {
-                    const resistance = statusData.resistance.toFixed(2);
-                    
-                    // Simpan ke hasil uji
-                    if (!hasilUji[selectedNama]) {
-                        hasilUji[selectedNama] = {};
-                    }
-                    hasilUji[selectedNama][selectedR] = resistance;
-                    
-                    // Update tabel rekap
-                    updateRekapTable();
-                    
-                    // Cari R berikutnya yang belum diisi
-                    let nextR = null;
-                    for (let i = 1; i <= 8; i++) {
-                        const rKey = 'R' + i;
-                        if (!hasilUji[selectedNama][rKey]) {
-                            nextR = rKey;
-                            break;
-                        }
-                    }
-                    
-                    // Reset buttons
-                    document.getElementById('injectBtn').style.display = 'inline-block';
-                    document.getElementById('injectBtn').disabled = false;
-                    document.getElementById('recordBtn').style.display = 'none';
-                    document.getElementById('stopBtn').style.display = 'none';
-                    
-                    // Pindah ke R berikutnya atau selesai
-                    if (nextR) {
-                        rSelect.value = nextR;
-                        updateStatusMessage('✅ ' + selectedR + ' tersimpan: ' + resistance + 'Ω. Lanjut ke ' + nextR + '.');
-                    } else {
-                        updateStatusMessage('🎉 Semua titik ukur (R1-R8) sudah selesai!');
-                    }
-                    
-                    // Refresh R list untuk update tanda centang
-                    updateRList();
-                });
-        }
-
-        function updateQuickAmplitude(value) {
-            if (currentTestMode !== 'quick') return;
-            const v = Math.max(0, Math.min(100, parseInt(value || '0')));
-            const input = document.getElementById('quickAmplitude');
-            const slider = document.getElementById('quickAmplitudeSlider');
-            const normalized = isNaN(v) ? 0 : v;
-
-            if (input) {
-                input.value = normalized;
-            }
-            if (slider) {
-                slider.value = normalized;
-            }
-
-            if (testActive) {
-                fetch('/set_amplitude?value=' + normalized)
-                    .then(response => response.text())
-                    .then(data => console.log('Quick amplitude updated:', normalized));
-            }
-        }
-
-        function updateQuickFromSlider(value) {
-            if (currentTestMode !== 'quick') return;
-            const v = Math.max(0, Math.min(100, parseInt(value || '0')));
-            const slider = document.getElementById('quickAmplitudeSlider');
-            const normalized = isNaN(v) ? 0 : v;
-
-            if (slider) {
-                slider.value = normalized;
-            }
-            // Delegasikan ke updateQuickAmplitude supaya input angka ikut sinkron dan,
-            // kalau testActive, nilai juga terkirim ke alat.
-            updateQuickAmplitude(normalized);
-        }
-
-        function changeQuickAmplitude(delta) {
-            const input = document.getElementById('quickAmplitude');
-            if (!input) return;
-            const current = parseInt(input.value || '0');
-            let next = isNaN(current) ? 0 : current + delta;
-            if (next < 0) next = 0;
-            if (next > 100) next = 100;
-            // Hanya ganti lewat fungsi umum supaya slider dan backend ikut sinkron
-            updateQuickAmplitude(next);
-        }
-
-        function changeSpecialDuration(delta) {
-            const input = document.getElementById('specialDuration');
-            if (!input) return;
-            const current = parseInt(input.value || '0');
-            let next = isNaN(current) ? 0 : current + delta;
-            if (next < 1) next = 1;
-            if (next > 3600) next = 3600;
-            input.value = next;
-        }
-
-        function validateSelection() {
-            const uptSelect = document.getElementById('uptSelect');
-            const namaInput = document.getElementById('namaInput');
-            const rSelect = document.getElementById('rSelect');
-            
-            if (!uptSelect.value) {
-                alert('⚠️ Harap pilih UPT terlebih dahulu!');
-                return false;
-            }
-            
-            if (!namaInput.value.trim()) {
-                alert('⚠️ Harap tulis Nama Lengkap terlebih dahulu!');
-                return false;
-            }
-            
-            if (!rSelect.value) {
-                alert('⚠️ Harap pilih Titik Ukur (R1-R8) terlebih dahulu!');
-                return false;
-            }
-            
-            return true;
-        }
-        
-        function startTest() {
-            // Validasi UPT, Nama, dan R harus dipilih
-            if (!validateSelection()) {
-                return;
-            }
-            
-            if (currentTestMode === 'special') {
-                // Should not reach here - special mode uses injectCurrent()
-                return;
-            } else { // Manual Mode - start injection
-                const ampInput = document.getElementById('quickAmplitude');
-                const amp = Math.max(0, Math.min(100, parseInt(ampInput.value || '0')));
-                ampInput.value = amp;
-                
-                updateStatusMessage('⚡ Injecting current with ' + amp + '% amplitude...');
-                document.getElementById('startBtn').disabled = true;
-                
-                fetch('/set_amplitude?value=' + amp)
-                    .then(response => response.text())
-                    .then(() => {
-                        return fetch('/set_amplitude?state=RUN');
-                    })
-                    .then(response => response.text())
-                    .then(() => {
-                        testActive = true;
-                        document.getElementById('startBtn').style.display = 'none';
-                        document.getElementById('recordBtn').style.display = 'inline-block';
-                        document.getElementById('stopBtn').style.display = 'inline-block';
-                        // Lock amplitude input and slider
-                        const ampEl = document.getElementById('quickAmplitude');
-                        const slider = document.getElementById('quickAmplitudeSlider');
-                        if (ampEl) ampEl.readOnly = true;
-                        if (slider) slider.disabled = true;
-                        updateStatusMessage('✅ Injection aktif dengan ' + amp + '% amplitude. Klik Record untuk mulai timer.');
-                    });
-            }
-        }
-
-        function stopTest() {
-            if (currentTestMode === 'special') {
-                if (countdownInterval) {
-                    clearInterval(countdownInterval);
-                    countdownInterval = null;
-                }
-                fetch('/api/auto-injection?action=stop', {method: 'POST'})
-                    .then(response => response.json())
-                    .then(data => {
-                        testActive = false;
-                        recordingActive = false;
-                        document.getElementById('timerDisplay').style.display = 'none';
-                        document.getElementById('injectBtn').style.display = 'inline-block';
-                        document.getElementById('injectBtn').disabled = false;
-                        document.getElementById('recordBtn').style.display = 'none';
-                        document.getElementById('stopBtn').style.display = 'none';
-                        updateStatusMessage('Automatic Mode dihentikan.');
-                    });
-            } else { // Manual Mode
-                if (countdownInterval) {
-                    clearInterval(countdownInterval);
-                    countdownInterval = null;
-                }
-                fetch('/set_amplitude?state=STOP')
-                    .then(response => response.text())
-                    .then(data => {
-                        testActive = false;
-                        recordingActive = false;
-                        document.getElementById('timerDisplay').style.display = 'none';
-                        document.getElementById('startBtn').style.display = 'inline-block';
-                        document.getElementById('startBtn').disabled = false;
-                        document.getElementById('recordBtn').style.display = 'none';
-                        document.getElementById('stopBtn').style.display = 'none';
-                        // Unlock amplitude controls
-                        const ampEl = document.getElementById('quickAmplitude');
-                        const slider = document.getElementById('quickAmplitudeSlider');
-                        if (ampEl) {
-                            ampEl.readOnly = false;
-                        }
-                        if (slider) {
-                            slider.disabled = false;
-                        }
-                        updateStatusMessage('Manual Mode dihentikan.');
-                    });
-            }
-        }
-
-        function resetButtons() {
-            document.getElementById('startBtn').style.display = 'inline-block';
-            document.getElementById('stopBtn').style.display = 'none';
-        }
-
-        function updateStatusMessage(message) {
-            const display = document.getElementById('modeDisplay');
-            display.className = 'status-panel status-success';
-            document.getElementById('modeDescription').textContent = message;
-        }
-        
-        function updateRekapTable() {
-            const namaInput = document.getElementById('namaInput');
-            const selectedNama = namaInput.value.trim();
-            const tbody = document.getElementById('rekapTable');
-            
-            if (!selectedNama || !hasilUji[selectedNama] || Object.keys(hasilUji[selectedNama]).length === 0) {
-                tbody.innerHTML = '<tr><td colspan="3" style="padding: 20px; text-align: center; color: #9ca3af;">Belum ada data</td></tr>';
-                return;
-            }
-            
-            tbody.innerHTML = '';
-            for (let i = 1; i <= 8; i++) {
-                const rKey = 'R' + i;
-                const row = document.createElement('tr');
-                
-                const cellTitik = document.createElement('td');
-                cellTitik.style.cssText = 'padding: 10px; border: 1px solid #e5e7eb;';
-                cellTitik.innerHTML = '<strong>' + rKey + '</strong><br><small style="color: #6b7280;">' + titikUkurList[i - 1] + '</small>';
-                
-                const cellR = document.createElement('td');
-                cellR.style.cssText = 'padding: 10px; border: 1px solid #e5e7eb; font-weight: 600; text-align: center;';
-                
-                const cellStatus = document.createElement('td');
-                cellStatus.style.cssText = 'padding: 10px; border: 1px solid #e5e7eb; text-align: center;';
-                
-                if (hasilUji[selectedNama][rKey]) {
-                    const resistance = parseFloat(hasilUji[selectedNama][rKey]);
-                    cellR.textContent = resistance.toFixed(2);
-                    
-                    // Status: Good jika ≤ 200 Ω, Bad jika > 200 Ω
-                    if (resistance <= 200) {
-                        cellStatus.innerHTML = '<span style="display: inline-block; padding: 6px 16px; background: #10b981; color: white; border-radius: 6px; font-weight: 600; font-size: 13px;">Good</span>';
-                    } else {
-                        cellStatus.innerHTML = '<span style="display: inline-block; padding: 6px 16px; background: #ef4444; color: white; border-radius: 6px; font-weight: 600; font-size: 13px;">Bad</span>';
-                    }
-                } else {
-                    cellR.innerHTML = '<span style="color: #9ca3af;">-</span>';
-                    cellStatus.innerHTML = '<span style="color: #9ca3af; font-size: 13px;">Belum diuji</span>';
-                }
-                
-                row.appendChild(cellTitik);
-                row.appendChild(cellR);
-                row.appendChild(cellStatus);
-                tbody.appendChild(row);
-            }
-        }
+String requestBody(AsyncWebServerRequest* request) {
+  return request->_tempObject != NULL ? String((const char*)request->_tempObject) : String();
+}
 
-        function submitAllData() {
-            const uptSelect = document.getElementById('uptSelect');
-            const namaInput = document.getElementById('namaInput');
-            const selectedUPT = uptSelect.value;
-            const selectedNama = namaInput.value.trim();
-            
-            // Validasi UPT dan Nama
-            if (!selectedUPT || !selectedNama) {
-                const status = document.getElementById('submissionStatus');
-                status.className = 'status-panel status-error';
-                status.textContent = '⚠️ Harap pilih UPT dan Nama terlebih dahulu!';
-                status.style.display = 'block';
-                return;
-            }
-            
-            // Validasi ada data yang sudah diuji
-            if (!hasilUji[selectedNama] || Object.keys(hasilUji[selectedNama]).length === 0) {
-                const status = document.getElementById('submissionStatus');
-                status.className = 'status-panel status-error';
-                status.textContent = '⚠️ Belum ada data pengujian yang tersimpan!';
-                status.style.display = 'block';
-                return;
-            }
-            
-            // Siapkan data untuk submit
-            const data = {
-                UPT: 'UPT ' + selectedUPT,
-                NIP: selectedNama,
-                HASIL_UJI: hasilUji[selectedNama],
-                timestamp: new Date().toISOString()
-            };
-            
-            // Submit ke server
-            fetch('/api/submit-data', {
-                method: 'POST',
-                headers: {'Content-Type': 'application/json'},
-                body: JSON.stringify(data)
-            })
-            .then(response => response.json())
-            .then(result => {
-                const status = document.getElementById('submissionStatus');
-                if (result.success) {
-                    status.className = 'status-panel status-success';
-                    status.textContent = '✅ Data berhasil dikirim ke server!';
-                    status.style.display = 'block';
-                } else {
-                    status.className = 'status-panel status-error';
-                    status.textContent = '❌ Gagal mengirim data: ' + result.message;
-                    status.style.display = 'block';
-                }
-            })
-            .catch(error => {
-                const status = document.getElementById('submissionStatus');
-                status.className = 'status-panel status-error';
-                status.textContent = '❌ Error: ' + error.message;
-                status.style.display = 'block';
-            });
-        }
-        
-        function showForm() {
-            document.getElementById('dataForm').style.display = 'block';
-        }
+// Body di atas WEB_MAX_BODY tidak dikumpulkan collectRequestBody; jawab 413
+// daripada memproses body kosong. True jika respons sudah dikirim.
+bool rejectOversizedBody(AsyncWebServerRequest* request) {
+  if (request->contentLength() <= WEB_MAX_BODY) return false;
+  request->send(413, "application/json", "{\"success\":false,\"message\":\"Body too large\"}");
+  return true;
+}
 
-        function submitToCloud(event) {
-            event.preventDefault();
-
-            const uptSelect = document.getElementById('uptSelect');
-            const namaSelect = document.getElementById('namaSelect');
-            const formData = new FormData(document.getElementById('dataForm'));
-            
-            // Validasi UPT dan Nama harus dipilih
-            if (!uptSelect.value || !namaSelect.value) {
-                const status = document.getElementById('submissionStatus');
-                status.className = 'status-panel status-error';
-                status.textContent = 'Harap pilih UPT dan Nama terlebih dahulu!';
-                status.style.display = 'block';
-                return;
-            }
-            
-            // Hanya kirim 4 item ke cloud: UPT, NIP (Nama), KODE_SUIT, R
-            const data = {
-                UPT: 'UPT ' + uptSelect.value,
-                NIP: namaSelect.value,
-                KODE_SUIT: formData.get('kodeSuit'),
-                R: 0
-            };
-
-            // Ambil nilai R (resistance) terakhir dari alat
-            fetch('/status')
-                .then(response => response.json())
-                .then(statusData => {
-                    data.R = statusData.resistance;
-
-                    const rField = document.getElementById('hasilR');
-                    if (rField) {
-                        rField.value = statusData.resistance.toFixed(2);
-                    }
-
-                    return fetch('/api/submit-data', {
-                        method: 'POST',
-                        headers: {'Content-Type': 'application/json'},
-                        body: JSON.stringify(data)
-                    });
-                })
-                .then(response => response.json())
-                .then(result => {
-                    const status = document.getElementById('submissionStatus');
-                    if (result.success) {
-                        status.className = 'status-panel status-success';
-                        status.textContent = 'Data submitted successfully! Reference ID: ' + result.referenceId;
-                        document.getElementById('dataForm').reset();
-                    } else {
-                        status.className = 'status-panel status-error';
-                        status.textContent = 'Failed to submit data: ' + result.message;
-                    }
-                    status.style.display = 'block';
-                })
-                .catch(error => {
-                    const status = document.getElementById('submissionStatus');
-                    status.className = 'status-panel status-error';
-                    status.textContent = 'Error submitting data: ' + error.message;
-                    status.style.display = 'block';
-                });
-        }
+// If-None-Match bisa berisi beberapa tag atau prefix W/, cukup cari tag-nya.
+// Jika cocok langsung kirim 304 dan return true.
+bool sendNotModified(AsyncWebServerRequest* request, const char* etag, const char* cacheControl) {
+  if (!request->hasHeader("If-None-Match") || request->header("If-None-Match").indexOf(etag) < 0) return false;
+  AsyncWebServerResponse* response = request->beginResponse(304);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", cacheControl);
+  request->send(response);
+  return true;
+}
 
-        // Update gauge animation
-        function updateGauge(gaugeId, value, maxValue) {
-            const gauge = document.getElementById(gaugeId);
-            const circumference = 326.73;
-            const percent = Math.min(value / maxValue, 1);
-            const offset = circumference * (1 - percent);
-            gauge.style.strokeDashoffset = offset;
-        }
-        
-        function updateReadings() {
-            fetch('/status')
-                .then(response => response.json())
-                .then(data => {
-                    // Update gauge meters with animation
-                    document.getElementById('voltageValue').textContent = data.voltage.toFixed(1) + 'V';
-                    updateGauge('voltageGauge', data.voltage, 250); // Max 250V
-                    
-                    const currentMA = (data.current * 1000).toFixed(0);
-                    document.getElementById('currentValue').textContent = currentMA + 'mA';
-                    updateGauge('currentGauge', data.current * 1000, 1000); // Max 1000mA
-                    
-                    document.getElementById('resistanceValue').textContent = data.resistance.toFixed(1) + 'Ω';
-                    updateGauge('resistanceGauge', data.resistance, 1000); // Max 1000Ω
-                    
-                    const ampPercent = (data.amplitude * 100).toFixed(0);
-                    document.getElementById('amplitudeValue').textContent = ampPercent + '%';
-                    updateGauge('amplitudeGauge', ampPercent, 100); // Max 100%
-                    
-                    const quickInput = document.getElementById('quickAmplitude');
-                    if (quickInput && testActive && currentTestMode === 'quick') {
-                        quickInput.value = ampPercent;
-                    }
-
-                    const rField = document.getElementById('hasilR');
-                    if (rField) {
-                        rField.value = data.resistance.toFixed(2);
-                    }
-
-                    if (data.wifiConnected) {
-                        document.getElementById('wifiStatus').className = 'wifi-status wifi-connected';
-                        document.getElementById('wifiText').textContent = 'Connected to ' + data.wifiSSID;
-                    } else {
-                        document.getElementById('wifiStatus').className = 'wifi-status wifi-disconnected';
-                        document.getElementById('wifiText').textContent = 'Disconnected';
-                    }
-                })
-                .catch(error => {
-                    console.error('Error fetching status:', error);
-                });
-        }
+// Kirim halaman ter-gzip langsung dari flash. beginResponse_P membaca isi
+// PROGMEM per chunk ke buffer TCP tanpa membuat String di heap. Klien yang
+// sudah punya versi yang sama cukup dapat 304.
+void sendWebAsset(AsyncWebServerRequest* request, const WebAsset& asset) {
+  if (sendNotModified(request, asset.etag, WEB_ASSET_CACHE_CONTROL)) return;
+  AsyncWebServerResponse* response = request->beginResponse_P(200, asset.contentType, asset.data, asset.length);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", WEB_ASSET_CACHE_CONTROL);
+  request->send(response);
+}
 
-        updateReadings();
-        setInterval(updateReadings, 1000);
-        updateModeDisplay();
-    </script>
-</body>
-</html>
-  )";
+void handleRoot(AsyncWebServerRequest* request) {
+  // Stop auto injection when returning to injection dashboard
+  if (autoInjectionMode) {
+    stopAutoInjection();
+  }
 
-  server.send(200, "text/html", html);
+  sendWebAsset(request, WEB_INDEX);
 }
 
-void handleSettings() {
-  // Always load latest saved settings from NVS
-  loadSettingsFromMemory();
+void handleSettings(AsyncWebServerRequest* request) {
+  // Nilai aktif selalu sama dengan NVS (hanya loop() yang menyimpan dan
+  // menggantinya), cukup disalin di bawah settingsMutex
+  xSemaphoreTake(settingsMutex, portMAX_DELAY);
+  String ssid = wifiSSID;
+  String password = wifiPassword;
+  String host = mqttHost;
+  int port = mqttPort;
+  String user = mqttUser;
+  String pass = mqttPass;
+  String clientId = mqttClientId;
+  String topic = mqttTopic;
+  xSemaphoreGive(settingsMutex);
 
   String html =
 "<!DOCTYPE html>\n"
@@ -1722,11 +981,11 @@ void handleSettings() {
 "            <h3>WiFi Settings</h3>\n"
 "            <div class='form-group'>\n"
 "                <label for='wifiSSID'>WiFi SSID:</label>\n"
-"                <input type='text' id='wifiSSID' value='" + wifiSSID + "' placeholder='Enter WiFi network name'>\n"
+"                <input type='text' id='wifiSSID' value='" + ssid + "' placeholder='Enter WiFi network name'>\n"
 "            </div>\n"
 "            <div class='form-group'>\n"
 "                <label for='wifiPassword'>WiFi Password:</label>\n"
-"                <input type='password' id='wifiPassword' value='" + wifiPassword + "' placeholder='Enter WiFi password'>\n"
+"                <input type='password' id='wifiPassword' value='" + password + "' placeholder='Enter WiFi password'>\n"
 "            </div>\n"
 "            <button class='btn btn-primary' onclick='saveWiFiSettings()'>Connect to WiFi</button>\n"
 "            <button class='btn btn-secondary' onclick='resetWiFi()' style='background: #dc3545; border-color: #dc3545;'>Reset to PDKB_INTERNET_G</button>\n"
@@ -1737,27 +996,27 @@ void handleSettings() {
 "            <h3>Cloud Server Settings (MQTT)</h3>\n"
 "            <div class='form-group'>\n"
 "                <label for='mqttHost'>MQTT Host:</label>\n"
-"                <input type='text' id='mqttHost' value='" + mqttHost + "' placeholder='vps.domain.com'>\n"
+"                <input type='text' id='mqttHost' value='" + host + "' placeholder='vps.domain.com'>\n"
 "            </div>\n"
 "            <div class='form-group'>\n"
 "                <label for='mqttPort'>MQTT Port:</label>\n"
-"                <input type='text' id='mqttPort' value='" + String(mqttPort) + "' placeholder='1883'>\n"
+"                <input type='text' id='mqttPort' value='" + String(port) + "' placeholder='1883'>\n"
 "            </div>\n"
 "            <div class='form-group'>\n"
 "                <label for='mqttUser'>MQTT Username:</label>\n"
-"                <input type='text' id='mqttUser' value='" + mqttUser + "' placeholder='esp1'>\n"
+"                <input type='text' id='mqttUser' value='" + user + "' placeholder='esp1'>\n"
 "            </div>\n"
 "            <div class='form-group'>\n"
 "                <label for='mqttPass'>MQTT Password:</label>\n"
-"                <input type='password' id='mqttPass' value='" + mqttPass + "' placeholder='password'>\n"
+"                <input type='password' id='mqttPass' value='" + pass + "' placeholder='password'>\n"
 "            </div>\n"
 "            <div class='form-group'>\n"
 "                <label for='mqttClientId'>MQTT Client ID:</label>\n"
-"                <input type='text' id='mqttClientId' value='" + mqttClientId + "' placeholder='esp32_01'>\n"
+"                <input type='text' id='mqttClientId' value='" + clientId + "' placeholder='esp32_01'>\n"
 "            </div>\n"
 "            <div class='form-group'>\n"
 "                <label for='mqttTopic'>MQTT Topic (publish):</label>\n"
-"                <input type='text' id='mqttTopic' value='" + mqttTopic + "' placeholder='sensor/esp32'>\n"
+"                <input type='text' id='mqttTopic' value='" + topic + "' placeholder='sensor/esp32'>\n"
 "            </div>\n"
 "            <button class='btn btn-success' onclick='saveCloudSettings()'>Save MQTT Settings</button>\n"
 "            <div id='cloudStatus'></div>\n"
@@ -1768,6 +1027,7 @@ void handleSettings() {
 "        </div>\n"
 "    </div>\n"
 "\n"
+"    <script src='/live.js'></script>\n"
 "    <script>\n"
 "        function saveWiFiSettings() {\n"
 "            const ssid = document.getElementById('wifiSSID').value;\n"
@@ -1782,6 +1042,7 @@ void handleSettings() {
 "                body: 'ssid=' + encodeURIComponent(ssid) + '&password=' + encodeURIComponent(password)\n"
 "            })\n"
 "            .then(response => response.json())\n"
+"            .then(data => awaitJob('/api/wifi', data))\n"
 "            .then(data => {\n"
 "                if (data.success) {\n"
 "                    showStatus('wifiStatus', 'WiFi connection successful!', 'success');\n"
@@ -1864,7 +1125,17 @@ void handleSettings() {
 "</body>\n"
 "</html>\n";
 
-  server.send(200, "text/html", html);
+  // Isi halaman ikut nilai tersimpan, jadi ETag dihitung dari HTML hasil
+  // render (FNV-1a) dan klien wajib revalidasi tiap kali.
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < html.length(); i++) hash = (hash ^ (uint8_t)html[i]) * 16777619u;
+  char etag[12];
+  snprintf(etag, sizeof(etag), "\"%08lx\"", (unsigned long)hash);
+  if (sendNotModified(request, etag, "no-cache")) return;
+  AsyncWebServerResponse* response = request->beginResponse(200, "text/html", html);
+  response->addHeader("ETag", etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
 
 void loadSettingsFromMemory() {
@@ -1872,6 +1143,7 @@ void loadSettingsFromMemory() {
   preferences.begin("core-settings", false);
   
   // Load saved settings or use defaults
+  xSemaphoreTake(settingsMutex, portMAX_DELAY);
   wifiSSID = preferences.getString("wifiSSID", "PDKB_INTERNET_G");
   wifiPassword = preferences.getString("wifiPassword", "uptpulogadung");
   cloudServerAddress = preferences.getString("cloudServer", "https://api.example.com/submit-data");
@@ -1883,6 +1155,7 @@ void loadSettingsFromMemory() {
   mqttPass = preferences.getString("mqttPass", "password");
   mqttClientId = preferences.getString("mqttClientId", "esp32_01");
   mqttTopic = preferences.getString("mqttTopic", "sensor/esp32");
+  xSemaphoreGive(settingsMutex);
   
   preferences.end();
   
@@ -1902,15 +1175,25 @@ void resetWiFiSettings() {
   preferences.end();
   
   // Reset to default values
+  xSemaphoreTake(settingsMutex, portMAX_DELAY);
   wifiSSID = "PDKB_INTERNET_G";
   wifiPassword = "uptpulogadung";
   cloudServerAddress = "https://api.example.com/submit-data";
+  xSemaphoreGive(settingsMutex);
   
   Serial.println("WiFi settings reset to default:");
   Serial.println("WiFi SSID: " + wifiSSID);
   Serial.println("WiFi Password: " + wifiPassword);
 }
 
+// Salinan SSID untuk handler async (lihat settingsMutex)
+String currentWifiSSID() {
+  xSemaphoreTake(settingsMutex, portMAX_DELAY);
+  String ssid = wifiSSID;
+  xSemaphoreGive(settingsMutex);
+  return ssid;
+}
+
 void saveSettingsToMemory(const String& ssid, const String& password, const String& cloudServer) {
   Preferences preferences;
   preferences.begin("core-settings", false);
@@ -1926,696 +1209,30 @@ void saveSettingsToMemory(const String& ssid, const String& password, const Stri
   Serial.println("Cloud Server: " + cloudServer);
 }
 
-void handleMainMenu() {
+void handleMainMenu(AsyncWebServerRequest* request) {
   // Redirect to root for now
-  server.send(302, "Location", "/");
-}
-
-void handleInjection() {
-  String html = R"(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>CORE Test</title>
-    <meta charset='UTF-8'>
-    <meta name='viewport' content='width=device-width, initial-scale=1.0'>
-    <style>
-        body { font-family: Arial; margin: 20px; background: #f0f0f0; }
-        .container { max-width: 600px; margin: 0 auto; background: white; padding: 20px; border-radius: 10px; }
-        .form-group { margin: 20px 0; }
-        label { display: block; margin-bottom: 5px; font-weight: bold; }
-        select, input[type='text'] { width: 100%; padding: 10px; border: 1px solid #ddd; border-radius: 5px; box-sizing: border-box; }
-        .btn { padding: 15px 30px; margin: 10px 5px; border: none; border-radius: 5px; cursor: pointer; font-size: 16px; }
-        .btn-primary { background: #007bff; color: white; }
-        .btn-primary:hover { background: #0056b3; }
-        .btn-secondary { background: #6c757d; color: white; }
-        .btn-secondary:hover { background: #545b62; }
-        .btn-success { background: #28a745; color: white; }
-        .btn-success:hover { background: #1e7e34; }
-        .btn-stop { background: #dc3545; color: white; }
-        .btn-stop:hover { background: #c82333; }
-        .readings { display: grid; grid-template-columns: 1fr 1fr 1fr; gap: 15px; margin: 20px 0; }
-        .reading { background: #e9ecef; padding: 15px; border-radius: 5px; text-align: center; }
-        .value { font-size: 24px; font-weight: bold; color: #495057; }
-        .label { font-size: 14px; color: #6c757d; margin-bottom: 5px; }
-        .status-panel { padding: 15px; border-radius: 5px; margin: 20px 0; }
-        .status-success { background: #d4edda; border: 1px solid #c3e6cb; color: #155724; }
-        .status-error { background: #f8d7da; border: 1px solid #f5c6cb; color: #721c24; }
-        .status-info { background: #d1ecf1; border: 1px solid #bee5eb; color: #0c5460; }
-    </style>
-</head>
-<body>
-    <div class='container'>
-        <h1>CORE Test</h1>
-        
-        <div class='readings'>
-            <div class='reading'>
-                <div class='label'>Voltage</div>
-                <div class='value' id='voltageValue'>0.00 V</div>
-            </div>
-            <div class='reading'>
-                <div class='label'>Current</div>
-                <div class='value' id='currentValue'>0.00 A</div>
-            </div>
-            <div class='reading'>
-                <div class='label'>Resistance</div>
-                <div class='value' id='resistanceValue'>0.00 Ω</div>
-            </div>
-        </div>
-        
-        <div class='form-group'>
-            <label for='testMode'>Test Mode:</label>
-            <select id='testMode' onchange='updateModeDisplay()'>
-                <option value='manual'>Manual Injection</option>
-                <option value='200ma'>200mA Auto Injection</option>
-                <option value='runtime'>Runtime Mode (2 min)</option>
-            </select>
-        </div>
-        
-        <div id='modeDisplay' class='status-panel status-info'>
-            <strong>Current Mode:</strong> <span id='currentModeText'>Manual Injection</span>
-            <p id='modeDescription'>Adjustable amplitude with manual control</p>
-        </div>
-        
-        <div class='form-group' id='amplitudeControl' style='display: none;'>
-            <label for='amplitudeSlider'>Amplitude: <span id='amplitudeDisplay'>0%</span></label>
-            <input type='range' id='amplitudeSlider' min='0' max='100' value='0' onchange='updateAmplitude(this.value)'>
-        </div>
-        
-        <div class='button-group'>
-            <button class='btn btn-primary' id='startBtn' onclick='startTest()'>Start Test</button>
-            <button class='btn btn-stop' id='stopBtn' onclick='stopTest()' style='display: none;'>Stop</button>
-            <button class='btn btn-success' id='submitBtn' onclick='showForm()'>Submit to Cloud</button>
-        </div>
-        
-        <form id='dataForm' onsubmit='submitToCloud(event)'>
-            <div class='form-group'>
-                <label for='upt'>UPT:</label>
-                <input type='text' id='upt' name='upt' required>
-            </div>
-            <div class='form-group'>
-                <label for='nip'>NIP:</label>
-                <input type='text' id='nip' name='nip' required>
-            </div>
-            <div class='form-group'>
-                <label for='kodeSuit'>KODE_SUIT:</label>
-                <input type='text' id='kodeSuit' name='kodeSuit' required>
-            </div>
-            <div class='form-group'>
-                <label for='hasilR'>R (hasil uji):</label>
-                <input type='text' id='hasilR' name='hasilR' readonly>
-            </div>
-            <button type='submit' class='btn btn-success'>Submit Test Results</button>
-        </form>
-        
-        <div id='submissionStatus' class='status-panel' style='display: none;'></div>
-        
-        <div style='text-align: center; margin-top: 30px;'>
-            <button class='btn btn-secondary' onclick="window.location.href='/'">Back to Main Menu</button>
-        </div>
-    </div>
-
-    <script>
-        let currentTestMode = 'manual';
-        let testActive = false;
-        
-        function updateModeDisplay() {
-            const mode = document.getElementById('testMode').value;
-            const display = document.getElementById('modeDisplay');
-            const currentModeText = document.getElementById('currentModeText');
-            const modeDescription = document.getElementById('modeDescription');
-            const amplitudeControl = document.getElementById('amplitudeControl');
-            
-            currentTestMode = mode;
-            
-            if (mode === 'manual') {
-                currentModeText.textContent = 'Manual Injection';
-                modeDescription.textContent = 'Adjustable amplitude with manual control';
-                display.className = 'status-panel status-info';
-                amplitudeControl.style.display = 'block';
-            } else if (mode === '200ma') {
-                currentModeText.textContent = '200mA Auto Injection';
-                modeDescription.textContent = 'Automatic injection to 200mA with 2-minute countdown';
-                display.className = 'status-panel status-info';
-                amplitudeControl.style.display = 'none';
-            } else if (mode === 'runtime') {
-                currentModeText.textContent = 'Runtime Mode';
-                modeDescription.textContent = 'Fixed amplitude with 2-minute timer';
-                display.className = 'status-panel status-info';
-                amplitudeControl.style.display = 'none';
-            }
-        }
-        
-        function updateAmplitude(value) {
-            document.getElementById('amplitudeDisplay').textContent = value + '%';
-            if (testActive) {
-                fetch('/set_amplitude?value=' + value)
-                    .then(response => response.text())
-                    .then(data => console.log('Amplitude updated:', value));
-            }
-        }
-        
-        function startTest() {
-            if (currentTestMode === '200ma') {
-                fetch('/api/auto-injection?action=start', {method: 'POST'})
-                    .then(response => response.json())
-                    .then(data => {
-                        if (data.success) {
-                            testActive = true;
-                            document.getElementById('startBtn').style.display = 'none';
-                            document.getElementById('stopBtn').style.display = 'inline-block';
-                            document.getElementById('submitBtn').style.display = 'inline-block';
-                            updateStatus('Test started - 200mA Auto Injection');
-                        }
-                    });
-            } else {
-                fetch('/set_amplitude?state=RUN')
-                    .then(response => response.text())
-                    .then(data => {
-                        testActive = true;
-                        document.getElementById('startBtn').style.display = 'none';
-                        document.getElementById('stopBtn').style.display = 'inline-block';
-                        document.getElementById('submitBtn').style.display = 'inline-block';
-                        updateStatus('Test started - ' + currentTestMode);
-                    });
-            }
-        }
-        
-        function stopTest() {
-            if (currentTestMode === '200ma') {
-                fetch('/api/auto-injection?action=stop', {method: 'POST'})
-                    .then(response => response.json())
-                    .then(data => {
-                        testActive = false;
-                        resetButtons();
-                        updateStatus('Test stopped');
-                    });
-            } else {
-                fetch('/set_amplitude?state=STOP')
-                    .then(response => response.text())
-                    .then(data => {
-                        testActive = false;
-                        resetButtons();
-                        updateStatus('Test stopped');
-                    });
-            }
-        }
-        
-        function resetButtons() {
-            document.getElementById('startBtn').style.display = 'inline-block';
-            document.getElementById('stopBtn').style.display = 'none';
-            document.getElementById('submitBtn').style.display = 'inline-block';
-        }
-        
-        function updateStatus(message) {
-            const display = document.getElementById('modeDisplay');
-            display.className = 'status-panel status-success';
-            document.getElementById('modeDescription').textContent = message;
-        }
-        
-        function showForm() {
-            document.getElementById('dataForm').style.display = 'block';
-        }
-        
-        function submitToCloud(event) {
-            event.preventDefault();
-            
-            const formData = new FormData(document.getElementById('dataForm'));
-            const data = {
-                UPT: formData.get('upt'),
-                NIP: formData.get('nip'),
-                KODE_SUIT: formData.get('kodeSuit'),
-                R: 0,
-                testMode: currentTestMode,
-                voltage: 0,
-                current: 0,
-                resistance: 0,
-                timestamp: new Date().toISOString()
-            };
-            
-            // Get current readings
-            fetch('/status')
-                .then(response => response.json())
-                .then(statusData => {
-                    data.voltage = statusData.voltage;
-                    data.current = statusData.current;
-                    data.resistance = statusData.resistance;
-                    data.R = statusData.resistance;
-
-                    const rField = document.getElementById('hasilR');
-                    if (rField) {
-                        rField.value = statusData.resistance.toFixed(2);
-                    }
-                    
-                    // Submit data
-                    fetch('/api/submit-data', {
-                        method: 'POST',
-                        headers: {'Content-Type': 'application/json'},
-                        body: JSON.stringify(data)
-                    })
-                    .then(response => response.json())
-                    .then(result => {
-                        const status = document.getElementById('submissionStatus');
-                        if (result.success) {
-                            status.className = 'status-panel status-success';
-                            status.textContent = 'Data submitted successfully! Reference ID: ' + result.referenceId;
-                            document.getElementById('dataForm').reset();
-                        } else {
-                            status.className = 'status-panel status-error';
-                            status.textContent = 'Failed to submit data: ' + result.message;
-                        }
-                        status.style.display = 'block';
-                    })
-                    .catch(error => {
-                        const status = document.getElementById('submissionStatus');
-                        status.className = 'status-panel status-error';
-                        status.textContent = 'Error submitting data: ' + error.message;
-                        status.style.display = 'block';
-                    });
-                });
-        }
-        
-        function updateReadings() {
-            fetch('/status')
-                .then(response => response.json())
-                .then(data => {
-                    document.getElementById('voltageValue').textContent = data.voltage.toFixed(2) + ' V';
-                    document.getElementById('currentValue').textContent = data.current.toFixed(2) + ' A';
-                    document.getElementById('resistanceValue').textContent = data.resistance.toFixed(2) + ' Ω';
-
-                    const rField = document.getElementById('hasilR');
-                    if (rField) {
-                        rField.value = data.resistance.toFixed(2);
-                    }
-                });
-        }
-        
-        // Update readings every second
-        updateReadings();
-        setInterval(updateReadings, 1000);
-        updateModeDisplay(); // Initialize display
-    </script>
-</body>
-</html>
-  )";
-  
-  server.send(200, "text/html", html);
-}
-
-void handleNormalInjection() {
-  String html = R"(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>CORE Test - Normal Injection</title>
-    <meta charset='UTF-8'>
-    <meta name='viewport' content='width=device-width, initial-scale=1.0'>
-    <style>
-        body { font-family: Arial; margin: 20px; background: #f0f0f0; }
-        .container { max-width: 600px; margin: 0 auto; background: white; padding: 20px; border-radius: 10px; }
-        .control-panel { background: #f8f9fa; padding: 20px; border-radius: 8px; margin: 20px 0; }
-        .slider-container { margin: 20px 0; }
-        .slider { width: 100%; margin: 10px 0; }
-        .button-group { text-align: center; margin: 20px 0; }
-        .btn { padding: 15px 30px; margin: 10px; border: none; border-radius: 5px; cursor: pointer; font-size: 16px; }
-        .btn-start { background: #28a745; color: white; }
-        .btn-stop { background: #dc3545; color: white; }
-        .btn-back { background: #6c757d; color: white; }
-        .readings { display: grid; grid-template-columns: 1fr 1fr 1fr; gap: 15px; margin: 20px 0; }
-        .reading { background: #e9ecef; padding: 15px; border-radius: 5px; text-align: center; }
-        .value { font-size: 24px; font-weight: bold; color: #495057; }
-        .label { font-size: 14px; color: #6c757d; margin-bottom: 5px; }
-    </style>
-</head>
-<body>
-    <div class='container'>
-        <h1>Normal Injection Mode</h1>
-        <p>Manual injection control with adjustable amplitude</p>
-        
-        <div class='readings'>
-            <div class='reading'>
-                <div class='label'>Voltage</div>
-                <div class='value' id='voltageValue'>0.00 V</div>
-            </div>
-            <div class='reading'>
-                <div class='label'>Current</div>
-                <div class='value' id='currentValue'>0.00 A</div>
-            </div>
-            <div class='reading'>
-                <div class='label'>Resistance</div>
-                <div class='value' id='resistanceValue'>0.00 Ω</div>
-            </div>
-        </div>
-        
-        <div class='control-panel'>
-            <h3>Amplitude Control</h3>
-            <div class='slider-container'>
-                <label for='amplitudeSlider'>Amplitude: <span id='amplitudeDisplay'>0%</span></label>
-                <input type='range' id='amplitudeSlider' class='slider' min='0' max='100' value='0' onchange='updateAmplitude(this.value)'>
-            </div>
-            
-            <div class='button-group'>
-                <button class='btn btn-start' onclick='startInjection()'>Start Injection</button>
-                <button class='btn btn-stop' onclick='stopInjection()'>Stop Injection</button>
-            </div>
-        </div>
-        
-        <div style='text-align: center; margin-top: 30px;'>
-            <button class='btn btn-back' onclick="window.location.href='/'">Back to Main Menu</button>
-        </div>
-    </div>
-
-    <script>
-        function updateAmplitude(value) {
-            document.getElementById('amplitudeDisplay').textContent = value + '%';
-            fetch('/set_amplitude?value=' + value)
-                .then(response => response.text())
-                .then(data => console.log('Amplitude updated:', value));
-        }
-        
-        function startInjection() {
-            fetch('/set_amplitude?state=RUN')
-                .then(response => response.text())
-                .then(data => {
-                    console.log('Injection started');
-                });
-        }
-        
-        function stopInjection() {
-            fetch('/set_amplitude?state=STOP')
-                .then(response => response.text())
-                .then(data => {
-                    console.log('Injection stopped');
-                    document.getElementById('amplitudeSlider').value = 0;
-                    document.getElementById('amplitudeDisplay').textContent = '0%';
-                });
-        }
-        
-        function updateReadings() {
-            fetch('/status')
-                .then(response => response.json())
-                .then(data => {
-                    document.getElementById('voltageValue').textContent = data.voltage.toFixed(2) + ' V';
-                    document.getElementById('currentValue').textContent = data.current.toFixed(2) + ' A';
-                    document.getElementById('resistanceValue').textContent = data.resistance.toFixed(2) + ' Ω';
-                    document.getElementById('amplitudeSlider').value = (data.amplitude * 100).toFixed(0);
-                    document.getElementById('amplitudeDisplay').textContent = (data.amplitude * 100).toFixed(0) + '%';
-                });
-        }
-        
-        // Update readings every second
-        updateReadings();
-        setInterval(updateReadings, 1000);
-    </script>
-</body>
-</html>
-  )";
-  
-  server.send(200, "text/html", html);
-}
-
-void handle200mAInjection() {
-  String html = R"(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>CORE Test - 200mA Injection</title>
-    <meta charset='UTF-8'>
-    <meta name='viewport' content='width=device-width, initial-scale=1.0'>
-    <style>
-        body { font-family: Arial; margin: 20px; background: #f0f0f0; }
-        .container { max-width: 600px; margin: 0 auto; background: white; padding: 20px; border-radius: 10px; }
-        .status-panel { background: #fff3cd; padding: 20px; border-radius: 8px; margin: 20px 0; border: 1px solid #ffeaa7; }
-        .success-panel { background: #d4edda; border: 1px solid #c3e6cb; }
-        .timer-display { font-size: 48px; font-weight: bold; text-align: center; color: #dc3545; margin: 20px 0; }
-        .progress-bar { width: 100%; height: 20px; background: #f8f9fa; border-radius: 10px; overflow: hidden; margin: 20px 0; }
-        .progress-fill { height: 100%; background: #dc3545; transition: width 0.5s ease; }
-        .button-group { text-align: center; margin: 20px 0; }
-        .btn { padding: 15px 30px; margin: 10px; border: none; border-radius: 5px; cursor: pointer; font-size: 16px; }
-        .btn-start { background: #28a745; color: white; }
-        .btn-stop { background: #dc3545; color: white; }
-        .btn-back { background: #6c757d; color: white; }
-        .readings { display: grid; grid-template-columns: 1fr 1fr 1fr; gap: 15px; margin: 20px 0; }
-        .reading { background: #e9ecef; padding: 15px; border-radius: 5px; text-align: center; }
-        .value { font-size: 24px; font-weight: bold; color: #495057; }
-        .label { font-size: 14px; color: #6c757d; margin-bottom: 5px; }
-    </style>
-</head>
-<body>
-    <div class='container'>
-        <h1>200mA Auto Injection</h1>
-        <p>Automatically inject current until 200mA is reached, then start 2-minute countdown</p>
-        
-        <div class='readings'>
-            <div class='reading'>
-                <div class='label'>Voltage</div>
-                <div class='value' id='voltageValue'>0.00 V</div>
-            </div>
-            <div class='reading'>
-                <div class='label'>Current</div>
-                <div class='value' id='currentValue'>0.00 A</div>
-            </div>
-            <div class='reading'>
-                <div class='label'>Resistance</div>
-                <div class='value' id='resistanceValue'>0.00 Ω</div>
-            </div>
-        </div>
-        
-        <div class='status-panel' id='statusPanel'>
-            <h3>Status: <span id='statusText'>Ready to start</span></h3>
-            <p id='statusDescription'>Click start to begin automatic injection to 200mA</p>
-        </div>
-        
-        <div class='timer-display' id='timerDisplay' style='display: none;'>02:00</div>
-        <div class='progress-bar' id='progressBar' style='display: none;'>
-            <div class='progress-fill' id='progressFill' style='width: 100%;'></div>
-        </div>
-        
-        <div class='button-group'>
-            <button class='btn btn-start' id='startBtn' onclick='startAutoInjection()'>Start Auto Injection</button>
-            <button class='btn btn-stop' id='stopBtn' onclick='stopInjection()' style='display: inline-block;'>Stop</button>
-            <button class='btn btn-back' onclick="window.location.href='/'">Back to Main Menu</button>
-        </div>
-    </div>
-
-    <script>
-        let autoInjectionActive = false;
-        let countdownActive = false;
-        let targetTime = 0;
-        let totalDuration = 120000; // 2 minutes in milliseconds
-        
-        function startAutoInjection() {
-            fetch('/api/auto-injection?action=start', {method: 'POST'})
-                .then(response => response.json())
-                .then(data => {
-                    if (data.success) {
-                        autoInjectionActive = true;
-                        document.getElementById('startBtn').style.display = 'none';
-                        document.getElementById('stopBtn').style.display = 'inline-block';
-                        updateStatus('auto_injection', 'Automatically increasing current to 200mA...');
-                    }
-                });
-        }
-        
-        function stopInjection() {
-            fetch('/api/auto-injection?action=stop', {method: 'POST'})
-                .then(response => response.json())
-                .then(data => {
-                    autoInjectionActive = false;
-                    countdownActive = false;
-                    document.getElementById('startBtn').style.display = 'inline-block';
-                    document.getElementById('stopBtn').style.display = 'none';
-                    document.getElementById('timerDisplay').style.display = 'none';
-                    document.getElementById('progressBar').style.display = 'none';
-                    updateStatus('stopped', 'Injection stopped');
-                });
-        }
-        
-        function updateStatus(status, description) {
-            const statusText = document.getElementById('statusText');
-            const statusDescription = document.getElementById('statusDescription');
-            const statusPanel = document.getElementById('statusPanel');
-            
-            statusText.textContent = status;
-            statusDescription.textContent = description;
-            
-            if (status === 'countdown') {
-                statusPanel.className = 'status-panel success-panel';
-            }
-        }
-        
-        function updateReadings() {
-            fetch('/status')
-                .then(response => response.json())
-                .then(data => {
-                    document.getElementById('voltageValue').textContent = data.voltage.toFixed(2) + ' V';
-                    document.getElementById('currentValue').textContent = data.current.toFixed(2) + ' A';
-                    document.getElementById('resistanceValue').textContent = data.resistance.toFixed(2) + ' Ω';
-                    
-                    // Check auto injection status
-                    if (data.autoInjectionActive && !countdownActive) {
-                        updateStatus('injecting', 'Current: ' + data.current.toFixed(2) + ' A (Target: 200mA)');
-                    } else if (data.countdownActive) {
-                        countdownActive = true;
-                        document.getElementById('timerDisplay').style.display = 'block';
-                        document.getElementById('progressBar').style.display = 'block';
-                        updateStatus('countdown', '200mA reached! Countdown in progress...');
-                    }
-                    
-                    // Update countdown if active
-                    if (countdownActive && data.countdownActive) {
-                        const now = Date.now();
-                        const remaining = data.countdownEndTime - now;
-                        
-                        if (remaining > 0) {
-                            const minutes = Math.floor(remaining / 60000);
-                            const seconds = Math.floor((remaining % 60000) / 1000);
-                            document.getElementById('timerDisplay').textContent =
-                                String(minutes).padStart(2, '0') + ':' + String(seconds).padStart(2, '0');
-                            
-                            const progress = (remaining / totalDuration) * 100;
-                            document.getElementById('progressFill').style.width = progress + '%';
-                        }
-                    }
-                });
-        }
-        
-        // Update readings every second
-        updateReadings();
-        setInterval(updateReadings, 1000);
-    </script>
-</body>
-</html>
-  )";
-  
-  server.send(200, "text/html", html);
-}
-
-void handleDataSubmission() {
-  String html = R"(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>CORE Test - Data Submission</title>
-    <meta charset='UTF-8'>
-    <meta name='viewport' content='width=device-width, initial-scale=1.0'>
-    <style>
-        body { font-family: Arial; margin: 20px; background: #f0f0f0; }
-        .container { max-width: 600px; margin: 0 auto; background: white; padding: 20px; border-radius: 10px; }
-        .form-group { margin: 20px 0; }
-        label { display: block; margin-bottom: 5px; font-weight: bold; }
-        input[type='text'] { width: 100%; padding: 10px; border: 1px solid #ddd; border-radius: 5px; box-sizing: border-box; }
-        .btn { padding: 15px 30px; margin: 10px 5px; border: none; border-radius: 5px; cursor: pointer; font-size: 16px; }
-        .btn-submit { background: #28a745; color: white; }
-        .btn-submit:hover { background: #1e7e34; }
-        .btn-back { background: #6c757d; color: white; }
-        .status { padding: 15px; border-radius: 5px; margin: 20px 0; display: none; }
-        .success { background: #d4edda; color: #155724; border: 1px solid #c3e6cb; }
-        .error { background: #f8d7da; color: #721c24; border: 1px solid #f5c6cb; }
-        .info { background: #d1ecf1; color: #0c5460; border: 1px solid #bee5eb; }
-    </style>
-</head>
-<body>
-    <div class='container'>
-        <h1>Data Submission</h1>
-        <p>Submit test results to cloud server</p>
-        
-        <form id='dataForm' onsubmit='submitData(event)'>
-            <div class='form-group'>
-                <label for='upt'>UPT:</label>
-                <input type='text' id='upt' name='upt' required>
-            </div>
-            
-            <div class='form-group'>
-                <label for='nip'>NIP:</label>
-                <input type='text' id='nip' name='nip' required>
-            </div>
-            
-            <div class='form-group'>
-                <label for='kodeSuit'>KODE_SUIT:</label>
-                <input type='text' id='kodeSuit' name='kodeSuit' required>
-            </div>
-
-            <div class='form-group'>
-                <label for='hasilR'>R (hasil uji):</label>
-                <input type='text' id='hasilR' name='hasilR' readonly>
-            </div>
-            
-            <div style='text-align: center; margin: 30px 0;'>
-                <button type='submit' class='btn btn-submit'>Submit Data</button>
-                <button type='button' class='btn btn-back' onclick="window.location.href='/'">Back to Main Menu</button>
-            </div>
-        </form>
-        
-        <div id='submissionStatus' class='status'></div>
-    </div>
-
-    <script>
-        function submitData(event) {
-            event.preventDefault();
-            
-            const formData = new FormData(document.getElementById('dataForm'));
-            const data = {
-                UPT: formData.get('upt'),
-                NIP: formData.get('nip'),
-                KODE_SUIT: formData.get('kodeSuit'),
-                R: 0,
-                voltage: 0,
-                current: 0,
-                resistance: 0,
-                timestamp: new Date().toISOString()
-            };
-            
-            // Get current readings
-            fetch('/status')
-                .then(response => response.json())
-                .then(statusData => {
-                    data.voltage = statusData.voltage;
-                    data.current = statusData.current;
-                    data.resistance = statusData.resistance;
-                    data.R = statusData.resistance;
-
-                    const rField = document.getElementById('hasilR');
-                    if (rField) {
-                        rField.value = statusData.resistance.toFixed(2);
-                    }
-                    
-                    // Submit data
-                    fetch('/api/submit-data', {
-                        method: 'POST',
-                        headers: {'Content-Type': 'application/json'},
-                        body: JSON.stringify(data)
-                    })
-                    .then(response => response.json())
-                    .then(result => {
-                        if (result.success) {
-                            showStatus('Data submitted successfully! Reference ID: ' + result.referenceId, 'success');
-                            document.getElementById('dataForm').reset();
-                        } else {
-                            showStatus('Failed to submit data: ' + result.message, 'error');
-                        }
-                    })
-                    .catch(error => {
-                        showStatus('Error submitting data: ' + error.message, 'error');
-                    });
-                })
-                .catch(error => {
-                    showStatus('Error getting current readings: ' + error.message, 'error');
-                });
-        }
-        
-        function showStatus(message, type) {
-            const status = document.getElementById('submissionStatus');
-            status.textContent = message;
-            status.className = 'status ' + type;
-            status.style.display = 'block';
-        }
-    </script>
-</body>
-</html>
-  )";
-  
-  server.send(200, "text/html", html);
+  request->redirect("/");
+}
+
+void handleInjection(AsyncWebServerRequest* request) {
+  sendWebAsset(request, WEB_INJECTION);
+}
+
+void handleNormalInjection(AsyncWebServerRequest* request) {
+  sendWebAsset(request, WEB_INJECTION_NORMAL);
+}
+
+void handle200mAInjection(AsyncWebServerRequest* request) {
+  sendWebAsset(request, WEB_INJECTION_200MA);
+}
+
+void handleDataSubmission(AsyncWebServerRequest* request) {
+  sendWebAsset(request, WEB_DATA_SUBMISSION);
+}
+
+// Helper JS bersama (connectEvents, awaitJob) untuk semua halaman
+void handleLiveScript(AsyncWebServerRequest* request) {
+  sendWebAsset(request, WEB_LIVE_JS);
 }
 
 void displayWebServerMode() {
@@ -2684,16 +1301,20 @@ void drawFrame() {
 }
 
 // ------------------- Update Nilai -------------------
-void updateValues(float v, float i, float r) {
+void updateValues(const Measurement& m) {
   tft.setTextDatum(TR_DATUM);
   tft.setTextColor(TFT_YELLOW, TFT_BLACK);
   tft.fillRect(X_LABEL + 60, Y_V - 5, 150, 40, TFT_BLACK);
   tft.fillRect(X_LABEL + 60, Y_I - 5, 150, 40, TFT_BLACK);
   tft.fillRect(X_LABEL + 60, Y_R - 5, 150, 40, TFT_BLACK);
 
-  tft.drawFloat(v, 2, X_VALUE, Y_V, 4);
-  tft.drawFloat(i, 2, X_VALUE, Y_I, 4);
-  tft.drawFloat(r, 2, X_VALUE, Y_R, 4);
+  char buf[16];
+  formatMilli(buf, sizeof(buf), m.millivolts, 2);
+  tft.drawString(buf, X_VALUE, Y_V, 4);
+  formatMilli(buf, sizeof(buf), m.milliamps, 2);
+  tft.drawString(buf, X_VALUE, Y_I, 4);
+  formatMilli(buf, sizeof(buf), m.milliohms, 2);
+  tft.drawString(buf, X_VALUE, Y_R, 4);
 }
 
 // ------------------- Update Countdown -------------------
@@ -2854,199 +1475,1665 @@ void executeMenu(MenuItem menu) {
   }
 }
 
-// ------------------- Baca JSY1050 -------------------
-void readJSY1050() {
-  uint8_t result = node.readHoldingRegisters(0x0048, 10);
-  if (result == node.ku8MBSuccess) {
-    voltage = node.getResponseBuffer(0) / 100.0f;
-    currentA = node.getResponseBuffer(1) / 100.0f;
-    resistanceVal = (currentA > 0.01f) ? voltage / currentA : 0.0f;
+// ------------------- UART JSY1050 -------------------
+// Driver UART IDF dengan event queue: RX timeout interrupt menandai idle line
+// sehingga akhir frame terdeteksi hardware, bukan dengan busy-poll Serial.
+bool jsyUartBegin(uint32_t baud) {
+  uart_config_t config;
+  memset(&config, 0, sizeof(config));
+  config.baud_rate = baud;
+  config.data_bits = UART_DATA_8_BITS;
+  config.parity = UART_PARITY_DISABLE;
+  config.stop_bits = UART_STOP_BITS_1;
+  config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+  config.source_clk = UART_SCLK_APB;
+
+  if (uart_driver_install(JSY_UART_NUM, JSY_UART_RX_BUF, 0, JSY_UART_QUEUE, &jsyUartQueue, 0) != ESP_OK) {
+    return false;
   }
+  uart_param_config(JSY_UART_NUM, &config);
+  uart_set_pin(JSY_UART_NUM, TXD_JSY, RXD_JSY, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+  uart_set_rx_timeout(JSY_UART_NUM, JSY_RX_IDLE_CHARS);
+  return true;
 }
 
-// ------------------- Tombol -------------------
-void handleButtons() {
-  keyUp.loop();
-  // keyDown.loop();
+void jsyUartSetBaud(uint32_t baud) {
+  uart_set_baudrate(JSY_UART_NUM, baud);
+}
 
-  if (keyUp.isPressed()) {
-    currentMenu = (MenuItem)((int)currentMenu - 1);
-    if ((int)currentMenu < 0) currentMenu = (MenuItem)(MENU_COUNT - 1);
-    executeMenu(currentMenu);
-  }
+// Kirim request yang sudah disiapkan jsyBus; sisa byte/event transaksi lama dibuang
+void jsyUartSend() {
+  uart_flush_input(JSY_UART_NUM);
+  xQueueReset(jsyUartQueue);
+  uart_write_bytes(JSY_UART_NUM, (const char*)jsyBus.request(), jsyBus.requestLength());
+}
 
-  // if (keyDown.isPressed()) {
-  //   currentMenu = (MenuItem)((int)currentMenu + 1);
-  //   if ((int)currentMenu >= MENU_COUNT) currentMenu = (MenuItem)0;
-  //   executeMenu(currentMenu);
-  // }
+// ------------------- Meter JSY1050 -------------------
+// Meter DUT selalu ada di slot 0; meter referensi opsional di alamat "jsyRefAddr"
+void addJSYMeter(uint8_t slaveId, const char* role, uint8_t weight, uint16_t turnaroundMs) {
+  if (jsyMeterCount >= JSY_MAX_METERS) return;
+  JsyMeter& meter = jsyMeters[jsyMeterCount++];
+  meter.slaveId = slaveId;
+  meter.role = role;
+  meter.slot.enabled = true;
+  meter.slot.weight = weight;
+  meter.slot.turnaroundMs = turnaroundMs;
 }
 
-// ------------------- Rotary Encoder & Serial to Nano -------------------
-void handleRotaryEncoder() {
-  // Hanya izinkan pengaturan amplitude saat RUN atau RUN TIME
-  if (systemState != RUN) return;
+void loadJSYMeters() {
+  Preferences preferences;
+  preferences.begin("core-settings", true);
+  uint8_t refAddr = preferences.getUChar("jsyRefAddr", 0);
+  preferences.end();
 
-  int currentCLK = digitalRead(CLK_PIN);
+  addJSYMeter(JSY_DUT_SLAVE_ID, "dut", JSY_DUT_WEIGHT, JSY_TURNAROUND_MS);
+  if (refAddr != 0 && refAddr != JSY_DUT_SLAVE_ID) {
+    addJSYMeter(refAddr, "ref", JSY_REF_WEIGHT, JSY_TURNAROUND_MS);
+  }
+}
 
-  if (currentCLK != lastCLK && currentCLK == LOW) {
-    if (digitalRead(DT_PIN) == HIGH) {
-      ampValue += stepSize;        // putar kanan → naik
-    } else {
-      ampValue -= stepSize;        // putar kiri → turun
+// ------------------- Baca JSY1050 -------------------
+void startJSY1050Read(uint8_t slaveId, const JsyReadSpan& span) {
+  if (jsyBus.beginReadHolding(slaveId, span.start, span.count, micros())) {
+    jsyUartSend();
+  }
+}
+
+// Tidur di event queue UART sampai frame selesai atau timeout; CPU bebas untuk task lain
+ModbusStatus awaitJSY1050() {
+  if (!jsyBus.busy()) return MB_IDLE;
+
+  uint8_t buf[64];
+  for (;;) {
+    uart_event_t event;
+    if (xQueueReceive(jsyUartQueue, &event, pdMS_TO_TICKS(10)) == pdTRUE) {
+      if (event.type == UART_DATA) {
+        size_t pending = event.size;
+        while (pending > 0) {
+          int n = uart_read_bytes(JSY_UART_NUM, buf, pending < sizeof(buf) ? pending : sizeof(buf), 0);
+          if (n <= 0) break;
+          jsyBus.feed(buf, n, micros());
+          pending -= n;
+        }
+        if (event.timeout_flag) jsyBus.endOfFrame(micros());
+      } else if (event.type == UART_FIFO_OVF || event.type == UART_BUFFER_FULL) {
+        uart_flush_input(JSY_UART_NUM);
+        xQueueReset(jsyUartQueue);
+      }
     }
 
-    ampValue = constrain(ampValue, 0.0, 1.0);
-    updateDAC();
+    ModbusStatus result = jsyBus.poll(micros());
+    if (result != MB_PENDING) return result;
   }
+}
 
-  lastCLK = currentCLK;
+// Salin field yang tercakup span dari response buffer ke sample
+void extractJSYFields(const JsyReadSpan& span, JsySample& sample) {
+  int offset;
+  if ((offset = jsyFieldOffset(span, JSY_FIELD_VOLTAGE)) >= 0) sample.voltageRaw = jsyBus.responseRegister(offset);
+  if ((offset = jsyFieldOffset(span, JSY_FIELD_CURRENT)) >= 0) sample.currentRaw = jsyBus.responseRegister(offset);
+  if ((offset = jsyFieldOffset(span, JSY_FIELD_POWER)) >= 0) sample.powerRaw = jsyBus.responseRegister(offset);
+  if ((offset = jsyFieldOffset(span, JSY_FIELD_ENERGY)) >= 0) {
+    sample.energyRaw = ((uint32_t)jsyBus.responseRegister(offset) << 16) | jsyBus.responseRegister(offset + 1);
+  }
+}
 
-  // -------- Tombol tekan (reset amplitude) --------
-  if (digitalRead(SW_PIN) == LOW) {
-    ampValue = 0.0;
-    updateDAC();
-    delay(200);
+// Satu span dengan retry; backoff tidak pernah melebihi JSY_RETRY_BACKOFF_MAX_MS
+ModbusStatus readJSY1050Span(JsyMeter& meter, const JsyReadSpan& span) {
+  uint32_t backoff = JSY_RETRY_BACKOFF_MS;
+  for (uint8_t attempt = 0;; attempt++) {
+    startJSY1050Read(meter.slaveId, span);
+    ModbusStatus result = awaitJSY1050();
+    meter.stats.record(result, jsyBus.latencyUs());
+    // Exception = meter menolak request, mengulang tidak akan membantu
+    if (result == MB_SUCCESS || result == MB_EXCEPTION || attempt >= JSY_MAX_RETRIES) return result;
+
+    meter.stats.retries++;
+    vTaskDelay(pdMS_TO_TICKS(backoff));
+    backoff = backoff * 2 > JSY_RETRY_BACKOFF_MAX_MS ? JSY_RETRY_BACKOFF_MAX_MS : backoff * 2;
   }
 }
 
-void updateDAC() {
-  int dacValue = constrain(ampValue * 255, 0, 255);  // Konversi ke 0-255
-  dacWrite(DAC_PIN, dacValue);
-  Serial.print("DAC = ");
-  Serial.println(dacValue);
+// Jalankan semua span di plan; sample valid hanya jika semua transaksi sukses
+bool readJSY1050Sample(JsyMeter& meter, const JsyReadPlan& plan, JsySample& sample) {
+  memset(&sample, 0, sizeof(sample));
+  for (uint8_t i = 0; i < plan.spanCount; i++) {
+    if (readJSY1050Span(meter, plan.spans[i]) != MB_SUCCESS) return false;
+    extractJSYFields(plan.spans[i], sample);
+    if (i + 1 < plan.spanCount) vTaskDelay(pdMS_TO_TICKS(MODBUS_FRAME_GAP_MS));
+  }
+  sample.timestampMs = millis();
+  sample.features = plan.features;
+  return true;
 }
 
-void handleWiFiSettings() {
-  if (server.method() == HTTP_POST) {
-    String ssid = server.arg("ssid");
-    String password = server.arg("password");
-    String cloudServer = server.arg("cloudServer");
-    
+// ------------------- Negosiasi Baud JSY1050 -------------------
+// Blocking, hanya dipanggil dari setup() sebelum task akuisisi jalan.
+// Semua meter berbagi bus, jadi baud hanya dinaikkan jika semuanya ikut.
+bool probeJSY1050(uint8_t slaveId, uint8_t attempts) {
+  JsyReadSpan vi = jsyBuildReadPlan(JSY_FEATURE_VI).spans[0];
+  for (uint8_t i = 0; i < attempts; i++) {
+    startJSY1050Read(slaveId, vi);
+    if (awaitJSY1050() == MB_SUCCESS) return true;
+    delay(20);
+  }
+  return false;
+}
+
+bool probeAllJSY1050(uint32_t baud, uint8_t attempts) {
+  jsyUartSetBaud(baud);
+  delay(MODBUS_FRAME_GAP_MS);
+  for (uint8_t m = 0; m < jsyMeterCount; m++) {
+    if (!probeJSY1050(jsyMeters[m].slaveId, attempts)) return false;
+    delay(MODBUS_FRAME_GAP_MS);
+  }
+  return true;
+}
+
+bool writeJSY1050BaudCode(uint8_t slaveId, uint8_t code) {
+  JsyReadSpan config = { JSY_REG_COMM_CONFIG, 1 };
+  startJSY1050Read(slaveId, config);
+  if (awaitJSY1050() != MB_SUCCESS) return false;
+
+  // Alamat slave (high byte) dipertahankan, hanya kode baud yang diganti
+  uint16_t value = (jsyBus.responseRegister(0) & 0xFF00) | code;
+  if (!jsyBus.beginWriteMultiple(slaveId, JSY_REG_COMM_CONFIG, 1, &value, micros())) return false;
+  jsyUartSend();
+  return awaitJSY1050() == MB_SUCCESS;
+}
+
+uint8_t jsyBaudCodeFor(uint32_t baud) {
+  for (uint8_t i = 0; i < JSY_BAUD_CODE_COUNT; i++) {
+    if (JSY_BAUD_CODES[i].baud == baud) return JSY_BAUD_CODES[i].code;
+  }
+  return 0;
+}
+
+void negotiateJSY1050Baud() {
+  Preferences preferences;
+  preferences.begin("core-settings", false);
+  uint32_t stored = preferences.getUInt("jsyBaud", JSY_DEFAULT_BAUD);
+
+  // 1. Cari baud bus saat ini: coba yang tersimpan dulu, lalu semua kandidat
+  uint32_t current = 0;
+  if (probeAllJSY1050(stored, 3)) {
+    current = stored;
+  } else {
+    for (uint8_t i = 0; i < JSY_BAUD_CODE_COUNT && current == 0; i++) {
+      if (JSY_BAUD_CODES[i].baud != stored && probeAllJSY1050(JSY_BAUD_CODES[i].baud, 2)) {
+        current = JSY_BAUD_CODES[i].baud;
+      }
+    }
+  }
+
+  if (current == 0) {
+    Serial.println("⚠️ JSY1050 tidak merespon, tetap di 9600 baud");
+    jsyUartSetBaud(JSY_DEFAULT_BAUD);
+    preferences.end();
+    return;
+  }
+
+  // 2. Naikkan ke baud tercepat yang masih terverifikasi di semua meter
+  for (uint8_t i = 0; i < JSY_BAUD_CODE_COUNT; i++) {
+    const JsyBaudCode& candidate = JSY_BAUD_CODES[i];
+    if (candidate.baud <= current) break;
+
+    Serial.print("JSY1050: mencoba ");
+    Serial.print(candidate.baud);
+    Serial.println(" baud...");
+    jsyUartSetBaud(current);
+    bool written = true;
+    for (uint8_t m = 0; m < jsyMeterCount && written; m++) {
+      written = writeJSY1050BaudCode(jsyMeters[m].slaveId, candidate.code);
+    }
+    delay(50);  // beri waktu meter menerapkan baud baru
+
+    if (written && probeAllJSY1050(candidate.baud, 3)) {
+      current = candidate.baud;
+      break;
+    }
+
+    // Gagal: kembalikan meter yang sudah pindah ke baud lama
+    jsyUartSetBaud(candidate.baud);
+    for (uint8_t m = 0; m < jsyMeterCount; m++) {
+      writeJSY1050BaudCode(jsyMeters[m].slaveId, jsyBaudCodeFor(current));
+    }
+    delay(50);
+    if (!probeAllJSY1050(current, 3)) {
+      Serial.println("⚠️ JSY1050 hilang setelah ganti baud");
+    }
+  }
+
+  jsyUartSetBaud(current);
+  jsyBaudRate = current;
+  if (current != stored) preferences.putUInt("jsyBaud", current);
+  preferences.end();
+
+  Serial.print("JSY1050 link: ");
+  Serial.print(current);
+  Serial.print(" baud, ");
+  Serial.print(jsyMeterCount);
+  Serial.println(" meter");
+}
+
+// ------------------- Task Akuisisi -------------------
+// Producer tunggal untuk semua meter: scheduler memilih meter berikutnya,
+// tiap meter punya ring buffer sendiri. Tidak terpengaruh web server / TFT.
+void acquisitionTask(void* param) {
+  JsyReadPlan plan = jsyBuildReadPlan(jsyFeatureMask.load());
+  MeterSlot slots[JSY_MAX_METERS];
+  for (uint8_t m = 0; m < jsyMeterCount; m++) slots[m] = jsyMeters[m].slot;
+
+  for (;;) {
+    uint8_t features = jsyFeatureMask.load();
+    if (features != plan.features) plan = jsyBuildReadPlan(features);
+
+    uint32_t wait = 0;
+    int8_t next = meterSchedulerNext(slots, jsyMeterCount, millis(), sampleIntervalMs.load(), &wait);
+    if (next >= 0) {
+      JsyMeter& meter = jsyMeters[next];
+      JsySample sample;
+      if (readJSY1050Sample(meter, plan, sample)) {
+        meter.samples.push(sample);
+      }
+      meterSchedulerMarkPolled(slots[next], millis());
+      wait = 0;
+    }
+
+    // Jeda antar frame selalu dijaga; notifikasi dari updateSamplingRate() membangunkan lebih awal
+    if (wait < MODBUS_FRAME_GAP_MS) wait = MODBUS_FRAME_GAP_MS;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
+  }
+}
+
+uint32_t selectSampleInterval() {
+  if (autoInjectionMode || countdownActive || systemState == RUN) return SAMPLE_INTERVAL_FAST_MS;
+  if (systemState == STOPPED) return SAMPLE_INTERVAL_IDLE_MS;
+  return READ_INTERVAL;
+}
+
+// Dipanggil dari loop(); jika interval mengecil, task langsung dibangunkan
+void updateSamplingRate() {
+  uint32_t next = selectSampleInterval();
+  uint32_t prev = sampleIntervalMs.exchange(next);
+  if (next < prev && acquisitionTaskHandle != NULL) {
+    xTaskNotifyGive(acquisitionTaskHandle);
+  }
+}
+
+// Consumer (controlTask): ambil semua sample yang tertunda per meter. Meter DUT
+// menjadi V/I/R aktif; return true jika ada sample DUT baru.
+bool drainJSYSamples() {
+  bool updated = false;
+  for (uint8_t m = 0; m < jsyMeterCount; m++) {
+    JsyMeter& meter = jsyMeters[m];
+    JsySample sample;
+    while (meter.samples.pop(sample)) {
+      portENTER_CRITICAL(&readingMux);
+      meter.latest = sample;
+      portEXIT_CRITICAL(&readingMux);
+      if (m == JSY_DUT_METER) {
+        Measurement reading = measurementFromRawQ8(voltageFilter.updateQ8(sample.voltageRaw),
+                                                   currentFilter.updateQ8(sample.currentRaw), sample.timestampMs);
+        portENTER_CRITICAL(&readingMux);
+        dutReading = reading;
+        portEXIT_CRITICAL(&readingMux);
+        updated = true;
+      }
+    }
+  }
+  return updated;
+}
+
+// Umur sample terakhir yang sudah di-drain; besar = link meter macet
+uint32_t sampleAgeMs() {
+  uint32_t timestampMs = readingSnapshot().timestampMs;
+  if (timestampMs == 0) return UINT32_MAX;
+  return millis() - timestampMs;
+}
+
+Measurement readingSnapshot() {
+  portENTER_CRITICAL(&readingMux);
+  Measurement reading = dutReading;
+  portEXIT_CRITICAL(&readingMux);
+  return reading;
+}
+
+String linkStatsJson(const ModbusLinkStats& stats) {
+  String json = "{";
+  json += "\"transactions\":" + String(stats.transactions()) + ",";
+  json += "\"success\":" + String(stats.success) + ",";
+  json += "\"timeout\":" + String(stats.timeout) + ",";
+  json += "\"crcError\":" + String(stats.crcError) + ",";
+  json += "\"exception\":" + String(stats.exception) + ",";
+  json += "\"badFrame\":" + String(stats.badFrame) + ",";
+  json += "\"retries\":" + String(stats.retries) + ",";
+  json += "\"lastLatencyUs\":" + String(stats.lastLatencyUs) + ",";
+  json += "\"maxLatencyUs\":" + String(stats.maxLatencyUs) + ",";
+
+  json += "\"latencyHistogram\":[";
+  for (uint8_t i = 0; i < MODBUS_LATENCY_BUCKETS; i++) {
+    if (i > 0) json += ",";
+    json += "{\"leMs\":";
+    json += (i < MODBUS_LATENCY_BUCKETS - 1) ? String(MODBUS_LATENCY_EDGES_MS[i]) : String("null");
+    json += ",\"count\":" + String(stats.latencyHistogram[i]) + "}";
+  }
+  json += "]}";
+  return json;
+}
+
+void handleDiagnostics(AsyncWebServerRequest* request) {
+  String json = "{";
+  json += "\"baud\":" + String(jsyBaudRate) + ",";
+  json += "\"meters\":[";
+  for (uint8_t m = 0; m < jsyMeterCount; m++) {
+    const JsyMeter& meter = jsyMeters[m];
+    if (m > 0) json += ",";
+    json += "{\"slaveId\":" + String(meter.slaveId) + ",";
+    json += "\"role\":\"" + String(meter.role) + "\",";
+    json += "\"weight\":" + String(meter.slot.weight) + ",";
+    json += "\"samplesDropped\":" + String(meter.samples.dropped()) + ",";
+    json += "\"link\":" + linkStatsJson(meter.stats) + "}";
+  }
+  json += "],";
+  json += "\"sampleIntervalMs\":" + String(sampleIntervalMs.load()) + ",";
+  json += "\"sampleAgeMs\":" + String(sampleAgeMs()) + ",";
+  json += "\"stale\":" + String(sampleAgeMs() > JSY_STALE_LIMIT_MS ? "true" : "false") + ",";
+  json += "\"control\":" + controlTimingJson() + ",";
+  json += "\"model\":" + plantModelJson();
+  json += "}";
+
+  request->send(200, "application/json", json);
+}
+
+// ------------------- Loop Kontrol -------------------
+// Dipanggil dari task esp_timer (dibackup hardware timer) tiap CONTROL_PERIOD_MS
+void controlTimerCallback(void* arg) {
+  xTaskNotifyGive(controlTaskHandle);
+}
+
+// Task prioritas tinggi: drain sample lalu satu langkah PID per tick timer.
+// Tidak bergantung pada loop(), jadi handler web yang blocking tidak
+// menggeser periode kontrol.
+void controlTask(void* param) {
+  int64_t lastTickUs = 0;
+  const uint32_t nominalUs = CONTROL_PERIOD_MS * 1000UL;
+
+  for (;;) {
+    uint32_t pending = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    int64_t nowUs = esp_timer_get_time();
+
+    float dt = CONTROL_PERIOD_MS / 1000.0f;
+    if (lastTickUs != 0) {
+      uint32_t periodUs = (uint32_t)(nowUs - lastTickUs);
+      uint32_t jitterUs = periodUs > nominalUs ? periodUs - nominalUs : nominalUs - periodUs;
+      controlTiming.ticks++;
+      if (pending > 1) controlTiming.overruns += pending - 1;
+      if (periodUs < controlTiming.minPeriodUs) controlTiming.minPeriodUs = periodUs;
+      if (periodUs > controlTiming.maxPeriodUs) controlTiming.maxPeriodUs = periodUs;
+      if (jitterUs > controlTiming.maxJitterUs) controlTiming.maxJitterUs = jitterUs;
+      controlTiming.sumJitterUs += jitterUs;
+      // dt dibatasi supaya tick yang terlewat tidak membuat integrator melompat
+      if (periodUs < 4 * nominalUs) dt = periodUs / 1000000.0f;
+    }
+    lastTickUs = nowUs;
+
+    bool fresh = drainJSYSamples();
+
+    xSemaphoreTake(controlMutex, portMAX_DELAY);
+    if (planRunner.status() == PLAN_RUNNING) {
+      if (fresh && planRecording) {
+        planSamples++;
+        planSumMv += dutReading.millivolts;
+        planSumMa += dutReading.milliamps;
+      }
+      planRunner.poll(millis(), planHooks);
+    }
+    // Saat output dipotong slew limit, DAC berubah tiap tick dan sample
+    // (tertinggal satu periode akuisisi) tidak lagi cocok dengan ampValue
+    bool driveSettled = sweep.active || (autoInjectionMode && !currentController.slewLimited());
+    if (fresh && driveSettled) {
+      plantModel.update(dutReading.millivolts, dutReading.milliamps, ampValue, MEASUREMENT_MIN_CURRENT_MA);
+    }
+    // Jangan bertindak atas arus basi: tahan amplitude sampai sample segar datang
+    uint8_t modeFlags = 0;
+    if (autoInjectionMode && sampleAgeMs() <= JSY_STALE_LIMIT_MS) {
+      if (fresh) calibrationObserve();
+      runCurrentControl(dt, fresh);
+    } else if (autoInjectionMode) {
+      modeFlags = TRACE_FLAG_STALE_HOLD;
+    } else if (sweep.active) {
+      if (fresh) runSweepStep();
+      modeFlags = TRACE_FLAG_SWEEP;
+    } else {
+      modeFlags = TRACE_FLAG_MANUAL;
+    }
+    recordControlTrace(fresh, modeFlags);
+    xSemaphoreGive(controlMutex);
+  }
+}
+
+// Satu langkah PID arus; dipanggil dengan controlMutex dipegang.
+// fresh = ada sample DUT baru sejak langkah sebelumnya.
+void runCurrentControl(float dt, bool fresh) {
+  int32_t currentMA = dutReading.milliamps;
+  int32_t targetMA = currentRamp.toMa;
+  uint32_t rampElapsedMs = millis() - currentRamp.startMs;
+  bool rampDone = rampElapsedMs >= currentRamp.durationMs;
+  int32_t setpointMA = rampSetpoint(rampProfile, currentRamp.fromMa, currentRamp.toMa, rampElapsedMs,
+                                    currentRamp.durationMs);
+  controlSetpointMa = setpointMA;
+  // Feed-forward untuk setpoint yang sama dihitung juga dengan sumber langkah
+  // sebelumnya; selisihnya (bukan karena setpoint bergerak) diserap integrator
+  float feedForward = feedForwardAmp(plantModel, currentRamp.feedForward, setpointMA);
+  float previousForward = feedForwardAmp(lastFeedForward.model, lastFeedForward.calib, setpointMA);
+  currentController.shiftFeedForward(feedForward - previousForward);
+  lastFeedForward.model = plantModel;
+  lastFeedForward.calib = currentRamp.feedForward;
+
+  // Settling dinilai atas sample baru setelah ramp selesai: rata-rata window
+  // dalam ±5mA dan varians kecil
+  if (rampDone && fresh) settlingDetector.update(currentMA);
+  if (!targetReached && settlingDetector.settled(targetMA)) {
+    targetReached = true;
+    // Serial bisa blocking; dicetak loop() lewat reportSettled()
+    settleReport.pending = true;
+    settleReport.targetMa = targetMA;
+    settleReport.meanMa = settlingDetector.mean();
+    settleReport.varianceMa2 = settlingDetector.variance();
+    settleReport.amp = ampValue;
+  }
+
+  float previous = ampValue;
+  ampValue = currentController.step(setpointMA, currentMA, dt, feedForward);
+  if (ampValue != previous) {
+    applyDAC();
+  }
+}
+
+// Feed-forward: model plant jika sudah konvergen, jika belum tabel kalibrasi
+// (bila tabel mencakup target ramp)
+float feedForwardAmp(const PlantEstimator& model, bool calib, int32_t setpointMa) {
+  float modelAmp = model.predictAmp(setpointMa);
+  if (modelAmp >= 0) return modelAmp;
+  if (!calib) return 0.0f;
+  int16_t code = calibPredictCode(calibTable, setpointMa);
+  return code < 0 ? 0.0f : code / 255.0f;
+}
+
+// Satu record trace per tick controlTask, apa pun modenya (controlMutex
+// dipegang). Di luar injeksi setpoint/error 0; saat stale hold setpoint
+// langkah terakhir tetap dicatat.
+void recordControlTrace(bool fresh, uint8_t modeFlags) {
+  bool injecting = autoInjectionMode;
+  int32_t setpointMA = injecting ? controlSetpointMa : 0;
+  int32_t currentMA = dutReading.milliamps;
+  bool rampDone = injecting && millis() - currentRamp.startMs >= currentRamp.durationMs;
+
+  ControlTraceRecord rec;
+  uint32_t ageMs = millis() - dutReading.timestampMs;
+  rec.timestampMs = millis();
+  rec.setpointMa = constrain(setpointMA, INT16_MIN, INT16_MAX);
+  rec.measuredMa = constrain(currentMA, INT16_MIN, INT16_MAX);
+  rec.errorMa = injecting ? constrain(setpointMA - currentMA, INT16_MIN, INT16_MAX) : 0;
+  rec.dacLevel = ditherLevelFromAmp(ampValue);
+  rec.integralQ12 = constrain(currentController.integral() * 4096.0f, INT16_MIN, INT16_MAX);
+  rec.flags = modeFlags | (fresh ? TRACE_FLAG_FRESH : 0) | (rampDone ? TRACE_FLAG_RAMP_DONE : 0) |
+              (injecting && targetReached ? TRACE_FLAG_TARGET_REACHED : 0) |
+              (injecting && currentRamp.feedForward ? TRACE_FLAG_FEED_FORWARD : 0);
+  rec.sampleAgeMs = ageMs > 255 ? 255 : ageMs;
+  controlTrace.record(rec);
+}
+
+// GET ?since=<seq>&limit=<n>&format=bin|json
+// bin: header {uint32 firstSeq, uint16 count, uint16 recordSize} lalu record
+// ControlTraceRecord little-endian. json: baris array ringkas sesuai "fields".
+void handleTrace(AsyncWebServerRequest* request) {
+  uint32_t since = request->hasArg("since") ? strtoul(request->arg("since").c_str(), NULL, 10) : 0;
+  uint32_t limit = request->hasArg("limit") ? request->arg("limit").toInt() : TRACE_CAPACITY;
+  bool binary = request->arg("format") == "bin";
+  if (!binary && limit > 128) limit = 128;  // batasi ukuran String JSON
+  if (limit > TRACE_CAPACITY) limit = TRACE_CAPACITY;
+
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  uint32_t next = controlTrace.next();
+  uint32_t first = since < controlTrace.oldest() ? controlTrace.oldest() : since;
+  if (first > next) first = next;
+  uint16_t count = next - first > limit ? limit : next - first;
+  for (uint16_t i = 0; i < count; i++) controlTrace.read(first + i, traceSnapshot[i]);
+  xSemaphoreGive(controlMutex);
+
+  if (binary) {
+    uint8_t header[8];
+    uint16_t recordSize = sizeof(ControlTraceRecord);
+    memcpy(header, &first, 4);
+    memcpy(header + 4, &count, 2);
+    memcpy(header + 6, &recordSize, 2);
+    // Stream menyalin isi, jadi traceSnapshot aman dipakai request berikutnya
+    // sebelum respons ini selesai terkirim
+    AsyncResponseStream* response = request->beginResponseStream("application/octet-stream");
+    response->write(header, sizeof(header));
+    response->write((const uint8_t*)traceSnapshot, (size_t)count * recordSize);
+    request->send(response);
+    return;
+  }
+
+  String json = "{";
+  json += "\"first\":" + String(first) + ",";
+  json += "\"next\":" + String(next) + ",";
+  json += "\"fields\":[\"t\",\"sp\",\"mA\",\"err\",\"dac\",\"iq12\",\"flags\",\"age\"],";
+  json += "\"rows\":[";
+  for (uint16_t i = 0; i < count; i++) {
+    const ControlTraceRecord& r = traceSnapshot[i];
+    if (i > 0) json += ",";
+    json += "[" + String(r.timestampMs) + "," + String(r.setpointMa) + "," + String(r.measuredMa) + "," +
+            String(r.errorMa) + "," + String(r.dacLevel) + "," + String(r.integralQ12) + "," + String(r.flags) +
+            "," + String(r.sampleAgeMs) + "]";
+  }
+  json += "]}";
+  request->send(200, "application/json", json);
+}
+
+String plantModelJson() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  PlantEstimator model = plantModel;
+  xSemaphoreGive(controlMutex);
+
+  String json = "{";
+  json += "\"ready\":" + String(model.ready() ? "true" : "false") + ",";
+  json += "\"resistanceOhm\":" + String(model.resistanceOhm(), 2) + ",";
+  json += "\"driveMvPerAmp\":" + String(model.driveMvPerAmp(), 1) + ",";
+  json += "\"predictedAmp\":" + String(model.predictAmp(targetCurrentMa), 4);
+  json += "}";
+  return json;
+}
+
+String controlTimingJson() {
+  uint32_t ticks = controlTiming.ticks;
+  String json = "{";
+  json += "\"periodMs\":" + String(CONTROL_PERIOD_MS) + ",";
+  json += "\"ticks\":" + String(ticks) + ",";
+  json += "\"overruns\":" + String(controlTiming.overruns) + ",";
+  json += "\"minPeriodUs\":" + String(ticks ? controlTiming.minPeriodUs : 0) + ",";
+  json += "\"maxPeriodUs\":" + String(controlTiming.maxPeriodUs) + ",";
+  json += "\"maxJitterUs\":" + String(controlTiming.maxJitterUs) + ",";
+  json += "\"meanJitterUs\":" + String(ticks ? (uint32_t)(controlTiming.sumJitterUs / ticks) : 0);
+  json += "}";
+  return json;
+}
+
+// ------------------- Setting Filter -------------------
+FilterConfig loadFilterConfig(Preferences& preferences, const char* prefix, const FilterConfig& defaults) {
+  FilterConfig config;
+  String p(prefix);
+  config.medianSize = preferences.getUChar((p + "Med").c_str(), defaults.medianSize);
+  config.emaShift = preferences.getUChar((p + "Ema").c_str(), defaults.emaShift);
+  config.outlierThreshold = preferences.getInt((p + "Out").c_str(), defaults.outlierThreshold);
+  config.outlierRelock = preferences.getUChar((p + "Rel").c_str(), defaults.outlierRelock);
+  return config;
+}
+
+void saveFilterConfig(Preferences& preferences, const char* prefix, const FilterConfig& config) {
+  String p(prefix);
+  preferences.putUChar((p + "Med").c_str(), config.medianSize);
+  preferences.putUChar((p + "Ema").c_str(), config.emaShift);
+  preferences.putInt((p + "Out").c_str(), config.outlierThreshold);
+  preferences.putUChar((p + "Rel").c_str(), config.outlierRelock);
+}
+
+// Dari loop() lewat persistSettings()
+void saveFilterSettings() {
+  Preferences preferences;
+  preferences.begin("core-settings", false);
+  saveFilterConfig(preferences, "fltV", voltageFilter.config());
+  saveFilterConfig(preferences, "fltI", currentFilter.config());
+  preferences.end();
+}
+
+void loadFilterSettings() {
+  Preferences preferences;
+  preferences.begin("core-settings", true);
+  voltageFilter.configure(loadFilterConfig(preferences, "fltV", DEFAULT_VOLTAGE_FILTER));
+  currentFilter.configure(loadFilterConfig(preferences, "fltI", DEFAULT_CURRENT_FILTER));
+  preferences.end();
+}
+
+String filterConfigJson(const FilterConfig& config) {
+  return "{\"median\":" + String(config.medianSize) +
+         ",\"emaShift\":" + String(config.emaShift) +
+         ",\"outlier\":" + String(config.outlierThreshold) +
+         ",\"relock\":" + String(config.outlierRelock) + "}";
+}
+
+// GET: konfigurasi aktif. POST channel=voltage|current&median=&emaShift=&outlier=&relock=
+void handleFilterSettings(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    String channel = request->arg("channel");
+    MeasurementFilter* filter = channel == "voltage" ? &voltageFilter : (channel == "current" ? &currentFilter : NULL);
+    if (filter == NULL) {
+      request->send(400, "application/json", "{\"success\":false,\"message\":\"channel must be voltage or current\"}");
+      return;
+    }
+
+    FilterConfig config = filter->config();
+    if (request->hasArg("median")) config.medianSize = request->arg("median").toInt();
+    if (request->hasArg("emaShift")) config.emaShift = request->arg("emaShift").toInt();
+    if (request->hasArg("outlier")) config.outlierThreshold = request->arg("outlier").toInt();
+    if (request->hasArg("relock")) config.outlierRelock = request->arg("relock").toInt();
+    filter->configure(config);
+    filterSavePending = true;
+  }
+
+  String json = "{\"voltage\":" + filterConfigJson(voltageFilter.config()) +
+                ",\"current\":" + filterConfigJson(currentFilter.config()) + "}";
+  request->send(200, "application/json", json);
+}
+
+// ------------------- Setting Kontroler Arus -------------------
+void loadControllerSettings() {
+  Preferences preferences;
+  preferences.begin("core-settings", true);
+  PidGains gains = currentController.gains();
+  gains.kp = preferences.getFloat("pidKp", gains.kp);
+  gains.ki = preferences.getFloat("pidKi", gains.ki);
+  gains.kd = preferences.getFloat("pidKd", gains.kd);
+  gains.kff = preferences.getFloat("pidKff", gains.kff);
+  gains.maxSlewPerSec = preferences.getFloat("pidSlew", gains.maxSlewPerSec);
+  targetCurrentMa = preferences.getInt("targetMa", targetCurrentMa);
+  uint8_t shape = preferences.getUChar("rampShape", RAMP_SCURVE);
+  rampMinDurationMs = preferences.getUInt("rampMs", rampMinDurationMs);
+  rampMaxSlewMaPerSec = preferences.getUInt("rampSlew", rampMaxSlewMaPerSec);
+  settleWindow = preferences.getUChar("settleN", settleWindow);
+  settleMaxVarianceMa2 = preferences.getInt("settleVar", settleMaxVarianceMa2);
+  preferences.end();
+  currentController.configure(gains);
+  settlingDetector.configure(settleWindow, CURRENT_TOLERANCE_MA, settleMaxVarianceMa2);
+  rampBuildProfile(rampProfile, shape < RAMP_SHAPE_COUNT ? (RampShape)shape : RAMP_SCURVE);
+}
+
+// Dari loop() lewat persistSettings()
+void saveControllerSettings() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  PidGains gains = currentController.gains();
+  RampShape shape = rampProfile.shape;
+  xSemaphoreGive(controlMutex);
+
+  Preferences preferences;
+  preferences.begin("core-settings", false);
+  preferences.putFloat("pidKp", gains.kp);
+  preferences.putFloat("pidKi", gains.ki);
+  preferences.putFloat("pidKd", gains.kd);
+  preferences.putFloat("pidKff", gains.kff);
+  preferences.putFloat("pidSlew", gains.maxSlewPerSec);
+  preferences.putInt("targetMa", targetCurrentMa);
+  preferences.putUChar("rampShape", shape);
+  preferences.putUInt("rampMs", rampMinDurationMs);
+  preferences.putUInt("rampSlew", rampMaxSlewMaPerSec);
+  preferences.putUChar("settleN", settleWindow);
+  preferences.putInt("settleVar", settleMaxVarianceMa2);
+  preferences.end();
+}
+
+// Argumen angka opsional: true jika tidak ada (out tidak diubah) atau valid
+// dalam [min, max]; false jika kosong, bukan angka, atau di luar rentang.
+bool argFloatInRange(AsyncWebServerRequest* request, const char* name, float min, float max, float& out) {
+  if (!request->hasArg(name)) return true;
+  String text = request->arg(name);
+  char* end;
+  float value = strtof(text.c_str(), &end);
+  if (text.length() == 0 || *end != '\0' || !(value >= min && value <= max)) return false;
+  out = value;
+  return true;
+}
+
+bool argIntInRange(AsyncWebServerRequest* request, const char* name, long min, long max, long& out) {
+  if (!request->hasArg(name)) return true;
+  String text = request->arg(name);
+  char* end;
+  long value = strtol(text.c_str(), &end, 10);
+  if (text.length() == 0 || *end != '\0' || value < min || value > max) return false;
+  out = value;
+  return true;
+}
+
+// GET: gain, target & ramp aktif.
+// POST target=&kp=&ki=&kd=&kff=&slew=&ramp=&rampMs=&rampSlew=&settleN=&settleVar= (disimpan ke NVS).
+// Semua field divalidasi dulu; satu saja salah -> 400 dan tidak ada yang diubah.
+void handleControllerSettings(AsyncWebServerRequest* request) {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  PidGains gains = currentController.gains();
+  RampShape shape = rampProfile.shape;
+  long target = targetCurrentMa;
+  long rampMs = rampMinDurationMs;
+  long rampSlew = rampMaxSlewMaPerSec;
+  long settleN = settleWindow;
+  long settleVar = settleMaxVarianceMa2;
+  xSemaphoreGive(controlMutex);
+
+  if (request->method() == HTTP_POST) {
+    const char* error = NULL;
+    if (!argIntInRange(request, "target", 0, 1000, target)) error = "target must be 0-1000 mA";
+    else if (!argFloatInRange(request, "kp", 0, 1, gains.kp)) error = "kp must be 0-1";
+    else if (!argFloatInRange(request, "ki", 0, 1, gains.ki)) error = "ki must be 0-1";
+    else if (!argFloatInRange(request, "kd", 0, 1, gains.kd)) error = "kd must be 0-1";
+    else if (!argFloatInRange(request, "kff", 0, 1, gains.kff)) error = "kff must be 0-1";
+    // slew <= 0 mematikan limiter output; harus positif
+    else if (!argFloatInRange(request, "slew", 0.001f, 10, gains.maxSlewPerSec)) error = "slew must be 0.001-10 per s";
+    else if (!argIntInRange(request, "rampMs", 0, 60000, rampMs)) error = "rampMs must be 0-60000";
+    else if (!argIntInRange(request, "rampSlew", 0, 10000, rampSlew)) error = "rampSlew must be 0-10000 mA/s";
+    else if (!argIntInRange(request, "settleN", 2, SETTLING_WINDOW_MAX, settleN)) error = "settleN must be 2-32";
+    else if (!argIntInRange(request, "settleVar", 1, 10000, settleVar)) error = "settleVar must be 1-10000 mA^2";
+    if (error == NULL && request->hasArg("ramp")) {
+      int8_t parsed = rampShapeFromName(request->arg("ramp").c_str());
+      if (parsed < 0) {
+        error = "ramp must be step, linear, trapezoid or scurve";
+      } else {
+        shape = (RampShape)parsed;
+      }
+    }
+    if (error != NULL) {
+      request->send(400, "application/json", "{\"success\":false,\"message\":\"" + String(error) + "\"}");
+      return;
+    }
+
+    xSemaphoreTake(controlMutex, portMAX_DELAY);
+    targetCurrentMa = target;
+    rampMinDurationMs = rampMs;
+    rampMaxSlewMaPerSec = rampSlew;
+    settleWindow = settleN;
+    settleMaxVarianceMa2 = settleVar;
+    currentController.configure(gains);
+    rampBuildProfile(rampProfile, shape);
+    settlingDetector.configure(settleWindow, CURRENT_TOLERANCE_MA, settleMaxVarianceMa2);
+    xSemaphoreGive(controlMutex);
+    controllerSavePending = true;
+  }
+
+  String json = "{";
+  json += "\"target\":" + String(target) + ",";
+  json += "\"tolerance\":" + String(CURRENT_TOLERANCE_MA) + ",";
+  json += "\"kp\":" + String(gains.kp, 6) + ",";
+  json += "\"ki\":" + String(gains.ki, 6) + ",";
+  json += "\"kd\":" + String(gains.kd, 6) + ",";
+  json += "\"kff\":" + String(gains.kff, 6) + ",";
+  json += "\"slew\":" + String(gains.maxSlewPerSec, 3) + ",";
+  json += "\"ramp\":\"" + String(RAMP_SHAPE_NAMES[shape]) + "\",";
+  json += "\"rampMs\":" + String(rampMs) + ",";
+  json += "\"rampSlew\":" + String(rampSlew) + ",";
+  json += "\"settleN\":" + String(settleN) + ",";
+  json += "\"settleVar\":" + String(settleVar);
+  json += "}";
+  request->send(200, "application/json", json);
+}
+
+// ------------------- Kalibrasi DAC -> Arus -------------------
+void loadCalibration(uint8_t fixture) {
+  CalibTable table;
+  Preferences preferences;
+  preferences.begin("core-calib", true);
+  String key = "fx" + String(fixture);
+  size_t len = preferences.getBytes(key.c_str(), &table, sizeof(table));
+  preferences.end();
+  if (len != sizeof(table) || table.version != CALIB_VERSION) calibClear(table);
+
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  activeFixture = fixture;
+  calibTable = table;
+  calibDirty = false;
+  xSemaphoreGive(controlMutex);
+
+  Serial.print("Kalibrasi fixture ");
+  Serial.print(fixture);
+  Serial.print(": ");
+  Serial.print(calibValidPoints(table));
+  Serial.println(" titik");
+}
+
+// Simpan tabel fixture aktif jika run terakhir menambah titik baru
+void saveCalibration() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  if (!calibDirty) {
+    xSemaphoreGive(controlMutex);
+    return;
+  }
+  calibTable.runs++;
+  calibDirty = false;
+  CalibTable table = calibTable;
+  uint8_t fixture = activeFixture;
+  xSemaphoreGive(controlMutex);
+
+  Preferences preferences;
+  preferences.begin("core-calib", false);
+  String key = "fx" + String(fixture);
+  preferences.putBytes(key.c_str(), &table, sizeof(table));
+  preferences.end();
+}
+
+// Dari loop(): tulis NVS yang diminta handler async / jalur stop
+void persistSettings() {
+  if (filterSavePending.exchange(false)) saveFilterSettings();
+  if (controllerSavePending.exchange(false)) saveControllerSettings();
+  if (calibSavePending.exchange(false)) saveCalibration();
+
+  int8_t fixture = calibFixturePending;
+  if (fixture >= 0) {
+    saveCalibration();
+    loadCalibration(fixture);
+    Preferences preferences;
+    preferences.begin("core-settings", false);
+    preferences.putUChar("calibFx", fixture);
+    preferences.end();
+    // Permintaan fixture lain yang masuk selama ini tetap menunggu
+    calibFixturePending.compare_exchange_strong(fixture, -1);
+  }
+}
+
+// Dipanggil controlTask (controlMutex dipegang) untuk tiap sample DUT baru.
+// Hanya sample yang diambil setelah kode DAC stabil CALIB_SETTLE_MS yang dicatat.
+// Output sebenarnya level 8.8; kode dibulatkan ke terdekat (bukan dipotong)
+// supaya titik kalibrasi tidak bias hingga 1 LSB ke bawah.
+void calibrationObserve() {
+  uint8_t code = ampToDacCode(ampValue);
+  uint32_t sampleMs = dutReading.timestampMs;
+  if (code != calibLastCode) {
+    calibLastCode = code;
+    calibCodeSinceMs = millis();
+    return;
+  }
+  if (sampleMs == calibLastSampleMs || (int32_t)(sampleMs - calibCodeSinceMs) < (int32_t)CALIB_SETTLE_MS) return;
+  calibLastSampleMs = sampleMs;
+  calibRecord(calibTable, code, dutReading.milliamps);
+  calibDirty = true;
+}
+
+// Amplitude awal injeksi dari tabel; 0 jika setpoint awal 0 mA atau tabel
+// belum bisa memprediksinya
+float calibratedStartAmp(int32_t targetMa) {
+  int16_t code = targetMa > 0 ? calibPredictCode(calibTable, targetMa) : -1;
+  calibLastCode = code < 0 ? 0 : code;
+  calibCodeSinceMs = millis();
+  if (code <= 0) return 0.0f;
+  calibJumpReport = code;
+  return code / 255.0f;
+}
+
+// Mulai ramp dari 0 mA ke target (controlMutex dipegang); return durasi ramp.
+// Hanya profil "step" yang setpoint awalnya sudah target, jadi hanya di situ
+// amplitude awal lompat ke kode prediksi tabel. Profil lain mulai dari 0 mA
+// (amplitude 0); tabel tetap dipakai sebagai feed-forward sepanjang ramp.
+uint32_t startCurrentRamp(int32_t targetMa) {
+  plantModel.resetResistance();  // DUT baru
+  beginRamp(0, targetMa);
+  int32_t initialMa = rampSetpoint(rampProfile, 0, targetMa, 0, currentRamp.durationMs);
+  ampValue = calibratedStartAmp(initialMa);
+  currentController.reset(ampValue);
+  return currentRamp.durationMs;
+}
+
+// Ramp setpoint baru tanpa reset amplitude/PID (step plan saat injeksi berjalan)
+void beginRamp(int32_t fromMa, int32_t targetMa) {
+  currentRamp.fromMa = fromMa;
+  currentRamp.toMa = targetMa;
+  currentRamp.startMs = millis();
+  currentRamp.durationMs = rampDurationMs(rampProfile.shape, fromMa, targetMa, rampMinDurationMs, rampMaxSlewMaPerSec);
+  currentRamp.feedForward = calibPredictCode(calibTable, targetMa) >= 0;
+  targetReached = false;
+  settlingDetector.reset();
+}
+
+// GET: tabel fixture aktif, {"pending":true} selama ganti fixture belum selesai.
+// POST fixture=0-3 (ganti fixture, dikerjakan loop(); dijawab 202 pending) atau reset=1
+void handleCalibration(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    if (autoInjectionMode) {
+      request->send(409, "application/json", "{\"success\":false,\"message\":\"injection running\"}");
+      return;
+    }
+    if (request->hasArg("fixture")) {
+      int fixture = request->arg("fixture").toInt();
+      if (fixture < 0 || fixture >= CALIB_FIXTURES) {
+        request->send(400, "application/json", "{\"success\":false,\"message\":\"fixture must be 0-3\"}");
+        return;
+      }
+      calibFixturePending = fixture;
+      request->send(202, "application/json", "{\"success\":true,\"pending\":true}");
+      return;
+    }
+    if (request->arg("reset") == "1") {
+      xSemaphoreTake(controlMutex, portMAX_DELAY);
+      calibClear(calibTable);
+      calibDirty = true;
+      xSemaphoreGive(controlMutex);
+      calibSavePending = true;
+    }
+  }
+  if (calibFixturePending >= 0) {
+    request->send(200, "application/json", "{\"success\":true,\"pending\":true}");
+    return;
+  }
+
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  CalibTable table = calibTable;
+  xSemaphoreGive(controlMutex);
+
+  String json = "{";
+  json += "\"fixture\":" + String(activeFixture) + ",";
+  json += "\"runs\":" + String(table.runs) + ",";
+  json += "\"predictedCode\":" + String(calibPredictCode(table, targetCurrentMa)) + ",";
+  json += "\"points\":[";
+  bool first = true;
+  for (uint8_t i = 0; i < CALIB_BUCKETS; i++) {
+    const CalibPoint& p = table.points[i];
+    if (p.hits == 0) continue;
+    if (!first) json += ",";
+    first = false;
+    json += "{\"code\":" + String(p.code) + ",\"mA\":" + String(p.milliamps) + ",\"hits\":" + String(p.hits) + "}";
+  }
+  json += "]}";
+  request->send(200, "application/json", json);
+}
+
+// ------------------- Sweep Karakterisasi -------------------
+// Dipanggil dengan controlMutex dipegang
+void startSweep(uint8_t step) {
+  sweep.active = true;
+  sweep.finished = false;
+  sweep.step = step;
+  sweep.code = 0;
+  sweep.stepStartMs = millis();
+  sweep.stableCount = 0;
+  sweep.lastMa = INT32_MIN;
+  sweep.count = 0;
+  ampValue = 0.0;
+  applyDAC();
+  systemState = RUN;
+  currentMenu = MENU_RUN;
+}
+
+// Satu sample DUT baru selama sweep (controlTask, controlMutex dipegang)
+void runSweepStep() {
+  uint32_t sinceMs = dutReading.timestampMs - sweep.stepStartMs;
+  if ((int32_t)sinceMs < (int32_t)SWEEP_MIN_DWELL_MS) return;
+
+  int32_t milliamps = dutReading.milliamps;
+  if (sweep.lastMa != INT32_MIN && abs(milliamps - sweep.lastMa) <= SWEEP_STABLE_MA) {
+    sweep.stableCount++;
+  } else {
+    sweep.stableCount = 0;
+  }
+  sweep.lastMa = milliamps;
+
+  bool settled = sweep.stableCount >= SWEEP_STABLE_SAMPLES;
+  if (!settled && sinceMs < SWEEP_MAX_DWELL_MS) return;
+
+  SweepPoint& point = sweep.points[sweep.count++];
+  point.code = sweep.code;
+  point.settled = settled;
+  point.millivolts = dutReading.millivolts;
+  point.milliamps = milliamps;
+  point.milliohms = dutReading.milliohms;
+  if (settled) {
+    calibRecord(calibTable, sweep.code, milliamps);
+    calibDirty = true;
+  }
+
+  // Step berikutnya; titik terakhir selalu kode 255
+  if (sweep.code >= 255 || sweep.count >= SWEEP_MAX_POINTS) {
+    ampValue = 0.0;
+    applyDAC();
+    sweep.active = false;
+    sweep.finished = true;
+    return;
+  }
+  sweep.code = sweep.code + sweep.step > 255 ? 255 : sweep.code + sweep.step;
+  sweep.stepStartMs = millis();
+  sweep.stableCount = 0;
+  sweep.lastMa = INT32_MIN;
+  ampValue = sweep.code / 255.0f;
+  applyDAC();
+}
+
+// Dari loop(): cetak laporan settling yang dicatat controlTask
+void reportSettled() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  SettleReport report = settleReport;
+  settleReport.pending = false;
+  xSemaphoreGive(controlMutex);
+  if (!report.pending) return;
+
+  Serial.print("✅ ");
+  Serial.print(report.targetMa);
+  Serial.println("mA target settled! Ready for RECORD.");
+  Serial.print("   Mean: ");
+  Serial.print(report.meanMa);
+  Serial.print("mA, Var: ");
+  Serial.print(report.varianceMa2);
+  Serial.print("mA2, Amplitude: ");
+  Serial.print(report.amp * 100, 1);
+  Serial.println("%");
+}
+
+// Dari loop(): cetak lompatan kode DAC awal yang dipilih calibratedStartAmp()
+void reportCalibJump() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  uint8_t code = calibJumpReport;
+  calibJumpReport = 0;
+  xSemaphoreGive(controlMutex);
+  if (code == 0) return;
+
+  Serial.print("Kalibrasi: lompat ke kode DAC ");
+  Serial.println(code);
+}
+
+// Dari loop(): kembalikan state ke STOP dan simpan kalibrasi setelah sweep selesai
+void finishSweep() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  bool finished = sweep.finished;
+  sweep.finished = false;
+  if (finished) {
+    systemState = STOPPED;
+    currentMenu = MENU_STOP;
+  }
+  xSemaphoreGive(controlMutex);
+  if (!finished) return;
+
+  Serial.print("Sweep selesai: ");
+  Serial.print(sweep.count);
+  Serial.println(" titik");
+  saveCalibration();
+  updateStatus();
+  updateLEDsAndRelay();
+}
+
+// GET: hasil sweep terakhir (JSON, atau CSV dengan format=csv).
+// POST action=start&step=1-64 | action=stop
+void handleSweep(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    String action = request->arg("action");
+    if (action == "start") {
+      int step = request->hasArg("step") ? request->arg("step").toInt() : SWEEP_DEFAULT_STEP;
+      // 255/step + 1 titik harus muat di SWEEP_MAX_POINTS
+      if (step < 255 / (SWEEP_MAX_POINTS - 1) + 1 || step > 64) {
+        request->send(400, "application/json", "{\"success\":false,\"message\":\"step must be 5-64\"}");
+        return;
+      }
+      xSemaphoreTake(controlMutex, portMAX_DELAY);
+      bool busy = outputBusy();
+      if (!busy) startSweep(step);
+      xSemaphoreGive(controlMutex);
+      if (busy) {
+        request->send(409, "application/json", "{\"success\":false,\"message\":\"injection running\"}");
+        return;
+      }
+      statusRedrawPending = true;
+      updateLEDsAndRelay();
+      Serial.print("Sweep dimulai, step ");
+      Serial.println(step);
+    } else if (action == "stop") {
+      handleStopAPI(request);
+      return;
+    }
+  }
+
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  bool active = sweep.active;
+  uint8_t count = sweep.count;
+  SweepPoint points[SWEEP_MAX_POINTS];
+  memcpy(points, sweep.points, sizeof(SweepPoint) * count);
+  xSemaphoreGive(controlMutex);
+
+  char volts[16], amps[16], ohms[16];
+  if (request->arg("format") == "csv") {
+    String csv = "code,amplitude,voltage,current,resistance,settled\n";
+    for (uint8_t i = 0; i < count; i++) {
+      formatMilli(volts, sizeof(volts), points[i].millivolts, 2);
+      formatMilli(amps, sizeof(amps), points[i].milliamps, 3);
+      formatMilli(ohms, sizeof(ohms), points[i].milliohms, 2);
+      csv += String(points[i].code) + "," + String(points[i].code / 255.0f, 3) + "," + volts + "," + amps + "," +
+             ohms + "," + (points[i].settled ? "1" : "0") + "\n";
+    }
+    AsyncWebServerResponse* response = request->beginResponse(200, "text/csv", csv);
+    response->addHeader("Content-Disposition", "attachment; filename=sweep.csv");
+    request->send(response);
+    return;
+  }
+
+  String json = "{";
+  json += "\"active\":" + String(active ? "true" : "false") + ",";
+  json += "\"fixture\":" + String(activeFixture) + ",";
+  json += "\"points\":[";
+  for (uint8_t i = 0; i < count; i++) {
+    formatMilli(volts, sizeof(volts), points[i].millivolts, 2);
+    formatMilli(amps, sizeof(amps), points[i].milliamps, 3);
+    formatMilli(ohms, sizeof(ohms), points[i].milliohms, 2);
+    if (i > 0) json += ",";
+    json += "{\"code\":" + String(points[i].code) + ",";
+    json += "\"voltage\":" + String(volts) + ",";
+    json += "\"current\":" + String(amps) + ",";
+    json += "\"resistance\":" + String(ohms) + ",";
+    json += "\"settled\":" + String(points[i].settled ? "true" : "false") + "}";
+  }
+  json += "]}";
+  request->send(200, "application/json", json);
+}
+
+// ------------------- Test Plan -------------------
+// Hook dipanggil PlanRunner dari controlTask dengan controlMutex dipegang
+void DevicePlanHooks::planRamp(int32_t milliamps) {
+  if (!autoInjectionMode) {
+    autoInjectionMode = true;
+    systemState = RUN;
+    currentMenu = MENU_RUN;
+    startCurrentRamp(milliamps);
+    applyDAC();
+  } else {
+    beginRamp(currentRamp.toMa, milliamps);
+  }
+}
+
+bool DevicePlanHooks::planSettled() {
+  return targetReached;
+}
+
+void DevicePlanHooks::planRecord(bool on, uint8_t step) {
+  if (on) {
+    planRecording = true;
+    planRecordStartMs = millis();
+    planSamples = 0;
+    planSumMv = 0;
+    planSumMa = 0;
+    return;
+  }
+  planRecording = false;
+  if (planResultCount >= PLAN_MAX_RESULTS) return;
+  PlanResult& result = planResults[planResultCount++];
+  result.step = step;
+  result.fixture = activeFixture;
+  result.durationMs = millis() - planRecordStartMs;
+  result.samples = planSamples;
+  result.millivolts = planSamples ? planSumMv / planSamples : 0;
+  result.milliamps = planSamples ? planSumMa / planSamples : 0;
+  result.milliohms = measurementResistance(result.millivolts, result.milliamps);
+}
+
+bool DevicePlanHooks::planFixture(uint8_t fixture) {
+  if (planFixtureRequest < 0 && activeFixture == fixture) return true;
+  planFixtureRequest = fixture;
+  return false;
+}
+
+void DevicePlanHooks::planStop() {
+  planRecording = false;
+  autoInjectionMode = false;
+  ampValue = 0.0;
+  applyDAC();
+  systemState = STOPPED;
+  currentMenu = MENU_STOP;
+  planFinished = true;
+}
+
+// Dari loop(): ganti fixture yang diminta plan dan bereskan plan yang selesai
+void finishPlan() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  int8_t fixture = planFixtureRequest;
+  xSemaphoreGive(controlMutex);
+  if (fixture >= 0) {
+    saveCalibration();
+    loadCalibration(fixture);
+    xSemaphoreTake(controlMutex, portMAX_DELAY);
+    if (planFixtureRequest == fixture) planFixtureRequest = -1;
+    xSemaphoreGive(controlMutex);
+  }
+
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  bool finished = planFinished;
+  planFinished = false;
+  PlanStatus status = planRunner.status();
+  xSemaphoreGive(controlMutex);
+  if (!finished) return;
+
+  Serial.print("Test plan selesai: ");
+  Serial.println(PLAN_STATUS_NAMES[status]);
+  saveCalibration();
+  updateStatus();
+  updateLEDsAndRelay();
+}
+
+// Step JSON: {"op":"ramp","mA":200,"timeout":10} | {"op":"hold","s":30,"record":true}
+//            {"op":"repeat","to":0,"times":2} | {"op":"fixture","id":1} | {"op":"stop"}
+bool parsePlan(JsonArrayConst steps, TestPlan& plan, String& error) {
+  plan.count = 0;
+  if (steps.size() == 0 || steps.size() > PLAN_MAX_STEPS) {
+    error = "plan must have 1-" + String(PLAN_MAX_STEPS) + " steps";
+    return false;
+  }
+  for (JsonObjectConst obj : steps) {
+    PlanStep& step = plan.steps[plan.count];
+    step.flag = 0;
+    step.arg = 0;
+    step.value = 0;
+    step.durationMs = 0;
+    String op = obj["op"] | "";
+    if (op == "ramp") {
+      step.op = PLAN_OP_RAMP;
+      step.value = obj["mA"] | -1;
+      step.durationMs = (uint32_t)((obj["timeout"] | 0.0f) * 1000);
+      if (step.value < 0 || step.value > 1000) error = "ramp mA must be 0-1000";
+    } else if (op == "hold") {
+      step.op = PLAN_OP_HOLD;
+      step.durationMs = (uint32_t)((obj["s"] | 0.0f) * 1000);
+      step.flag = (obj["record"] | false) ? 1 : 0;
+      if (step.durationMs == 0) error = "hold needs s > 0";
+    } else if (op == "repeat") {
+      step.op = PLAN_OP_REPEAT;
+      step.arg = obj["to"] | 0;
+      step.value = obj["times"] | 1;
+      if (step.arg >= plan.count || step.value < 0 || step.value >= PLAN_UNARMED) error = "repeat must jump back";
+    } else if (op == "fixture") {
+      step.op = PLAN_OP_FIXTURE;
+      step.arg = obj["id"] | 0;
+      if (step.arg >= CALIB_FIXTURES) error = "fixture must be 0-3";
+    } else if (op == "stop") {
+      step.op = PLAN_OP_STOP;
+    } else {
+      error = "unknown op '" + op + "'";
+    }
+    if (error.length() > 0) {
+      error = "step " + String(plan.count) + ": " + error;
+      return false;
+    }
+    plan.count++;
+  }
+  return true;
+}
+
+// POST body {"steps":[...]} memulai plan, POST ?action=abort menghentikan.
+// GET: status plan dan rata-rata V/I/R tiap hold yang direkam.
+void handlePlan(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    if (request->arg("action") == "abort") {
+      handleStopAPI(request);
+      return;
+    }
+    if (rejectOversizedBody(request)) return;
+    JsonDocument doc;
+    if (deserializeJson(doc, requestBody(request))) {
+      request->send(400, "application/json", "{\"success\":false,\"message\":\"Invalid JSON\"}");
+      return;
+    }
+    TestPlan& plan = planUpload;
+    String error;
+    if (!parsePlan(doc["steps"].as<JsonArrayConst>(), plan, error)) {
+      request->send(400, "application/json", "{\"success\":false,\"message\":\"" + error + "\"}");
+      return;
+    }
+
+    xSemaphoreTake(controlMutex, portMAX_DELAY);
+    bool busy = outputBusy();
+    if (!busy) {
+      planResultCount = 0;
+      planRunner.start(plan);
+    }
+    xSemaphoreGive(controlMutex);
+    if (busy) {
+      request->send(409, "application/json", "{\"success\":false,\"message\":\"injection running\"}");
+      return;
+    }
+    Serial.print("Test plan dimulai, ");
+    Serial.print(plan.count);
+    Serial.println(" step");
+  }
+
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  PlanStatus status = planRunner.status();
+  uint8_t stepIndex = planRunner.stepIndex();
+  uint8_t count = planResultCount;
+  PlanResult* results = planResultsSnapshot;
+  memcpy(results, planResults, sizeof(PlanResult) * count);
+  xSemaphoreGive(controlMutex);
+
+  char volts[16], amps[16], ohms[16];
+  String json = "{";
+  json += "\"status\":\"" + String(PLAN_STATUS_NAMES[status]) + "\",";
+  json += "\"step\":" + String(stepIndex) + ",";
+  json += "\"results\":[";
+  for (uint8_t i = 0; i < count; i++) {
+    formatMilli(volts, sizeof(volts), results[i].millivolts, 2);
+    formatMilli(amps, sizeof(amps), results[i].milliamps, 3);
+    formatMilli(ohms, sizeof(ohms), results[i].milliohms, 2);
+    if (i > 0) json += ",";
+    json += "{\"step\":" + String(results[i].step) + ",";
+    json += "\"fixture\":" + String(results[i].fixture) + ",";
+    json += "\"durationMs\":" + String(results[i].durationMs) + ",";
+    json += "\"samples\":" + String(results[i].samples) + ",";
+    json += "\"voltage\":" + String(volts) + ",";
+    json += "\"current\":" + String(amps) + ",";
+    json += "\"resistance\":" + String(ohms) + "}";
+  }
+  json += "]}";
+  request->send(200, "application/json", json);
+}
+
+// ------------------- Tombol -------------------
+void handleButtons() {
+  keyUp.loop();
+  // keyDown.loop();
+
+  if (keyUp.isPressed()) {
+    currentMenu = (MenuItem)((int)currentMenu - 1);
+    if ((int)currentMenu < 0) currentMenu = (MenuItem)(MENU_COUNT - 1);
+    executeMenu(currentMenu);
+  }
+
+  // if (keyDown.isPressed()) {
+  //   currentMenu = (MenuItem)((int)currentMenu + 1);
+  //   if ((int)currentMenu >= MENU_COUNT) currentMenu = (MenuItem)0;
+  //   executeMenu(currentMenu);
+  // }
+}
+
+// ------------------- Rotary Encoder & Serial to Nano -------------------
+void handleRotaryEncoder() {
+  // Hanya izinkan pengaturan amplitude saat RUN atau RUN TIME
+  if (systemState != RUN) return;
+
+  int currentCLK = digitalRead(CLK_PIN);
+
+  if (currentCLK != lastCLK && currentCLK == LOW) {
+    if (digitalRead(DT_PIN) == HIGH) {
+      ampValue += stepSize;        // putar kanan → naik
+    } else {
+      ampValue -= stepSize;        // putar kiri → turun
+    }
+
+    ampValue = constrain(ampValue, 0.0, 1.0);
+    updateDAC();
+  }
+
+  lastCLK = currentCLK;
+
+  // -------- Tombol tekan (reset amplitude) --------
+  if (digitalRead(SW_PIN) == LOW) {
+    ampValue = 0.0;
+    updateDAC();
+    delay(200);
+  }
+}
+
+void updateDAC() {
+  applyDAC();
+  logDAC();
+}
+
+// Serial bisa blocking: panggil setelah controlMutex dilepas
+void logDAC() {
+  Serial.print("DAC = ");
+  Serial.println(ditherLevelFromAmp(ampValue) / 256.0f, 2);  // kode efektif dengan dither
+}
+
+// Tanpa Serial: dipanggil dari controlTask tiap periode kontrol
+void applyDAC() {
+  if (!dacDmaActive) {
+    dacWrite(DAC_PIN, ampToDacCode(ampValue));
+    return;
+  }
+
+  // Pola hanya ditulis ulang saat level berubah; selebihnya DMA mengulang
+  // buffer terakhir (tx_desc_auto_clear = false)
+  static uint16_t lastLevel = UINT16_MAX;
+  static uint8_t pattern[DAC_PATTERN_LEN];
+  static uint16_t frames[DAC_PATTERN_LEN * 2];
+  uint16_t level = ditherLevelFromAmp(ampValue);
+  xSemaphoreTake(dacMutex, portMAX_DELAY);
+  if (level == lastLevel) {
+    xSemaphoreGive(dacMutex);
+    return;
+  }
+  ditherFill(pattern, DAC_PATTERN_LEN, level);
+  for (uint16_t i = 0; i < DAC_PATTERN_LEN; i++) {
+    // DAC built-in mengambil byte atas tiap sample 16 bit, kanan & kiri
+    frames[2 * i] = frames[2 * i + 1] = (uint16_t)pattern[i] << 8;
+  }
+  size_t written = 0;
+  esp_err_t err = i2s_write(DAC_I2S_PORT, frames, sizeof(frames), &written, pdMS_TO_TICKS(10));
+  // Tulis sebagian (timeout) meninggalkan pola campuran di DMA; lastLevel
+  // tidak diperbarui supaya periode berikutnya menulis ulang pola utuh
+  if (err == ESP_OK && written == sizeof(frames)) lastLevel = level;
+  xSemaphoreGive(dacMutex);
+}
+
+bool dacOutputBegin() {
+  i2s_config_t config = {};
+  config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX | I2S_MODE_DAC_BUILT_IN);
+  config.sample_rate = DAC_I2S_SAMPLE_RATE;
+  config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+  config.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT;
+  config.communication_format = I2S_COMM_FORMAT_STAND_MSB;
+  config.dma_buf_count = DAC_DMA_BUF_COUNT;
+  config.dma_buf_len = DAC_DMA_BUF_LEN;
+  config.use_apll = false;
+  config.tx_desc_auto_clear = false;
+
+  if (i2s_driver_install(DAC_I2S_PORT, &config, 0, NULL) != ESP_OK) return false;
+  // GPIO 25 = DAC1 = kanal kanan
+  i2s_set_dac_mode(DAC_PIN == 25 ? I2S_DAC_CHANNEL_RIGHT_EN : I2S_DAC_CHANNEL_LEFT_EN);
+  dacMutex = xSemaphoreCreateMutex();
+  dacDmaActive = true;
+  return true;
+}
+
+// Kode 0-255 terdekat, dibulatkan sama seperti level dither 8.8
+uint8_t ampToDacCode(float amp) {
+  return ditherCodeFromLevel(ditherLevelFromAmp(amp));
+}
+
+// POST: simpan lalu antrikan koneksi ke loop(); respons 202 {"pending":true}.
+// GET: hasil percobaan koneksi terakhir, {"pending":true} selama berjalan.
+void handleWiFiSettings(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    String ssid = request->arg("ssid");
+    String password = request->arg("password");
+    String cloudServer = request->arg("cloudServer");
+    
     if (ssid.length() > 0) {
-      // Save to both RAM and NVS memory
-      wifiSSID = ssid;
-      wifiPassword = password;
-      
-      // Save to NVS memory for persistence
-      saveSettingsToMemory(ssid, password, cloudServer);
-      cloudServerAddress = cloudServer;
-      
-      Serial.println("Settings updated in RAM:");
-      Serial.println("WiFi SSID: " + wifiSSID);
-      Serial.println("Cloud Server: " + cloudServerAddress);
-      
-      // Switch to dual mode and try to connect while maintaining AP
-      WiFi.mode(WIFI_AP_STA);
-      Serial.println("Attempting to connect to WiFi...");
-      WiFi.begin(ssid.c_str(), password.c_str());
-      
-      // Wait for connection with shorter timeout
-      int attempts = 0;
-      bool connected = false;
-      while (attempts < 10 && WiFi.status() != WL_CONNECTED) {
-        delay(500);
-        attempts++;
-        Serial.print(".");
-      }
-      
-      if (WiFi.status() == WL_CONNECTED) {
-        wifiConnected = true;
-        wifiStationMode = true;
-        
-        Serial.println("");
-        Serial.println("WiFi connected successfully!");
-        Serial.println("IP: " + WiFi.localIP().toString());
-        Serial.println("AP still active at 192.168.4.1");
-        
-        String response = "{\"success\": true, \"message\": \"Connected to WiFi, AP still active\", \"ip\": \"" + WiFi.localIP().toString() + "\"}";
-        server.send(200, "application/json", response);
-      } else {
-        wifiConnected = false;
-        Serial.println("");
-        Serial.println("WiFi connection failed, AP mode maintained");
-        
-        String response = "{\"success\": false, \"message\": \"Failed to connect, AP mode maintained\", \"ip\": \"192.168.4.1\"}";
-        server.send(200, "application/json", response);
+      if (wifiJob.pending) {
+        request->send(409, "application/json", "{\"success\": false, \"message\": \"Connection in progress\"}");
+        return;
       }
+      // Disimpan ke NVS dan dipasang oleh loop() sebelum WiFi.begin;
+      // wifiSSID dkk. tidak disentuh di sini
+      wifiJobInput.ssid = ssid;
+      wifiJobInput.password = password;
+      wifiJobInput.cloudServer = cloudServer;
+      wifiJob.pending = true;
+      request->send(202, "application/json", "{\"success\": true, \"pending\": true}");
     } else {
-      server.send(400, "application/json", "{\"success\": false, \"message\": \"SSID is required\"}");
+      request->send(400, "application/json", "{\"success\": false, \"message\": \"SSID is required\"}");
     }
   } else {
-    server.send(405, "application/json", "{\"success\": false, \"message\": \"Method not allowed\"}");
+    sendJobStatus(request, wifiJob);
+  }
+}
+
+void sendJobStatus(AsyncWebServerRequest* request, WebJob& job) {
+  if (job.pending) {
+    request->send(200, "application/json", "{\"success\": true, \"pending\": true}");
+  } else if (job.result.length() == 0) {
+    request->send(404, "application/json", "{\"success\": false, \"message\": \"No request yet\"}");
+  } else {
+    request->send(200, "application/json", job.result);
   }
 }
 
-void handleCloudSettings() {
-  if (server.method() == HTTP_POST) {
-    String host = server.arg("host");
-    String port = server.arg("port");
-    String user = server.arg("user");
-    String pass = server.arg("pass");
-    String clientId = server.arg("clientId");
-    String topic = server.arg("topic");
+// Dari loop(): jalankan job blocking yang diantrikan handler web
+void runWebJobs() {
+  if (wifiJob.pending) {
+    // Save to NVS memory for persistence, then to RAM
+    saveSettingsToMemory(wifiJobInput.ssid, wifiJobInput.password, wifiJobInput.cloudServer);
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    wifiSSID = wifiJobInput.ssid;
+    wifiPassword = wifiJobInput.password;
+    cloudServerAddress = wifiJobInput.cloudServer;
+    xSemaphoreGive(settingsMutex);
+
+    // Switch to dual mode and try to connect while maintaining AP
+    WiFi.mode(WIFI_AP_STA);
+    Serial.println("Attempting to connect to WiFi...");
+    WiFi.begin(wifiSSID.c_str(), wifiPassword.c_str());
     
-    if (host.length() > 0) {
-      // Update RAM values
-      mqttHost = host;
-      mqttPort = port.toInt();
-      mqttUser = user;
-      mqttPass = pass;
-      mqttClientId = clientId;
-      mqttTopic = topic;
+    // Wait for connection with shorter timeout
+    int attempts = 0;
+    while (attempts < 10 && WiFi.status() != WL_CONNECTED) {
+      delay(500);
+      attempts++;
+      Serial.print(".");
+    }
+    
+    if (WiFi.status() == WL_CONNECTED) {
+      wifiConnected = true;
+      wifiStationMode = true;
       
-      // Persist to NVS
-      Preferences preferences;
-      preferences.begin("core-settings", false);
-      preferences.putString("mqttHost", mqttHost);
-      preferences.putInt("mqttPort", mqttPort);
-      preferences.putString("mqttUser", mqttUser);
-      preferences.putString("mqttPass", mqttPass);
-      preferences.putString("mqttClientId", mqttClientId);
-      preferences.putString("mqttTopic", mqttTopic);
-      preferences.end();
+      Serial.println("");
+      Serial.println("WiFi connected successfully!");
+      Serial.println("IP: " + WiFi.localIP().toString());
+      Serial.println("AP still active at 192.168.4.1");
+      
+      wifiJob.result = "{\"success\": true, \"message\": \"Connected to WiFi, AP still active\", \"ip\": \"" + WiFi.localIP().toString() + "\"}";
+    } else {
+      wifiConnected = false;
+      Serial.println("");
+      Serial.println("WiFi connection failed, AP mode maintained");
       
-      Serial.println("MQTT settings saved:");
-      Serial.println("Host: " + mqttHost);
-      Serial.println("Port: " + String(mqttPort));
-      Serial.println("User: " + mqttUser);
-      Serial.println("Client ID: " + mqttClientId);
-      Serial.println("Topic: " + mqttTopic);
+      wifiJob.result = "{\"success\": false, \"message\": \"Failed to connect, AP mode maintained\", \"ip\": \"192.168.4.1\"}";
+    }
+    wifiJob.pending = false;
+  }
+
+  if (cloudJob.pending) {
+    String response;
+    bool success = sendDataToCloudServer(cloudJob.input, response);
+    
+    if (success) {
+      dataSubmitted = true;
+      lastSubmissionStatus = "Success";
+    } else {
+      dataSubmitted = false;
+      lastSubmissionStatus = "Failed";
+    }
+    cloudJob.input = "";
+    cloudJob.result = response;
+    cloudJob.pending = false;
+  }
+
+  if (mqttSavePending) {
+    xSemaphoreTake(settingsMutex, portMAX_DELAY);
+    mqttHost = mqttSaveInput.host;
+    mqttPort = mqttSaveInput.port;
+    mqttUser = mqttSaveInput.user;
+    mqttPass = mqttSaveInput.pass;
+    mqttClientId = mqttSaveInput.clientId;
+    mqttTopic = mqttSaveInput.topic;
+    xSemaphoreGive(settingsMutex);
+
+    // Persist to NVS
+    Preferences preferences;
+    preferences.begin("core-settings", false);
+    preferences.putString("mqttHost", mqttHost);
+    preferences.putInt("mqttPort", mqttPort);
+    preferences.putString("mqttUser", mqttUser);
+    preferences.putString("mqttPass", mqttPass);
+    preferences.putString("mqttClientId", mqttClientId);
+    preferences.putString("mqttTopic", mqttTopic);
+    preferences.end();
+
+    Serial.println("MQTT settings saved:");
+    Serial.println("Host: " + mqttHost);
+    Serial.println("Port: " + String(mqttPort));
+    Serial.println("User: " + mqttUser);
+    Serial.println("Client ID: " + mqttClientId);
+    Serial.println("Topic: " + mqttTopic);
+    mqttSavePending = false;
+  }
+
+  if (wifiResetPending.exchange(false)) {
+    // Clear all saved settings and reset to default
+    resetWiFiSettings();
+  }
+
+  uint32_t restartAt = restartAtMs;
+  if (restartAt != 0 && (int32_t)(millis() - restartAt) >= 0) {
+    ESP.restart();
+  }
+
+  if (statusRedrawPending.exchange(false)) {
+    updateStatus();
+    updateTime();
+  }
+}
+
+void handleCloudSettings(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    String host = request->arg("host");
+    String port = request->arg("port");
+    String user = request->arg("user");
+    String pass = request->arg("pass");
+    String clientId = request->arg("clientId");
+    String topic = request->arg("topic");
+    
+    if (host.length() > 0) {
+      if (mqttSavePending) {
+        request->send(409, "application/json", "{\"success\": false, \"message\": \"Save in progress\"}");
+        return;
+      }
+      // RAM dan NVS diperbarui loop() (runWebJobs)
+      mqttSaveInput.host = host;
+      mqttSaveInput.port = port.toInt();
+      mqttSaveInput.user = user;
+      mqttSaveInput.pass = pass;
+      mqttSaveInput.clientId = clientId;
+      mqttSaveInput.topic = topic;
+      mqttSavePending = true;
       
-      server.send(200, "application/json", "{\"success\": true, \"message\": \"MQTT settings saved\"}");
+      request->send(200, "application/json", "{\"success\": true, \"message\": \"MQTT settings saved\"}");
     } else {
-      server.send(400, "application/json", "{\"success\": false, \"message\": \"MQTT host is required\"}");
+      request->send(400, "application/json", "{\"success\": false, \"message\": \"MQTT host is required\"}");
     }
   } else {
-    server.send(405, "application/json", "{\"success\": false, \"message\": \"Method not allowed\"}");
+    request->send(405, "application/json", "{\"success\": false, \"message\": \"Method not allowed\"}");
   }
 }
 
-void handleWiFiReset() {
-  if (server.method() == HTTP_POST) {
+void handleWiFiReset(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
     Serial.println("WiFi reset requested - clearing saved settings...");
     
-    // Clear all saved settings and reset to default
-    resetWiFiSettings();
+    // Settings dihapus loop() (runWebJobs) sebelum restart
+    wifiResetPending = true;
     
-    server.send(200, "application/json", "{\"success\": true, \"message\": \"WiFi reset to PDKB_INTERNET_G\"}");
+    request->send(200, "application/json", "{\"success\": true, \"message\": \"WiFi reset to PDKB_INTERNET_G\"}");
     
-    // Restart ESP32 after 2 seconds
-    delay(2000);
-    ESP.restart();
+    // Restart ESP32 after 2 seconds (dari loop(), supaya respons sempat terkirim)
+    restartAtMs = millis() + 2000;
   } else {
-    server.send(405, "application/json", "{\"success\": false, \"message\": \"Method not allowed\"}");
+    request->send(405, "application/json", "{\"success\": false, \"message\": \"Method not allowed\"}");
   }
 }
 
 void stopAutoInjection() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
   autoInjectionMode = false;
+  sweep.active = false;
+  planRunner.abort();
+  planRecording = false;
   targetReached = false;
   lampTimeBased = false;
   systemState = STOPPED;
   countdownActive = false;
   ampValue = 0.0;
-  updateDAC();
+  applyDAC();
+  xSemaphoreGive(controlMutex);
+  logDAC();
+  calibSavePending = true;  // bisa dipanggil dari handler async (GET /)
   // Saat auto injection (Spesial Conduct Suit Test) berhenti,
   // LED kembali menunjukkan STOP.
   currentMenu = MENU_STOP;
@@ -3101,71 +3188,98 @@ void updateTimeBasedLamp() {
   }
 }
 
-void handleAutoInjection() {
-  if (server.method() == HTTP_POST) {
-    String action = server.arg("action");
+// Perintah kontrol dipakai bersama oleh handler HTTP dan kanal WebSocket /ws.
+// true jika injeksi, sweep atau plan sedang memegang DAC (controlMutex dipegang)
+bool outputBusy() {
+  return autoInjectionMode || sweep.active || planRunner.status() == PLAN_RUNNING;
+}
+
+// Mulai injeksi ke targetCurrentMa; false jika injeksi/sweep/plan sedang berjalan.
+bool startTargetInjection(uint32_t& rampMs) {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  if (outputBusy()) {
+    xSemaphoreGive(controlMutex);
+    return false;
+  }
+  autoInjectionMode = true;
+  targetReached = false;
+  rampMs = startCurrentRamp(targetCurrentMa);
+  applyDAC();
+  xSemaphoreGive(controlMutex);
+  logDAC();
+  systemState = RUN;
+  currentMenu = MENU_RUN;
+  updateLEDsAndRelay();
+  
+  Serial.print("Inject ");
+  Serial.print(targetCurrentMa);
+  Serial.print("mA started, ramp ");
+  Serial.print(rampMs);
+  Serial.println(" ms");
+  return true;
+}
+
+// Start 2 minute recording; hanya setelah detektor settling menyatakan stabil
+bool startRecording(String& reason) {
+  if (!targetReached || countdownActive) {
+    reason = targetReached ? "Already recording" : "Current not settled yet";
+    return false;
+  }
+  countdownActive = true;
+  countdownStart = millis();
+  countdownDuration = 2 * 60 * 1000UL; // 2 minutes
+  Serial.println("Recording started (2 minutes)");
+  return true;
+}
+
+void handleAutoInjection(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    String action = request->arg("action");
     
     if (action == "inject") {
-      // Inject 200mA in 3 seconds
-      if (!autoInjectionMode) {
-        autoInjectionMode = true;
-        targetReached = false;
-        ampValue = 0.0;
-        updateDAC();
-        systemState = RUN;
-        currentMenu = MENU_RUN;
-        updateLEDsAndRelay();
-        
-        // Calculate steps: 100% in 3 seconds = 33.33% per second
-        // Increment every 100ms = 3.33% per step, 30 steps total
-        
-        server.send(200, "application/json", "{\"success\":true,\"message\":\"Injecting 200mA\",\"duration\":3}");
-        Serial.println("Inject 200mA started (3 seconds)");
+      // Inject ke targetCurrentMa; durasi ramp dihitung dari profil
+      uint32_t rampMs;
+      if (startTargetInjection(rampMs)) {
+        String msg = "{\"success\":true,\"message\":\"Injecting " + String(targetCurrentMa) +
+                     "mA\",\"duration\":" + String(rampMs / 1000.0f, 1) +
+                     ",\"target\":" + String(targetCurrentMa) + "}";
+        request->send(200, "application/json", msg);
       } else {
-        server.send(200, "application/json", "{\"success\":false,\"message\":\"Already injecting\"}");
+        request->send(409, "application/json", "{\"success\":false,\"message\":\"Injection, sweep or plan running\"}");
       }
     } else if (action == "record") {
-      // Start 2 minute recording
-      if (targetReached && !countdownActive) {
-        countdownActive = true;
-        countdownStart = millis();
-        countdownDuration = 2 * 60 * 1000UL; // 2 minutes
-        
-        server.send(200, "application/json", "{\"success\":true,\"message\":\"Recording started\",\"duration\":120}");
-        Serial.println("Recording started (2 minutes)");
+      String reason;
+      if (startRecording(reason)) {
+        request->send(200, "application/json", "{\"success\":true,\"message\":\"Recording started\",\"duration\":120}");
       } else {
-        server.send(200, "application/json", "{\"success\":false,\"message\":\"Cannot start recording\"}");
+        request->send(200, "application/json", "{\"success\":false,\"message\":\"Cannot start recording: " + reason + "\"}");
       }
     } else if (action == "stop") {
       stopAutoInjection();
       countdownActive = false;
-      server.send(200, "application/json", "{\"success\":true,\"message\":\"Stopped\"}");
+      request->send(200, "application/json", "{\"success\":true,\"message\":\"Stopped\"}");
     } else {
-      server.send(400, "application/json", "{\"success\":false,\"message\":\"Invalid action\"}");
+      request->send(400, "application/json", "{\"success\":false,\"message\":\"Invalid action\"}");
     }
   } else {
-    server.send(405, "application/json", "{\"success\":false,\"message\":\"Method not allowed\"}");
+    request->send(405, "application/json", "{\"success\":false,\"message\":\"Method not allowed\"}");
   }
 }
 
-void sendDataToCloud() {
-  if (server.method() == HTTP_POST) {
-    String jsonData = server.arg("plain");
-    
-    String response;
-    bool success = sendDataToCloudServer(jsonData, response);
-    
-    if (success) {
-      dataSubmitted = true;
-      lastSubmissionStatus = "Success";
-    } else {
-      dataSubmitted = false;
-      lastSubmissionStatus = "Failed";
+// POST body JSON: antrikan pengiriman ke loop(); respons 202 {"pending":true}.
+// GET: hasil pengiriman terakhir, {"pending":true} selama berjalan.
+void sendDataToCloud(AsyncWebServerRequest* request) {
+  if (request->method() == HTTP_POST) {
+    if (rejectOversizedBody(request)) return;
+    if (cloudJob.pending) {
+      request->send(409, "application/json", "{\"success\": false, \"message\": \"Submission in progress\"}");
+      return;
     }
-    
-    server.send(200, "application/json", response);
+    cloudJob.input = requestBody(request);
+    cloudJob.pending = true;
+    request->send(202, "application/json", "{\"success\": true, \"pending\": true}");
   } else {
-    server.send(405, "application/json", "{\"success\": false, \"message\": \"Method not allowed\"}");
+    sendJobStatus(request, cloudJob);
   }
 }
 
@@ -3238,15 +3352,16 @@ bool sendDataToCloudServer(const String& jsonData, String& response) {
   http.end();
 }
 
-void handleInjectAPI() {
+void handleInjectAPI(AsyncWebServerRequest* request) {
+  if (rejectOversizedBody(request)) return;
   // Parse JSON body from pengujian.html
-  if (server.hasArg("plain")) {
-    String body = server.arg("plain");
+  String body = requestBody(request);
+  if (body.length() > 0) {
     StaticJsonDocument<256> doc;
     DeserializationError error = deserializeJson(doc, body);
     
     if (error) {
-      server.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+      request->send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
       return;
     }
     
@@ -3254,38 +3369,49 @@ void handleInjectAPI() {
     int amplitudePercent = doc["amplitude"] | 0; // Amplitude dari slider (0-100%)
     
     if (mode == "special") {
-      // Special mode: auto-increment sampai 200mA (100%) dengan countdown
-      int duration = doc["duration"] | 15; // Default 15 seconds
-      userCountdownDuration = duration * 1000UL;
+      // Special mode: auto-increment sampai 200mA (100%); rekaman setelah
+      // target tercapai selalu 2 menit (startRecording)
+      xSemaphoreTake(controlMutex, portMAX_DELAY);
+      if (outputBusy()) {
+        xSemaphoreGive(controlMutex);
+        request->send(409, "application/json", "{\"success\":false,\"message\":\"Injection, sweep or plan running\"}");
+        return;
+      }
       autoInjectionMode = true; // Pakai auto-increment dari 0% ke 100%
       targetReached = false;
       systemState = RUN;
-      ampValue = 0.0; // Mulai dari 0%, auto-increment akan naikkan perlahan
+      // Setpoint mengikuti profil ramp; amplitude awal dari tabel kalibrasi
       countdownActive = false; // Countdown belum aktif (aktif setelah reach 200mA)
-      lastAutoIncrement = millis(); // Reset timer auto-increment
+      startCurrentRamp(targetCurrentMa);
       
-      updateDAC();
+      applyDAC();
+      xSemaphoreGive(controlMutex);
+      logDAC();
       digitalWrite(RELAY_PIN, HIGH);
       digitalWrite(LED_RUN, HIGH);
       digitalWrite(LED_STOP, LOW);
       
       Serial.println("=== SPECIAL MODE: AUTO-INCREMENT TO 200mA ===");
       Serial.print("Starting from: 0%");
-      Serial.print(", Target: 200mA (100%)");
-      Serial.print(", Countdown after reach: ");
-      Serial.print(duration);
-      Serial.println(" seconds");
+      Serial.println(", Target: 200mA (100%)");
       
-      server.send(200, "application/json", "{\"success\":true,\"message\":\"Special: Auto-increment to 200mA\"}");
+      request->send(200, "application/json", "{\"success\":true,\"message\":\"Special: Auto-increment to 200mA\"}");
     } else {
       // Quick mode: set amplitude SESUAI SLIDER (0-100%)
+      xSemaphoreTake(controlMutex, portMAX_DELAY);
+      if (outputBusy()) {
+        xSemaphoreGive(controlMutex);
+        request->send(409, "application/json", "{\"success\":false,\"message\":\"Injection, sweep or plan running\"}");
+        return;
+      }
       ampValue = amplitudePercent / 100.0; // Convert percent to 0.0-1.0
       systemState = RUN;
-      autoInjectionMode = false;
       countdownActive = false; // Tidak ada countdown otomatis di Quick mode
       
       // Update DAC sesuai amplitude
-      updateDAC();
+      applyDAC();
+      xSemaphoreGive(controlMutex);
+      logDAC();
       digitalWrite(RELAY_PIN, HIGH);
       digitalWrite(LED_RUN, HIGH);
       digitalWrite(LED_STOP, LOW);
@@ -3300,50 +3426,75 @@ void handleInjectAPI() {
       Serial.println(")");
       
       String msg = "{\"success\":true,\"message\":\"Quick: " + String(amplitudePercent) + "% set\"}";
-      server.send(200, "application/json", msg);
+      request->send(200, "application/json", msg);
     }
     
-    updateStatus();
+    statusRedrawPending = true;
   } else {
-    server.send(400, "application/json", "{\"error\":\"No data\"}");
+    request->send(400, "application/json", "{\"error\":\"No data\"}");
   }
 }
 
-void handleStopAPI() {
+void handleStopAPI(AsyncWebServerRequest* request) {
   // Stop injection - called from pengujian.html
+  stopAllOutput();
+  request->send(200, "application/json", "{\"success\":true,\"message\":\"Stopped\"}");
+}
+
+// Hentikan injeksi apa pun (manual, auto, sweep, plan) dan nolkan DAC
+void stopAllOutput() {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
   systemState = STOPPED;
   ampValue = 0.0;
   autoInjectionMode = false;
+  sweep.active = false;
+  planRunner.abort();
+  planRecording = false;
   targetReached = false;
   countdownActive = false;
-  updateDAC();
-  updateStatus();
+  applyDAC();
+  xSemaphoreGive(controlMutex);
+  logDAC();
+  calibSavePending = true;  // NVS ditulis loop(), pemanggil bisa handler async
+  statusRedrawPending = true;
   updateLEDsAndRelay();
-  
-  server.send(200, "application/json", "{\"success\":true,\"message\":\"Stopped\"}");
-}
-
-void handleGetStatus() {
-  // Debug: print current sensor values
-  Serial.print("Status Request - V:");
-  Serial.print(voltage);
-  Serial.print("V, I:");
-  Serial.print(currentA * 1000);
-  Serial.print("mA, R:");
-  Serial.print(resistanceVal);
-  Serial.println("Ω");
-  
+}
+
+void handleGetStatus(AsyncWebServerRequest* request) {
+  Measurement reading = readingSnapshot();
+  char volts[16], amps[16], ohms[16];
+  formatMilli(volts, sizeof(volts), reading.millivolts, 2);
+  formatMilli(amps, sizeof(amps), reading.milliamps, 3);
+  formatMilli(ohms, sizeof(ohms), reading.milliohms, 2);
+
   String json = "{";
-  json += "\"voltage\":" + String(voltage, 2) + ",";
-  json += "\"current\":" + String(currentA, 3) + ",";
-  json += "\"resistance\":" + String(resistanceVal, 2) + ",";
+  json += "\"voltage\":" + String(volts) + ",";
+  json += "\"current\":" + String(amps) + ",";
+  json += "\"resistance\":" + String(ohms) + ",";
   json += "\"state\":\"" + String(systemState == RUN ? "RUN" : (systemState == READY ? "READY" : "STOP")) + "\",";
   json += "\"amplitude\":" + String(ampValue, 3) + ",";
+  json += "\"modbusLatencyUs\":" + String(jsyMeters[JSY_DUT_METER].stats.lastLatencyUs) + ",";
+  json += "\"sampleAgeMs\":" + String(sampleAgeMs()) + ",";
+
+  // Meter referensi (jika dipasang) dengan umur sample masing-masing
+  for (uint8_t m = 1; m < jsyMeterCount; m++) {
+    portENTER_CRITICAL(&readingMux);
+    JsySample ref = jsyMeters[m].latest;
+    portEXIT_CRITICAL(&readingMux);
+    Measurement refReading = measurementFromRaw(ref.voltageRaw, ref.currentRaw, ref.timestampMs);
+    formatMilli(volts, sizeof(volts), refReading.millivolts, 2);
+    formatMilli(amps, sizeof(amps), refReading.milliamps, 3);
+    json += "\"" + String(jsyMeters[m].role) + "\":{";
+    json += "\"voltage\":" + String(volts) + ",";
+    json += "\"current\":" + String(amps) + ",";
+    json += "\"ageMs\":" + String(ref.timestampMs ? millis() - ref.timestampMs : UINT32_MAX) + "},";
+  }
+  json += "\"sampleIntervalMs\":" + String(sampleIntervalMs.load()) + ",";
   json += "\"countdownActive\":" + String(countdownActive ? "true" : "false") + ",";
   json += "\"autoInjectionActive\":" + String(autoInjectionMode ? "true" : "false") + ",";
   json += "\"targetReached\":" + String(targetReached ? "true" : "false") + ",";
   json += "\"wifiConnected\":" + String(wifiConnected ? "true" : "false") + ",";
-  json += "\"wifiSSID\":\"" + wifiSSID + "\",";
+  json += "\"wifiSSID\":\"" + currentWifiSSID() + "\",";
   
   // Add countdown time if active
   if (countdownActive) {
@@ -3362,41 +3513,237 @@ void handleGetStatus() {
   json += "\"menu\":\"" + String(currentMenu == MENU_RUNTIME ? "RUNTIME" : (currentMenu == MENU_RUN ? "RUN" : "STOP")) + "\"";
   json += "}";
   
-  server.send(200, "application/json", json);
+  request->send(200, "application/json", json);
+}
+
+// ------------------- Server-Sent Events -------------------
+// /events mendorong perubahan V/I/R/state begitu ada sample baru, pengganti
+// polling /status per detik. Klien baru dapat snapshot penuh; event
+// berikutnya hanya memuat field yang berubah (digabung di browser).
+struct LiveState {
+  int32_t millivolts;
+  int32_t milliamps;
+  int32_t milliohms;
+  int16_t ampPermille;
+  uint8_t state;
+  uint8_t menu;
+  bool autoInjection;
+  bool countdown;
+  bool targetReached;
+  bool wifi;
+  uint32_t countdownEndMs;
+};
+
+LiveState liveSnapshot() {
+  Measurement reading = readingSnapshot();
+  LiveState live;
+  live.millivolts = reading.millivolts;
+  live.milliamps = reading.milliamps;
+  live.milliohms = reading.milliohms;
+  live.ampPermille = (int16_t)(ampValue * 1000 + 0.5f);
+  live.state = systemState;
+  live.menu = currentMenu;
+  live.autoInjection = autoInjectionMode;
+  live.countdown = countdownActive;
+  live.targetReached = targetReached;
+  live.wifi = wifiConnected;
+  live.countdownEndMs = countdownActive ? countdownStart + countdownDuration : 0;
+  return live;
+}
+
+// prev == NULL: snapshot penuh. Return "" jika tidak ada yang berubah.
+String liveEventJson(const LiveState& now, const LiveState* prev) {
+  char buf[16];
+  String json;
+  if (!prev || now.millivolts != prev->millivolts) {
+    formatMilli(buf, sizeof(buf), now.millivolts, 2);
+    json += ",\"voltage\":" + String(buf);
+  }
+  if (!prev || now.milliamps != prev->milliamps) {
+    formatMilli(buf, sizeof(buf), now.milliamps, 3);
+    json += ",\"current\":" + String(buf);
+  }
+  if (!prev || now.milliohms != prev->milliohms) {
+    formatMilli(buf, sizeof(buf), now.milliohms, 2);
+    json += ",\"resistance\":" + String(buf);
+  }
+  if (!prev || now.ampPermille != prev->ampPermille) {
+    formatMilli(buf, sizeof(buf), now.ampPermille, 3);
+    json += ",\"amplitude\":" + String(buf);
+  }
+  if (!prev || now.state != prev->state) {
+    json += ",\"state\":\"" + String(now.state == RUN ? "RUN" : (now.state == READY ? "READY" : "STOP")) + "\"";
+  }
+  if (!prev || now.menu != prev->menu) {
+    json += ",\"menu\":\"" + String(now.menu == MENU_RUNTIME ? "RUNTIME" : (now.menu == MENU_RUN ? "RUN" : "STOP")) + "\"";
+  }
+  if (!prev || now.autoInjection != prev->autoInjection) {
+    json += ",\"autoInjectionActive\":" + String(now.autoInjection ? "true" : "false");
+  }
+  // Sisa waktu relatif (bukan millis() device yang tak bisa dibandingkan
+  // dengan jam browser); dikirim saat countdown mulai/berubah, selebihnya
+  // browser menghitung mundur sendiri
+  if (!prev || now.countdown != prev->countdown || now.countdownEndMs != prev->countdownEndMs) {
+    int32_t remainingMs = now.countdown ? (int32_t)(now.countdownEndMs - millis()) : 0;
+    json += ",\"countdownActive\":" + String(now.countdown ? "true" : "false");
+    json += ",\"countdownRemainingMs\":" + String(remainingMs > 0 ? remainingMs : 0);
+  }
+  if (!prev || now.targetReached != prev->targetReached) {
+    json += ",\"targetReached\":" + String(now.targetReached ? "true" : "false");
+  }
+  if (!prev || now.wifi != prev->wifi) {
+    json += ",\"wifiConnected\":" + String(now.wifi ? "true" : "false");
+    json += ",\"wifiSSID\":\"" + currentWifiSSID() + "\"";
+  }
+  if (json.length() == 0) return json;
+  json[0] = '{';
+  return json + "}";
+}
+
+// Dari task AsyncTCP. Snapshot langsung untuk klien ini, dan delta berikutnya
+// dibuat ulang dari snapshot penuh supaya tidak ada field yang tertinggal.
+void onEventsConnect(AsyncEventSourceClient* client) {
+  client->send(liveEventJson(liveSnapshot(), NULL).c_str(), "reading", millis());
+  liveResync = true;
+}
+
+// Dari loop(): kirim delta ke semua klien /events jika ada yang berubah
+void pushLiveEvents() {
+  static LiveState lastSent;
+  static bool haveLast = false;
+  if (liveResync.exchange(false)) haveLast = false;
+  if (!webServerMode || events.count() == 0) return;
+  LiveState now = liveSnapshot();
+  String json = liveEventJson(now, haveLast ? &lastSent : NULL);
+  if (json.length() == 0) return;
+  lastSent = now;
+  haveLast = true;
+  events.send(json.c_str(), "reading", millis());
+}
+
+// ------------------- Kanal Kontrol WebSocket -------------------
+// /ws membawa perintah dalam satu koneksi persisten. Frame teks
+// "<seq> <cmd> [arg]" dengan cmd: amp <0-100> | run [<0-100>] | stop | inject |
+// record. Balasan "<seq> ok [nilai]" atau "<seq> err <pesan>"; seq hanya
+// untuk mencocokkan balasan di browser. Tidak ada deduplikasi: browser tidak
+// mengirim ulang setelah reconnect (stop yang terputus diulang lewat
+// /api/stop, dan stop idempoten). State hasil perintah sampai lewat /events.
+
+// Eksekusi satu perintah; reply berisi "ok [nilai]" atau "err <pesan>"
+void runControlCommand(const char* cmd, const char* arg, String& reply) {
+  if (strcmp(cmd, "amp") == 0 || strcmp(cmd, "run") == 0) {
+    if (arg[0] != '\0') {
+      char* end;
+      float percent = strtof(arg, &end);
+      if (*end != '\0' || percent < 0 || percent > 100) {
+        reply = "err amplitude must be 0-100";
+        return;
+      }
+      if (!setAmplitudePercent(percent)) {
+        reply = "err injection, sweep or plan running";
+        return;
+      }
+    } else if (cmd[0] == 'a') {
+      reply = "err amp needs a value";
+      return;
+    }
+    if (cmd[0] == 'r') applyMenuState("RUN");
+    reply = "ok";
+  } else if (strcmp(cmd, "stop") == 0) {
+    stopAllOutput();
+    currentMenu = MENU_STOP;
+    reply = "ok";
+  } else if (strcmp(cmd, "inject") == 0) {
+    uint32_t rampMs;
+    // "ok <durasi s> <target mA>"
+    reply = startTargetInjection(rampMs) ? "ok " + String(rampMs / 1000.0f, 1) + " " + String(targetCurrentMa)
+                                         : "err injection, sweep or plan running";
+  } else if (strcmp(cmd, "record") == 0) {
+    String reason;
+    reply = startRecording(reason) ? String("ok 120") : "err " + reason;
+  } else {
+    reply = "err unknown command";
+  }
+}
+
+void onControlSocketEvent(AsyncWebSocket* socket, AsyncWebSocketClient* client, AwsEventType type, void* arg,
+                          uint8_t* data, size_t len) {
+  if (type != WS_EVT_DATA) return;
+
+  // Perintah selalu pendek: tolak frame terfragmentasi atau biner
+  AwsFrameInfo* info = (AwsFrameInfo*)arg;
+  if (!info->final || info->index != 0 || info->len != len || info->opcode != WS_TEXT || len >= WS_MAX_FRAME) {
+    client->text("0 err bad frame");
+    return;
+  }
+  char frame[WS_MAX_FRAME];
+  memcpy(frame, data, len);
+  frame[len] = '\0';
+
+  char* save;
+  char* seqText = strtok_r(frame, " ", &save);
+  char* cmd = strtok_r(NULL, " ", &save);
+  char* value = strtok_r(NULL, " ", &save);
+  uint32_t seq = seqText ? strtoul(seqText, NULL, 10) : 0;
+  if (seq == 0 || cmd == NULL) {
+    client->text("0 err expected <seq> <cmd> [arg]");
+    return;
+  }
+
+  String reply;
+  runControlCommand(cmd, value ? value : "", reply);
+  client->text(String(seq) + " " + reply);
+}
+
+// Amplitude manual; false (tidak diubah) jika injeksi/sweep/plan memegang DAC
+bool setAmplitudePercent(float percent) {
+  xSemaphoreTake(controlMutex, portMAX_DELAY);
+  if (outputBusy()) {
+    xSemaphoreGive(controlMutex);
+    return false;
+  }
+  ampValue = constrain(percent / 100.0, 0.0, 1.0);
+  applyDAC();
+  xSemaphoreGive(controlMutex);
+  logDAC();
+  return true;
 }
 
-void handleSetAmplitude() {
-  if (server.hasArg("value")) {
-    float newAmplitude = server.arg("value").toFloat() / 100.0;
-    ampValue = constrain(newAmplitude, 0.0, 1.0);
+// state: RUN | RUNTIME | STOP (seperti tombol menu di alat)
+void applyMenuState(const String& state) {
+  if (state == "RUN") {
+    systemState = RUN;
+    currentMenu = MENU_RUN;
+    countdownActive = false;
+  } else if (state == "RUNTIME") {
+    systemState = RUN;
+    currentMenu = MENU_RUNTIME;
+    countdownDuration = 2 * 60 * 1000UL; // 2 menit
+    countdownStart = millis();
+    countdownActive = true;
+  } else if (state == "STOP") {
+    systemState = STOPPED;
+    currentMenu = MENU_STOP;
+    countdownActive = false;
+    ampValue = 0.0;
     updateDAC();
-    server.send(200, "text/plain", "OK");
-  } else if (server.hasArg("state")) {
-    String state = server.arg("state");
-    if (state == "RUN") {
-      systemState = RUN;
-      currentMenu = MENU_RUN;
-      countdownActive = false;
-    } else if (state == "RUNTIME") {
-      systemState = RUN;
-      currentMenu = MENU_RUNTIME;
-      countdownDuration = 2 * 60 * 1000UL; // 2 menit
-      countdownStart = millis();
-      countdownActive = true;
-    } else if (state == "STOP") {
-      systemState = STOPPED;
-      currentMenu = MENU_STOP;
-      countdownActive = false;
-      ampValue = 0.0;
-      updateDAC();
+  }
+  statusRedrawPending = true;
+  updateLEDsAndRelay();
+}
+
+void handleSetAmplitude(AsyncWebServerRequest* request) {
+  if (request->hasArg("value")) {
+    if (setAmplitudePercent(request->arg("value").toFloat())) {
+      request->send(200, "text/plain", "OK");
+    } else {
+      request->send(409, "text/plain", "Injection, sweep or plan running");
     }
-    updateStatus();
-    updateTime();
-    updateLEDsAndRelay();
-    
-    server.send(200, "text/plain", "OK");
+  } else if (request->hasArg("state")) {
+    applyMenuState(request->arg("state"));
+    request->send(200, "text/plain", "OK");
   } else {
-    server.send(400, "text/plain", "Bad Request");
+    request->send(400, "text/plain", "Bad Request");
   }
 }
 
@@ -3406,13 +3753,14 @@ void setup() {
  Serial.println("Starting JSY1050 Dashboard...");
 
  // Load saved WiFi & cloud settings from NVS on boot
+ settingsMutex = xSemaphoreCreateMutex();
  loadSettingsFromMemory();
 
  tft.init();
   tft.setRotation(0);
   // starfieldIntro();
   drawFrame();
-  updateValues(0, 0, 0);
+  updateValues(dutReading);
   updateTime();
   updateStatus();
 
@@ -3426,14 +3774,41 @@ void setup() {
   pinMode(LED_RUNTIME, OUTPUT);
   pinMode(LED_STOP, OUTPUT);
   pinMode(LED_RUN, OUTPUT);
+  if (!dacOutputBegin()) {
+    Serial.println("⚠️ I2S DAC gagal, fallback dacWrite 8 bit");
+  }
   updateDAC();  // Set DAC awal ke 0
   pinMode(RELAY_PIN, OUTPUT);
   updateLEDsAndRelay();
 
-  SerialJSY.begin(9600, SERIAL_8N1, RXD_JSY, TXD_JSY);
-  node.begin(1, SerialJSY);
+  loadJSYMeters();
+  loadFilterSettings();
+  loadControllerSettings();
+  if (!jsyUartBegin(JSY_DEFAULT_BAUD)) {
+    Serial.println("⚠️ Gagal install UART driver JSY1050");
+  }
+  negotiateJSY1050Baud();
   Serial.println("Modbus JSY1050 initialized.");
+
+  xTaskCreatePinnedToCore(acquisitionTask, "jsy-acq", ACQ_TASK_STACK, NULL,
+                          ACQ_TASK_PRIORITY, &acquisitionTaskHandle, ACQ_TASK_CORE);
+
+  controlMutex = xSemaphoreCreateMutex();
+  Preferences preferences;
+  preferences.begin("core-settings", true);
+  uint8_t fixture = preferences.getUChar("calibFx", 0);
+  preferences.end();
+  loadCalibration(fixture < CALIB_FIXTURES ? fixture : 0);
+  xTaskCreatePinnedToCore(controlTask, "control", CONTROL_TASK_STACK, NULL,
+                          CONTROL_TASK_PRIORITY, &controlTaskHandle, CONTROL_TASK_CORE);
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = controlTimerCallback;
+  timerArgs.name = "control";
+  esp_timer_create(&timerArgs, &controlTimer);
+  esp_timer_start_periodic(controlTimer, CONTROL_PERIOD_MS * 1000ULL);
   
+  setupWebRoutes();
+
   // Configure web server switch pin
   pinMode(WEB_SERVER_SWITCH, INPUT_PULLUP);
   Serial.print("Web server switch configured on pin ");
@@ -3449,77 +3824,19 @@ void loop() {
     handleButtons();
     handleRotaryEncoder();
   } else {
-    // Handle web server requests
+    // Request HTTP dilayani AsyncTCP; di sini tinggal DNS
     handleWebServer();
   }
 
-  // Auto injection logic - Inject 200mA with precise amplitude control
-  if (autoInjectionMode) {
-    // Update every 50ms for faster response
-    if (millis() - lastAutoIncrement >= 50) {
-      lastAutoIncrement = millis();
-      
-      float currentMA = currentA * 1000.0f; // Convert to mA
-      float targetMA = targetCurrent * 1000.0f; // 200mA
-      float error = targetMA - currentMA;
-      
-      // Tolerance: ±5mA (very tight)
-      if (abs(error) <= 5.0f) {
-        // Within tolerance - target reached! Keep running at 200mA
-        if (!targetReached) {
-          targetReached = true;
-          Serial.println("✅ 200mA target reached! Ready for RECORD.");
-          Serial.print("   Current: ");
-          Serial.print(currentMA, 1);
-          Serial.print("mA, Amplitude: ");
-          Serial.print(ampValue * 100, 1);
-          Serial.println("%");
-        }
-        // Keep amplitude stable, don't adjust
-      } else if (currentMA < targetMA) {
-        // Current too low - increase amplitude
-        if (error > 50) {
-          ampValue += 0.01f; // Large error: +1%
-        } else if (error > 20) {
-          ampValue += 0.005f; // Medium error: +0.5%
-        } else {
-          ampValue += 0.001f; // Small error: +0.1%
-        }
-        
-        if (ampValue > 1.0f) ampValue = 1.0f;
-        updateDAC();
-        
-        Serial.print("📈 UP: ");
-        Serial.print(currentMA, 1);
-        Serial.print("mA → ");
-        Serial.print(targetMA, 0);
-        Serial.print("mA (");
-        Serial.print(ampValue * 100, 1);
-        Serial.println("%)");
-      } else {
-        // Current too high - decrease amplitude
-        if (error < -50) {
-          ampValue -= 0.01f; // Large overshoot: -1%
-        } else if (error < -20) {
-          ampValue -= 0.005f; // Medium overshoot: -0.5%
-        } else {
-          ampValue -= 0.001f; // Small overshoot: -0.1%
-        }
-        
-        if (ampValue < 0.0f) ampValue = 0.0f;
-        updateDAC();
-        
-        Serial.print("📉 DOWN: ");
-        Serial.print(currentMA, 1);
-        Serial.print("mA → ");
-        Serial.print(targetMA, 0);
-        Serial.print("mA (");
-        Serial.print(ampValue * 100, 1);
-        Serial.println("%)");
-      }
-    }
-  }
-  
+  finishSweep();
+  finishPlan();
+  reportSettled();
+  reportCalibJump();
+  runWebJobs();
+  persistSettings();
+  pushLiveEvents();
+  controlSocket.cleanupClients(WS_MAX_CLIENTS);
+
   // Timer countdown logic - stops injection after 2 minutes
   if (countdownActive && autoInjectionMode) {
     unsigned long elapsed = millis() - countdownStart;
@@ -3532,19 +3849,46 @@ void loop() {
   
   // Update time-based lamp functionality
   updateTimeBasedLamp();
+
+  updateSamplingRate();
   
   // Always update LEDs regardless of mode
   updateLEDsAndRelay();
 
-  if (millis() - lastRead >= READ_INTERVAL) {
-    lastRead = millis();
-    readJSY1050();
+  // Sample di-drain oleh controlTask; TFT hanya digambar ulang saat ada sample baru
+  static uint32_t lastDisplayedMs = 0;
+  Measurement reading = readingSnapshot();
+  if (reading.timestampMs != lastDisplayedMs) {
+    lastDisplayedMs = reading.timestampMs;
     // Only update V,I,R display when NOT in web server mode
     if (systemState == RUN && !webServerMode) {
-      updateValues(voltage, currentA, resistanceVal);
+      updateValues(reading);
     }
   }
 
+  // Ringkasan latency Modbus tiap 10 detik
+  if (millis() - lastModbusReport >= 10000) {
+    lastModbusReport = millis();
+    Serial.print("Modbus latency last/max: ");
+    Serial.print(jsyMeters[JSY_DUT_METER].stats.lastLatencyUs);
+    Serial.print("/");
+    Serial.print(jsyMeters[JSY_DUT_METER].stats.maxLatencyUs);
+    Serial.print(" us (");
+    Serial.print(jsyMeters[JSY_DUT_METER].stats.transactions());
+    Serial.print(" transaksi, dropped ");
+    Serial.print(jsyMeters[JSY_DUT_METER].samples.dropped());
+    Serial.println(")");
+
+    Serial.print("Control period min/max: ");
+    Serial.print(controlTiming.minPeriodUs);
+    Serial.print("/");
+    Serial.print(controlTiming.maxPeriodUs);
+    Serial.print(" us, jitter max ");
+    Serial.print(controlTiming.maxJitterUs);
+    Serial.print(" us, overruns ");
+    Serial.println(controlTiming.overruns);
+  }
+
   if (countdownActive && !webServerMode) {
     updateTime();
   }
@@ -0,0 +1,75 @@
+#ifndef MEASUREMENT_H
+#define MEASUREMENT_H
+
+// ------------------- Measurement Fixed-Point -------------------
+// Representasi V/I/R sebagai integer (mV, mA, mΩ) dari akuisisi sampai JSON,
+// supaya tidak ada pembagian float di jalur panas dan perbandingan toleransi
+// arus (±5 mA) menjadi eksak.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Di bawah arus ini resistansi tidak berarti (sama dengan batas 0.01 A lama)
+#define MEASUREMENT_MIN_CURRENT_MA 10
+
+struct Measurement {
+  int32_t millivolts;
+  int32_t milliamps;
+  int32_t milliohms;  // 0 jika arus di bawah MEASUREMENT_MIN_CURRENT_MA
+  uint32_t timestampMs;
+};
+
+inline int32_t measurementResistance(int32_t millivolts, int32_t milliamps) {
+  if (milliamps <= MEASUREMENT_MIN_CURRENT_MA) return 0;
+  return (int32_t)(((int64_t)millivolts * 1000) / milliamps);
+}
+
+// Register JSY1050 dalam satuan 0.01 V / 0.01 A
+inline Measurement measurementFromRaw(int32_t voltageRaw, int32_t currentRaw, uint32_t timestampMs) {
+  Measurement m;
+  m.millivolts = voltageRaw * 10;
+  m.milliamps = currentRaw * 10;
+  m.milliohms = measurementResistance(m.millivolts, m.milliamps);
+  m.timestampMs = timestampMs;
+  return m;
+}
+
+// Output filter Q8 (0.01 V / 0.01 A * 256) -> mV/mA dengan pembulatan; resolusi
+// EMA di bawah satu count register tetap terbawa ke kontrol arus
+inline int32_t milliFromRawQ8(int32_t rawQ8) {
+  int64_t scaled = (int64_t)rawQ8 * 10;
+  return (int32_t)(scaled >= 0 ? (scaled + 128) >> 8 : -((-scaled + 128) >> 8));
+}
+
+inline Measurement measurementFromRawQ8(int32_t voltageQ8, int32_t currentQ8, uint32_t timestampMs) {
+  Measurement m;
+  m.millivolts = milliFromRawQ8(voltageQ8);
+  m.milliamps = milliFromRawQ8(currentQ8);
+  m.milliohms = measurementResistance(m.millivolts, m.milliamps);
+  m.timestampMs = timestampMs;
+  return m;
+}
+
+// Format nilai milli-unit ke desimal, mis. (12345, 2) -> "12.35". Pembulatan
+// half-up di digit terakhir, tanpa float.
+inline size_t formatMilli(char* buf, size_t len, int32_t milli, uint8_t decimals) {
+  static const int32_t DIV[] = { 1000, 100, 10, 1 };
+  if (decimals > 3) decimals = 3;
+  int32_t step = DIV[decimals];
+  bool negative = milli < 0;
+  uint32_t mag = negative ? -(int64_t)milli : milli;
+  mag = (mag + step / 2) / step;  // sekarang dalam satuan 10^-decimals
+
+  uint32_t scale = 1000 / step;
+  int n;
+  if (decimals == 0) {
+    n = snprintf(buf, len, "%s%lu", negative ? "-" : "", (unsigned long)mag);
+  } else {
+    n = snprintf(buf, len, "%s%lu.%0*lu", negative ? "-" : "", (unsigned long)(mag / scale), decimals,
+                 (unsigned long)(mag % scale));
+  }
+  return n < 0 ? 0 : (size_t)n;
+}
+
+#endif
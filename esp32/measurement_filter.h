@@ -0,0 +1,120 @@
+#ifndef MEASUREMENT_FILTER_H
+#define MEASUREMENT_FILTER_H
+
+// ------------------- Pipeline Filter V/I -------------------
+// Rantai filter per sample, integer saja, biaya O(1) per sample:
+//   outlier rejection -> median-of-N -> EMA
+// Tiap stage bisa dimatikan lewat FilterConfig.
+
+#include <stdint.h>
+
+#define FILTER_MEDIAN_MAX 7
+
+struct FilterConfig {
+  uint8_t medianSize;        // 1 = mati, maksimal FILTER_MEDIAN_MAX (ganjil)
+  uint8_t emaShift;          // alpha = 1 / 2^shift, 0 = mati
+  int32_t outlierThreshold;  // |x - terakhir diterima| di atas ini ditolak, 0 = mati
+  uint8_t outlierRelock;     // setelah sekian penolakan berturut-turut, terima (step nyata)
+};
+
+class MeasurementFilter {
+ public:
+  MeasurementFilter() { configure(FilterConfig{1, 0, 0, 0}); }
+
+  void configure(const FilterConfig& config) {
+    _config = config;
+    if (_config.medianSize < 1) _config.medianSize = 1;
+    if (_config.medianSize > FILTER_MEDIAN_MAX) _config.medianSize = FILTER_MEDIAN_MAX;
+    if ((_config.medianSize & 1) == 0) _config.medianSize--;
+    if (_config.emaShift > 8) _config.emaShift = 8;
+    reset();
+  }
+
+  const FilterConfig& config() const { return _config; }
+
+  void reset() {
+    _count = 0;
+    _index = 0;
+    _primed = false;
+    _rejected = 0;
+    _lastAccepted = 0;
+    _emaQ8 = 0;
+    _outputQ8 = 0;
+  }
+
+  // Output dibulatkan ke satuan input
+  int32_t update(int32_t x) { return roundQ8(updateQ8(x)); }
+
+  // Output Q8 (satuan input * 256) tanpa pembulatan, supaya resolusi EMA
+  // tidak hilang sebelum dikonversi ke mV/mA
+  int32_t updateQ8(int32_t x) {
+    // 1. Outlier rejection terhadap nilai terakhir yang diterima
+    if (_config.outlierThreshold > 0 && _primed) {
+      int32_t delta = x - _lastAccepted;
+      if (delta < 0) delta = -delta;
+      if (delta > _config.outlierThreshold && _rejected < _config.outlierRelock) {
+        _rejected++;
+        return _outputQ8;
+      }
+    }
+    _rejected = 0;
+    _lastAccepted = x;
+
+    // 2. Median-of-N atas window geser
+    int32_t m = x;
+    if (_config.medianSize > 1) {
+      _window[_index] = x;
+      _index = (_index + 1) % _config.medianSize;
+      if (_count < _config.medianSize) _count++;
+      m = median();
+    }
+
+    // 3. EMA fixed-point Q8
+    if (_config.emaShift > 0) {
+      if (!_primed) {
+        _emaQ8 = m * 256;
+      } else {
+        _emaQ8 += (m * 256 - _emaQ8) >> _config.emaShift;
+      }
+      _outputQ8 = _emaQ8;
+    } else {
+      _outputQ8 = m * 256;
+    }
+
+    _primed = true;
+    return _outputQ8;
+  }
+
+  int32_t value() const { return roundQ8(_outputQ8); }
+  int32_t valueQ8() const { return _outputQ8; }
+
+ private:
+  static int32_t roundQ8(int32_t q8) { return (q8 + 128) >> 8; }
+
+  // Insertion sort atas salinan window; N <= 7 sehingga biaya konstan
+  int32_t median() const {
+    int32_t sorted[FILTER_MEDIAN_MAX];
+    for (uint8_t i = 0; i < _count; i++) {
+      int32_t v = _window[i];
+      int8_t j = i - 1;
+      while (j >= 0 && sorted[j] > v) {
+        sorted[j + 1] = sorted[j];
+        j--;
+      }
+      sorted[j + 1] = v;
+    }
+    return sorted[_count / 2];
+  }
+
+  FilterConfig _config;
+  int32_t _window[FILTER_MEDIAN_MAX];
+  uint8_t _count;
+  uint8_t _index;
+  bool _primed;
+  uint8_t _rejected;
+  int32_t _lastAccepted;
+  int32_t _emaQ8;
+  int32_t _outputQ8;
+};
+
+#endif
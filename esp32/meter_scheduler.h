@@ -0,0 +1,61 @@
+#ifndef METER_SCHEDULER_H
+#define METER_SCHEDULER_H
+
+// ------------------- Scheduler Polling Multi-Meter -------------------
+// Smooth weighted round-robin atas beberapa slave di bus RS-485 yang sama.
+// Meter hanya eligible setelah jeda minimumnya (interval sampling atau
+// turnaround meter, mana yang lebih besar) lewat sejak poll terakhir.
+// Saat bus jenuh (interval 0) bandwidth terbagi sesuai bobot.
+
+#include <stdint.h>
+
+#define JSY_MAX_METERS 4
+
+struct MeterSlot {
+  bool enabled;
+  uint8_t weight;
+  uint16_t turnaroundMs;  // waktu minimum meter siap menerima request berikutnya
+  int32_t credit;
+  uint32_t lastPollMs;
+  bool polled;            // false sampai poll pertama, supaya langsung eligible
+};
+
+// Return index meter berikutnya, atau -1 jika belum ada yang eligible;
+// waitMs diisi waktu sampai meter terdekat eligible.
+inline int8_t meterSchedulerNext(MeterSlot* slots, uint8_t count, uint32_t nowMs, uint32_t intervalMs,
+                                 uint32_t* waitMs) {
+  int32_t totalWeight = 0;
+  int8_t best = -1;
+  uint32_t minWait = UINT32_MAX;
+
+  for (uint8_t i = 0; i < count; i++) {
+    MeterSlot& slot = slots[i];
+    if (!slot.enabled || slot.weight == 0) continue;
+
+    uint32_t gap = slot.turnaroundMs > intervalMs ? slot.turnaroundMs : intervalMs;
+    uint32_t since = nowMs - slot.lastPollMs;
+    if (slot.polled && since < gap) {
+      if (gap - since < minWait) minWait = gap - since;
+      continue;
+    }
+
+    slot.credit += slot.weight;
+    totalWeight += slot.weight;
+    if (best < 0 || slot.credit > slots[best].credit) best = i;
+  }
+
+  if (best >= 0) {
+    slots[best].credit -= totalWeight;
+    *waitMs = 0;
+  } else {
+    *waitMs = minWait;
+  }
+  return best;
+}
+
+inline void meterSchedulerMarkPolled(MeterSlot& slot, uint32_t nowMs) {
+  slot.lastPollMs = nowMs;
+  slot.polled = true;
+}
+
+#endif
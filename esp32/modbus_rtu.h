@@ -0,0 +1,115 @@
+#ifndef MODBUS_RTU_H
+#define MODBUS_RTU_H
+
+// ------------------- Modbus RTU (master) -------------------
+// Protokol murni tanpa Arduino API: framing, CRC, dan state machine
+// transaksi. Transport (UART) diurus oleh pemanggil di main.cpp.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MODBUS_FC_READ_HOLDING   0x03
+#define MODBUS_FC_WRITE_MULTIPLE 0x10
+#define MODBUS_MAX_FRAME         256
+#define MODBUS_MAX_REGISTERS     125
+#define MODBUS_MAX_WRITE_REGS    8    // cukup untuk register konfigurasi
+
+enum ModbusStatus : uint8_t {
+  MB_IDLE = 0,     // tidak ada transaksi
+  MB_PENDING,      // request terkirim, menunggu response
+  MB_SUCCESS,
+  MB_TIMEOUT,
+  MB_CRC_ERROR,
+  MB_EXCEPTION,    // slave membalas exception (fc | 0x80)
+  MB_BAD_FRAME     // slave/function/length tidak cocok
+};
+
+uint16_t modbusCrc16(const uint8_t* data, size_t len);
+size_t modbusBuildReadHolding(uint8_t* out, uint8_t slave, uint16_t reg, uint16_t count);
+size_t modbusBuildWriteMultiple(uint8_t* out, uint8_t slave, uint16_t reg, uint16_t count,
+                                const uint16_t* values);
+
+// Master non-blocking: begin() menyiapkan request, feed() menerima byte
+// response, endOfFrame() menandai idle line (RX timeout UART), poll() cek
+// selesai/timeout. Hasil terminal dilaporkan poll() satu kali, lalu master
+// kembali MB_IDLE. Tidak bergantung Arduino/IDF sehingga bisa di-build di host.
+class ModbusAsyncMaster {
+ public:
+  explicit ModbusAsyncMaster(uint32_t responseTimeoutUs = 200000UL);
+
+  bool beginReadHolding(uint8_t slave, uint16_t reg, uint16_t count, uint32_t nowUs);
+  bool beginWriteMultiple(uint8_t slave, uint16_t reg, uint16_t count, const uint16_t* values,
+                          uint32_t nowUs);
+  const uint8_t* request() const { return _tx; }
+  size_t requestLength() const { return _txLen; }
+
+  void feed(const uint8_t* data, size_t len, uint32_t nowUs);
+  void endOfFrame(uint32_t nowUs);
+  ModbusStatus poll(uint32_t nowUs);
+
+  bool busy() const { return _state == MB_PENDING; }
+  uint16_t responseRegister(uint8_t index) const;
+  uint8_t exceptionCode() const { return _exception; }
+  uint32_t latencyUs() const { return _latencyUs; }
+
+ private:
+  ModbusStatus finish(ModbusStatus result, uint32_t nowUs);
+  ModbusStatus validate();
+
+  uint32_t _timeoutUs;
+  ModbusStatus _state;
+  uint8_t _slave;
+  uint8_t _function;
+  uint16_t _reg;
+  uint16_t _count;
+  uint8_t _tx[9 + 2 * MODBUS_MAX_WRITE_REGS];
+  size_t _txLen;
+  uint8_t _rx[MODBUS_MAX_FRAME];
+  size_t _rxLen;
+  size_t _expectedLen;
+  bool _frameEnded;
+  uint16_t _regs[MODBUS_MAX_REGISTERS];
+  uint8_t _exception;
+  uint32_t _startUs;
+  uint32_t _latencyUs;
+};
+
+// ------------------- Statistik Link -------------------
+// Counter per hasil transaksi + histogram latency (batas atas bucket dalam ms,
+// bucket terakhir = di atas batas terakhir).
+#define MODBUS_LATENCY_BUCKETS 7
+static const uint16_t MODBUS_LATENCY_EDGES_MS[MODBUS_LATENCY_BUCKETS - 1] = { 5, 10, 20, 50, 100, 200 };
+
+struct ModbusLinkStats {
+  uint32_t success;
+  uint32_t timeout;
+  uint32_t crcError;
+  uint32_t exception;
+  uint32_t badFrame;
+  uint32_t retries;
+  uint32_t lastLatencyUs;
+  uint32_t maxLatencyUs;
+  uint32_t latencyHistogram[MODBUS_LATENCY_BUCKETS];
+
+  void record(ModbusStatus result, uint32_t latencyUs) {
+    switch (result) {
+      case MB_SUCCESS:   success++; break;
+      case MB_TIMEOUT:   timeout++; break;
+      case MB_CRC_ERROR: crcError++; break;
+      case MB_EXCEPTION: exception++; break;
+      case MB_BAD_FRAME: badFrame++; break;
+      default: return;
+    }
+    lastLatencyUs = latencyUs;
+    if (latencyUs > maxLatencyUs) maxLatencyUs = latencyUs;
+
+    uint32_t ms = latencyUs / 1000;
+    uint8_t bucket = 0;
+    while (bucket < MODBUS_LATENCY_BUCKETS - 1 && ms >= MODBUS_LATENCY_EDGES_MS[bucket]) bucket++;
+    latencyHistogram[bucket]++;
+  }
+
+  uint32_t transactions() const { return success + timeout + crcError + exception + badFrame; }
+};
+
+#endif
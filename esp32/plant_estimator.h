@@ -0,0 +1,89 @@
+#ifndef PLANT_ESTIMATOR_H
+#define PLANT_ESTIMATOR_H
+
+// ------------------- Estimator Model Plant -------------------
+// Model sederhana rangkaian injeksi:
+//   V = k * amp   (tegangan sumber per unit amplitude, mV)
+//   V = R * I     (resistansi DUT, mV/mA = ohm)
+// Keduanya diestimasi dengan recursive least squares skalar plus forgetting
+// factor, sehingga drive untuk arus target bisa dihitung langsung:
+//   amp = R * I_target / k
+
+#include <stdint.h>
+
+class ScalarRls {
+ public:
+  ScalarRls() : _lambda(0.95f), _p0(100.0f) { reset(0.0f); }
+
+  void configure(float lambda, float p0) {
+    _lambda = lambda;
+    _p0 = p0;
+  }
+
+  void reset(float theta) {
+    _theta = theta;
+    _p = _p0;
+    _samples = 0;
+  }
+
+  // Satu observasi y = theta * x
+  void update(float x, float y) {
+    float px = _p * x;
+    float gain = px / (_lambda + x * px);
+    _theta += gain * (y - _theta * x);
+    _p = (_p - gain * px) / _lambda;
+    if (_samples < UINT16_MAX) _samples++;
+  }
+
+  float estimate() const { return _theta; }
+  float covariance() const { return _p; }
+  uint16_t samples() const { return _samples; }
+
+ private:
+  float _lambda;
+  float _p0;
+  float _theta;
+  float _p;
+  uint16_t _samples;
+};
+
+#define PLANT_MIN_SAMPLES 5
+#define PLANT_MIN_AMP     0.02f  // di bawah ini noise DAC/offset mendominasi
+
+class PlantEstimator {
+ public:
+  // Resistansi diukur ulang per DUT; gain drive (milik fixture) dipertahankan antar run
+  void resetResistance() { _resistance.reset(0.0f); }
+
+  void reset() {
+    _resistance.reset(0.0f);
+    _drive.reset(0.0f);
+  }
+
+  void update(int32_t millivolts, int32_t milliamps, float amp, int32_t minCurrentMa) {
+    if (milliamps > minCurrentMa) _resistance.update((float)milliamps, (float)millivolts);
+    if (amp > PLANT_MIN_AMP) _drive.update(amp, (float)millivolts);
+  }
+
+  bool ready() const {
+    return _resistance.samples() >= PLANT_MIN_SAMPLES && _drive.samples() >= PLANT_MIN_SAMPLES &&
+           _resistance.estimate() > 0 && _drive.estimate() > 0;
+  }
+
+  float resistanceOhm() const { return _resistance.estimate(); }
+  float driveMvPerAmp() const { return _drive.estimate(); }
+
+  // Amplitude untuk arus target, -1 jika model belum siap
+  float predictAmp(int32_t targetMa) const {
+    if (!ready()) return -1.0f;
+    float amp = _resistance.estimate() * targetMa / _drive.estimate();
+    if (amp < 0) return 0;
+    return amp > 1 ? 1 : amp;
+  }
+
+ private:
+  ScalarRls _resistance;
+  ScalarRls _drive;
+};
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef RAMP_PROFILE_H
+#define RAMP_PROFILE_H
+
+// ------------------- Profil Ramp Setpoint -------------------
+// Setpoint arus bergerak dari titik awal ke target mengikuti profil bernama.
+// Bentuk profil dihitung sekali ke tabel progress (Q15) pada titik waktu
+// seragam; tiap langkah kontrol cukup interpolasi integer. Durasi dipilih
+// sehingga slew puncak profil tidak melebihi batas mA/s.
+
+#include <stdint.h>
+#include <string.h>
+
+#define RAMP_TABLE_SIZE 33  // 32 segmen
+#define RAMP_Q15        32768
+#define RAMP_TRAPEZOID_ACCEL 0.25f  // fraksi waktu akselerasi / deselerasi
+
+enum RampShape : uint8_t {
+  RAMP_STEP = 0,   // langsung ke target (perilaku lama)
+  RAMP_LINEAR,
+  RAMP_TRAPEZOID,
+  RAMP_SCURVE,     // smoothstep 3t^2 - 2t^3
+  RAMP_SHAPE_COUNT
+};
+
+static const char* const RAMP_SHAPE_NAMES[RAMP_SHAPE_COUNT] = { "step", "linear", "trapezoid", "scurve" };
+
+inline int8_t rampShapeFromName(const char* name) {
+  for (uint8_t i = 0; i < RAMP_SHAPE_COUNT; i++) {
+    if (strcmp(name, RAMP_SHAPE_NAMES[i]) == 0) return i;
+  }
+  return -1;
+}
+
+// Slope puncak relatif terhadap ramp linear dengan durasi sama
+inline float rampPeakSlope(RampShape shape) {
+  switch (shape) {
+    case RAMP_LINEAR: return 1.0f;
+    case RAMP_TRAPEZOID: return 1.0f / (1.0f - RAMP_TRAPEZOID_ACCEL);
+    case RAMP_SCURVE: return 1.5f;
+    default: return 0.0f;
+  }
+}
+
+struct RampProfile {
+  RampShape shape;
+  uint16_t table[RAMP_TABLE_SIZE];  // progress Q15 di t = i / (RAMP_TABLE_SIZE - 1)
+};
+
+inline void rampBuildProfile(RampProfile& profile, RampShape shape) {
+  profile.shape = shape;
+  const float a = RAMP_TRAPEZOID_ACCEL;
+  const float peak = 1.0f / (1.0f - a);
+  for (uint8_t i = 0; i < RAMP_TABLE_SIZE; i++) {
+    float t = (float)i / (RAMP_TABLE_SIZE - 1);
+    float p;
+    switch (shape) {
+      case RAMP_LINEAR:
+        p = t;
+        break;
+      case RAMP_TRAPEZOID:
+        if (t < a) p = peak * t * t / (2 * a);
+        else if (t > 1 - a) p = 1 - peak * (1 - t) * (1 - t) / (2 * a);
+        else p = peak * (t - a / 2);
+        break;
+      case RAMP_SCURVE:
+        p = t * t * (3 - 2 * t);
+        break;
+      default:
+        p = 1.0f;
+        break;
+    }
+    profile.table[i] = (uint16_t)(p * RAMP_Q15 + 0.5f);
+  }
+}
+
+// Durasi ramp: minimal minDurationMs, diperpanjang jika slew puncak melebihi
+// maxSlewMaPerSec (0 = tanpa batas)
+inline uint32_t rampDurationMs(RampShape shape, int32_t fromMa, int32_t toMa, uint32_t minDurationMs,
+                               uint32_t maxSlewMaPerSec) {
+  if (shape == RAMP_STEP) return 0;
+  int32_t delta = toMa > fromMa ? toMa - fromMa : fromMa - toMa;
+  uint32_t duration = minDurationMs;
+  if (maxSlewMaPerSec > 0) {
+    uint32_t slewMs = (uint32_t)(delta * rampPeakSlope(shape) * 1000.0f / maxSlewMaPerSec + 0.5f);
+    if (slewMs > duration) duration = slewMs;
+  }
+  return duration;
+}
+
+// Setpoint pada elapsedMs; setelah durasi habis selalu toMa
+inline int32_t rampSetpoint(const RampProfile& profile, int32_t fromMa, int32_t toMa, uint32_t elapsedMs,
+                            uint32_t durationMs) {
+  if (durationMs == 0 || elapsedMs >= durationMs) return toMa;
+  uint32_t pos = (uint32_t)(((uint64_t)elapsedMs * (RAMP_TABLE_SIZE - 1) << 8) / durationMs);  // Q8 index
+  uint32_t i = pos >> 8;
+  uint32_t frac = pos & 0xFF;
+  int32_t p = profile.table[i] + (((int32_t)profile.table[i + 1] - profile.table[i]) * (int32_t)frac >> 8);
+  return fromMa + (int32_t)(((int64_t)(toMa - fromMa) * p) / RAMP_Q15);
+}
+
+#endif
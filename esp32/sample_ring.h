@@ -0,0 +1,56 @@
+#ifndef SAMPLE_RING_H
+#define SAMPLE_RING_H
+
+// ------------------- Ring buffer SPSC lock-free -------------------
+// Satu producer (task akuisisi) dan satu consumer (loop). Head hanya
+// ditulis producer, tail hanya ditulis consumer, jadi cukup atomic
+// acquire/release tanpa mutex. N harus pangkat dua.
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+template <typename T, size_t N>
+class SampleRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SampleRing size must be a power of two");
+
+ public:
+  SampleRing() : _head(0), _tail(0), _dropped(0) {}
+
+  // Producer. Jika penuh sample dibuang dan dihitung di dropped().
+  bool push(const T& item) {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    uint32_t tail = _tail.load(std::memory_order_acquire);
+    if (head - tail >= N) {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    _items[head & (N - 1)] = item;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer.
+  bool pop(T& item) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    uint32_t head = _head.load(std::memory_order_acquire);
+    if (tail == head) return false;
+    item = _items[tail & (N - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  size_t size() const {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+
+  uint32_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+ private:
+  T _items[N];
+  std::atomic<uint32_t> _head;
+  std::atomic<uint32_t> _tail;
+  std::atomic<uint32_t> _dropped;
+};
+
+#endif
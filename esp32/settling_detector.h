@@ -0,0 +1,77 @@
+#ifndef SETTLING_DETECTOR_H
+#define SETTLING_DETECTOR_H
+
+// ------------------- Deteksi Settling Arus -------------------
+// Window geser N sample dengan jumlah dan jumlah kuadrat berjalan (O(1) per
+// sample). Settled jika window penuh, rata-rata dalam toleransi target, dan
+// varians di bawah batas, jadi satu sample kebetulan masuk band tidak cukup.
+
+#include <stdint.h>
+
+#define SETTLING_WINDOW_MAX 32
+
+class SettlingDetector {
+ public:
+  SettlingDetector() : _window(8), _toleranceMa(5), _maxVarianceMa2(9) { reset(); }
+
+  void configure(uint8_t window, int32_t toleranceMa, int32_t maxVarianceMa2) {
+    if (window < 2) window = 2;
+    if (window > SETTLING_WINDOW_MAX) window = SETTLING_WINDOW_MAX;
+    _window = window;
+    _toleranceMa = toleranceMa;
+    _maxVarianceMa2 = maxVarianceMa2;
+    reset();
+  }
+
+  void reset() {
+    _count = 0;
+    _index = 0;
+    _sum = 0;
+    _sumSq = 0;
+  }
+
+  void update(int32_t milliamps) {
+    if (_count == _window) {
+      int32_t old = _samples[_index];
+      _sum -= old;
+      _sumSq -= (int64_t)old * old;
+    } else {
+      _count++;
+    }
+    _samples[_index] = milliamps;
+    _sum += milliamps;
+    _sumSq += (int64_t)milliamps * milliamps;
+    _index = (_index + 1) % _window;
+  }
+
+  bool full() const { return _count == _window; }
+
+  int32_t mean() const { return _count ? (int32_t)(_sum / _count) : 0; }
+
+  // Varians populasi dalam mA^2: (n*sumSq - sum^2) / n^2
+  int32_t variance() const {
+    if (_count < 2) return 0;
+    int64_t n = _count;
+    return (int32_t)((n * _sumSq - _sum * _sum) / (n * n));
+  }
+
+  // Rata-rata dibandingkan eksak: |sum - n*target| <= n*tol
+  bool settled(int32_t targetMa) const {
+    if (!full()) return false;
+    int64_t offset = _sum - (int64_t)_count * targetMa;
+    if (offset < 0) offset = -offset;
+    return offset <= (int64_t)_count * _toleranceMa && variance() <= _maxVarianceMa2;
+  }
+
+ private:
+  uint8_t _window;
+  int32_t _toleranceMa;
+  int32_t _maxVarianceMa2;
+  int32_t _samples[SETTLING_WINDOW_MAX];
+  uint8_t _count;
+  uint8_t _index;
+  int64_t _sum;
+  int64_t _sumSq;
+};
+
+#endif
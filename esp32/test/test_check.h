@@ -0,0 +1,37 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+// Assert minimal untuk test host (tanpa framework): hitung gagal, lanjut jalan.
+
+#include <stdio.h>
+
+static int testFailures = 0;
+
+#define CHECK(cond)                                                     \
+  do {                                                                  \
+    if (!(cond)) {                                                      \
+      fprintf(stderr, "%s:%d: CHECK gagal: %s\n", __FILE__, __LINE__, #cond); \
+      testFailures++;                                                   \
+    }                                                                   \
+  } while (0)
+
+#define CHECK_EQ(a, b)                                                  \
+  do {                                                                  \
+    long long _a = (long long)(a), _b = (long long)(b);                 \
+    if (_a != _b) {                                                     \
+      fprintf(stderr, "%s:%d: CHECK_EQ gagal: %s = %lld, %s = %lld\n",  \
+              __FILE__, __LINE__, #a, _a, #b, _b);                      \
+      testFailures++;                                                   \
+    }                                                                   \
+  } while (0)
+
+static int testResult(const char* name) {
+  if (testFailures == 0) {
+    printf("%s: OK\n", name);
+    return 0;
+  }
+  printf("%s: %d gagal\n", name, testFailures);
+  return 1;
+}
+
+#endif
@@ -0,0 +1,70 @@
+// Test host untuk dac_dither.h: rata-rata pola sama persis dengan level 8.8,
+// tepi 0 dan DITHER_LEVEL_MAX, serta pembulatan amp -> level -> kode.
+
+#include "../dac_dither.h"
+#include "test_check.h"
+
+static unsigned long patternSum(const uint8_t* p, size_t n) {
+  unsigned long sum = 0;
+  for (size_t i = 0; i < n; i++) sum += p[i];
+  return sum;
+}
+
+static void testSumEqualsLevel() {
+  uint8_t pattern[256];
+  // 256 sample: jumlah kode = level 8.8 persis, untuk semua level
+  for (uint32_t level = 0; level <= DITHER_LEVEL_MAX; level++) {
+    ditherFill(pattern, sizeof(pattern), (uint16_t)level);
+    if (patternSum(pattern, sizeof(pattern)) != level) {
+      CHECK_EQ(patternSum(pattern, sizeof(pattern)), level);
+      break;
+    }
+  }
+  // Kelipatan 256 juga tanpa error rata-rata
+  uint8_t longPattern[1024];
+  ditherFill(longPattern, sizeof(longPattern), 0x1234);
+  CHECK_EQ(patternSum(longPattern, sizeof(longPattern)), 4ul * 0x1234);
+}
+
+static void testEdges() {
+  uint8_t pattern[256];
+  ditherFill(pattern, sizeof(pattern), 0);
+  CHECK_EQ(patternSum(pattern, sizeof(pattern)), 0);
+
+  ditherFill(pattern, sizeof(pattern), 0xFF00);
+  bool allMax = true;
+  for (size_t i = 0; i < sizeof(pattern); i++) allMax = allMax && pattern[i] == 255;
+  CHECK(allMax);
+
+  // Di atas maksimum dipotong ke 0xFF00, bukan overflow ke kode 0
+  ditherFill(pattern, sizeof(pattern), 0xFFFF);
+  CHECK_EQ(patternSum(pattern, sizeof(pattern)), 0xFF00);
+
+  // Pola hanya berisi dua kode bertetangga
+  ditherFill(pattern, sizeof(pattern), (100u << 8) | 0x80);
+  bool adjacent = true;
+  for (size_t i = 0; i < sizeof(pattern); i++) adjacent = adjacent && (pattern[i] == 100 || pattern[i] == 101);
+  CHECK(adjacent);
+}
+
+static void testLevelFromAmp() {
+  CHECK_EQ(ditherLevelFromAmp(-0.5f), 0);
+  CHECK_EQ(ditherLevelFromAmp(0.0f), 0);
+  CHECK_EQ(ditherLevelFromAmp(1.0f), 0xFF00);
+  CHECK_EQ(ditherLevelFromAmp(2.0f), 0xFF00);
+  CHECK_EQ(ditherLevelFromAmp(0.5f), 0x7F80);
+  CHECK_EQ(ditherLevelFromAmp(100.0f / 255.0f), 100u << 8);
+
+  CHECK_EQ(ditherCodeFromLevel(0), 0);
+  CHECK_EQ(ditherCodeFromLevel((100u << 8) | 0x7F), 100);
+  CHECK_EQ(ditherCodeFromLevel((100u << 8) | 0x80), 101);
+  CHECK_EQ(ditherCodeFromLevel(0xFF00), 255);
+  CHECK_EQ(ditherCodeFromLevel(0xFFFF), 255);
+}
+
+int main() {
+  testSumEqualsLevel();
+  testEdges();
+  testLevelFromAmp();
+  return testResult("dac_dither");
+}
@@ -0,0 +1,182 @@
+// Test host untuk modbus_rtu.cpp: CRC, build/parse FC03/FC10, penolakan
+// frame rusak, dan timeout. Dengan argumen "bench" juga mengukur throughput.
+
+#include <string.h>
+#include <time.h>
+
+#include "../modbus_rtu.h"
+#include "test_check.h"
+
+static void appendCrc(uint8_t* frame, size_t len) {
+  uint16_t crc = modbusCrc16(frame, len);
+  frame[len] = crc & 0xFF;
+  frame[len + 1] = crc >> 8;
+}
+
+static void testCrcVectors() {
+  const uint8_t check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+  CHECK_EQ(modbusCrc16(check, sizeof(check)), 0x4B37);  // check value CRC-16/MODBUS
+  CHECK_EQ(modbusCrc16(check, 0), 0xFFFF);
+  const uint8_t read10[] = { 0x01, 0x03, 0x00, 0x00, 0x00, 0x0A };
+  CHECK_EQ(modbusCrc16(read10, sizeof(read10)), 0xCDC5);  // di kabel: C5 CD
+}
+
+static void testBuildFrames() {
+  uint8_t out[32];
+  const uint8_t expectedRead[] = { 0x01, 0x03, 0x00, 0x00, 0x00, 0x0A, 0xC5, 0xCD };
+  CHECK_EQ(modbusBuildReadHolding(out, 1, 0x0000, 10), 8);
+  CHECK(memcmp(out, expectedRead, 8) == 0);
+
+  const uint16_t values[] = { 0x1234, 0x0006 };
+  size_t len = modbusBuildWriteMultiple(out, 0x02, 0x0004, 2, values);
+  CHECK_EQ(len, 13);
+  const uint8_t expectedHead[] = { 0x02, 0x10, 0x00, 0x04, 0x00, 0x02, 0x04, 0x12, 0x34, 0x00, 0x06 };
+  CHECK(memcmp(out, expectedHead, sizeof(expectedHead)) == 0);
+  CHECK_EQ(modbusCrc16(out, len), 0);  // CRC atas frame utuh termasuk CRC = 0
+}
+
+static void testReadHoldingResponse() {
+  ModbusAsyncMaster master(1000);
+  CHECK(master.beginReadHolding(1, 0x0048, 2, 0));
+  CHECK(!master.beginReadHolding(1, 0x0048, 2, 0));  // masih pending
+  CHECK_EQ(master.requestLength(), 8);
+
+  uint8_t rx[16] = { 0x01, 0x03, 0x04, 0x12, 0x34, 0xAB, 0xCD };
+  appendCrc(rx, 7);
+  master.feed(rx, 4, 100);
+  CHECK_EQ(master.poll(150), MB_PENDING);
+  master.feed(rx + 4, 5, 200);
+  CHECK_EQ(master.poll(250), MB_SUCCESS);
+  CHECK_EQ(master.responseRegister(0), 0x1234);
+  CHECK_EQ(master.responseRegister(1), 0xABCD);
+  CHECK_EQ(master.responseRegister(2), 0);
+  CHECK_EQ(master.latencyUs(), 250);
+  CHECK_EQ(master.poll(300), MB_IDLE);  // hasil terminal hanya sekali
+}
+
+static void testWriteMultipleResponse() {
+  ModbusAsyncMaster master(1000);
+  const uint16_t values[] = { 0x0006 };
+  CHECK(master.beginWriteMultiple(1, 0x0004, 1, values, 0));
+  uint8_t echo[8] = { 0x01, 0x10, 0x00, 0x04, 0x00, 0x01 };
+  appendCrc(echo, 6);
+  master.feed(echo, sizeof(echo), 10);
+  CHECK_EQ(master.poll(20), MB_SUCCESS);
+
+  // Echo register yang salah
+  CHECK(master.beginWriteMultiple(1, 0x0004, 1, values, 0));
+  echo[3] = 0x05;
+  appendCrc(echo, 6);
+  master.feed(echo, sizeof(echo), 10);
+  CHECK_EQ(master.poll(20), MB_BAD_FRAME);
+}
+
+static void testRejections() {
+  ModbusAsyncMaster master(1000);
+
+  // Exception: fc | 0x80, kode 02
+  CHECK(master.beginReadHolding(1, 0, 2, 0));
+  uint8_t ex[5] = { 0x01, 0x83, 0x02 };
+  appendCrc(ex, 3);
+  master.feed(ex, sizeof(ex), 10);
+  CHECK_EQ(master.poll(20), MB_EXCEPTION);
+  CHECK_EQ(master.exceptionCode(), 0x02);
+
+  // CRC rusak
+  CHECK(master.beginReadHolding(1, 0, 1, 0));
+  uint8_t rx[7] = { 0x01, 0x03, 0x02, 0x00, 0x2A };
+  appendCrc(rx, 5);
+  rx[6] ^= 0xFF;
+  master.feed(rx, sizeof(rx), 10);
+  CHECK_EQ(master.poll(20), MB_CRC_ERROR);
+
+  // Frame pendek ditutup idle line
+  CHECK(master.beginReadHolding(1, 0, 1, 0));
+  master.feed(rx, 4, 10);
+  master.endOfFrame(15);
+  CHECK_EQ(master.poll(20), MB_BAD_FRAME);
+
+  // Slave lain menjawab
+  CHECK(master.beginReadHolding(1, 0, 1, 0));
+  uint8_t other[7] = { 0x02, 0x03, 0x02, 0x00, 0x2A };
+  appendCrc(other, 5);
+  master.feed(other, sizeof(other), 10);
+  CHECK_EQ(master.poll(20), MB_BAD_FRAME);
+
+  // Byte count tidak cocok
+  CHECK(master.beginReadHolding(1, 0, 1, 0));
+  uint8_t count[7] = { 0x01, 0x03, 0x04, 0x00, 0x2A };
+  appendCrc(count, 5);
+  master.feed(count, sizeof(count), 10);
+  CHECK_EQ(master.poll(20), MB_BAD_FRAME);
+
+  // Byte di luar transaksi dibuang
+  master.feed(rx, sizeof(rx), 30);
+  CHECK_EQ(master.poll(40), MB_IDLE);
+}
+
+static void testTimeout() {
+  ModbusAsyncMaster master(1000);
+  CHECK(master.beginReadHolding(1, 0, 1, 0xFFFFFF00u));  // melewati wrap uint32
+  CHECK_EQ(master.poll(0xFFFFFF00u + 999), MB_PENDING);
+  CHECK_EQ(master.poll(0xFFFFFF00u + 1000), MB_TIMEOUT);
+  CHECK_EQ(master.latencyUs(), 1000);
+
+  ModbusLinkStats stats = {};
+  stats.record(MB_SUCCESS, 3000);
+  stats.record(MB_TIMEOUT, 200000);
+  stats.record(MB_CRC_ERROR, 12000);
+  stats.record(MB_PENDING, 1);  // bukan hasil terminal, diabaikan
+  CHECK_EQ(stats.transactions(), 3);
+  CHECK_EQ(stats.timeout, 1);
+  CHECK_EQ(stats.maxLatencyUs, 200000);
+  CHECK_EQ(stats.lastLatencyUs, 12000);
+  CHECK_EQ(stats.latencyHistogram[0], 1);  // < 5 ms
+  CHECK_EQ(stats.latencyHistogram[2], 1);  // 10-20 ms
+  CHECK_EQ(stats.latencyHistogram[6], 1);  // >= 200 ms
+}
+
+static double secondsSince(const timespec& start) {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start.tv_sec) + (now.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+static void benchmark() {
+  uint8_t buf[256];
+  for (int i = 0; i < 256; i++) buf[i] = i * 37;
+  const int rounds = 200000;
+  volatile uint16_t sink = 0;
+
+  timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = 0; i < rounds; i++) sink ^= modbusCrc16(buf, sizeof(buf));
+  double crcSec = secondsSince(start);
+  printf("CRC16: %.1f MB/s\n", rounds * sizeof(buf) / crcSec / 1e6);
+
+  // Satu transaksi FC03 10 register lengkap: build, feed, validasi
+  uint8_t rx[25] = { 0x01, 0x03, 20 };
+  appendCrc(rx, 23);
+  ModbusAsyncMaster master(1000);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = 0; i < rounds; i++) {
+    master.beginReadHolding(1, 0, 10, 0);
+    master.feed(rx, sizeof(rx), 1);
+    sink ^= master.poll(2);
+  }
+  double frameSec = secondsSince(start);
+  printf("FC03 x10 register: %.0f transaksi/s (%.2f us/transaksi)\n", rounds / frameSec,
+         frameSec / rounds * 1e6);
+  (void)sink;
+}
+
+int main(int argc, char** argv) {
+  testCrcVectors();
+  testBuildFrames();
+  testReadHoldingResponse();
+  testWriteMultipleResponse();
+  testRejections();
+  testTimeout();
+  if (argc > 1 && strcmp(argv[1], "bench") == 0) benchmark();
+  return testResult("modbus_rtu");
+}
@@ -0,0 +1,203 @@
+// Test host untuk test_plan.h: urutan step (ramp, hold+rekam, repeat,
+// fixture), gagal saat settle timeout, dan abort di tengah plan.
+
+#include <string.h>
+
+#include "../test_plan.h"
+#include "test_check.h"
+
+// Hooks palsu: mencatat panggilan ke log teks, settled/fixture dikendalikan test
+class FakeHooks : public PlanHooks {
+ public:
+  FakeHooks() : settled(false), fixtureReady(true), stops(0) { log[0] = '\0'; }
+
+  void planRamp(int32_t milliamps) override {
+    append("R%ld ", milliamps);
+    settled = false;
+  }
+  bool planSettled() override { return settled; }
+  void planRecord(bool on, uint8_t step) override { append(on ? "rec%ld " : "end%ld ", step); }
+  bool planFixture(uint8_t fixture) override {
+    append("F%ld ", fixture);
+    return fixtureReady;
+  }
+  void planStop() override {
+    append("S ");
+    stops++;
+  }
+
+  bool settled;
+  bool fixtureReady;
+  int stops;
+  char log[256];
+
+ private:
+  void append(const char* format, long value = 0) {
+    size_t len = strlen(log);
+    snprintf(log + len, sizeof(log) - len, format, value);
+  }
+};
+
+static PlanStep step(PlanOp op, int32_t value = 0, uint32_t durationMs = 0, uint16_t arg = 0, uint8_t flag = 0) {
+  PlanStep s;
+  s.op = op;
+  s.flag = flag;
+  s.arg = arg;
+  s.value = value;
+  s.durationMs = durationMs;
+  return s;
+}
+
+static void testSequencing() {
+  // ramp 100, hold 1 s rekam, ramp 200, hold 1 s, repeat ke step 2 sekali, fixture 3
+  TestPlan plan;
+  plan.count = 0;
+  plan.steps[plan.count++] = step(PLAN_OP_RAMP, 100);
+  plan.steps[plan.count++] = step(PLAN_OP_HOLD, 0, 1000, 0, 1);
+  plan.steps[plan.count++] = step(PLAN_OP_RAMP, 200);
+  plan.steps[plan.count++] = step(PLAN_OP_HOLD, 0, 1000);
+  plan.steps[plan.count++] = step(PLAN_OP_REPEAT, 1, 0, 2);
+  plan.steps[plan.count++] = step(PLAN_OP_FIXTURE, 0, 0, 3);
+
+  PlanRunner runner;
+  FakeHooks hooks;
+  CHECK_EQ(runner.status(), PLAN_IDLE);
+  runner.start(plan);
+  CHECK_EQ(runner.status(), PLAN_RUNNING);
+
+  uint32_t now = 0;
+  CHECK_EQ(runner.poll(now, hooks), PLAN_RUNNING);
+  CHECK_EQ(runner.stepIndex(), 0);
+  CHECK(strcmp(hooks.log, "R100 ") == 0);
+
+  // Belum settled: tetap di ramp tanpa ramp ulang
+  now += 50;
+  runner.poll(now, hooks);
+  CHECK_EQ(runner.stepIndex(), 0);
+  CHECK(strcmp(hooks.log, "R100 ") == 0);
+
+  // Settled -> hold mulai di poll yang sama
+  hooks.settled = true;
+  now += 50;
+  runner.poll(now, hooks);
+  CHECK_EQ(runner.stepIndex(), 1);
+  CHECK(strcmp(hooks.log, "R100 rec1 ") == 0);
+
+  // Hold dihitung dari awal step, bukan dari awal plan
+  now += 999;
+  runner.poll(now, hooks);
+  CHECK_EQ(runner.stepIndex(), 1);
+  now += 1;
+  runner.poll(now, hooks);
+  CHECK_EQ(runner.stepIndex(), 2);
+  CHECK(strcmp(hooks.log, "R100 rec1 end1 R200 ") == 0);
+
+  // Dua kali (awal + 1 repeat): ramp 200 + hold, lalu fixture dan selesai
+  for (int pass = 0; pass < 2; pass++) {
+    hooks.settled = true;
+    now += 50;
+    runner.poll(now, hooks);
+    CHECK_EQ(runner.stepIndex(), 3);
+    now += 1000;
+    runner.poll(now, hooks);
+  }
+  CHECK_EQ(runner.status(), PLAN_DONE);
+  CHECK(strcmp(hooks.log, "R100 rec1 end1 R200 R200 F3 S ") == 0);
+  CHECK_EQ(hooks.stops, 1);
+
+  // Poll setelah selesai tidak memanggil hook lagi
+  runner.poll(now + 1000, hooks);
+  CHECK_EQ(hooks.stops, 1);
+}
+
+static void testFixtureWaits() {
+  TestPlan plan;
+  plan.count = 0;
+  plan.steps[plan.count++] = step(PLAN_OP_FIXTURE, 0, 0, 2);
+  plan.steps[plan.count++] = step(PLAN_OP_STOP);
+  plan.steps[plan.count++] = step(PLAN_OP_RAMP, 500);
+
+  PlanRunner runner;
+  FakeHooks hooks;
+  hooks.fixtureReady = false;
+  runner.start(plan);
+  CHECK_EQ(runner.poll(0, hooks), PLAN_RUNNING);
+  CHECK_EQ(runner.poll(50, hooks), PLAN_RUNNING);
+  hooks.fixtureReady = true;
+  // Stop eksplisit mengakhiri plan; step sesudahnya tidak dijalankan
+  CHECK_EQ(runner.poll(100, hooks), PLAN_DONE);
+  CHECK(strcmp(hooks.log, "F2 F2 F2 S ") == 0);
+}
+
+static void testSettleTimeout() {
+  TestPlan plan;
+  plan.count = 0;
+  plan.steps[plan.count++] = step(PLAN_OP_RAMP, 300, 2000);
+  plan.steps[plan.count++] = step(PLAN_OP_HOLD, 0, 1000, 0, 1);
+
+  PlanRunner runner;
+  FakeHooks hooks;
+  runner.start(plan);
+  uint32_t now = 5000;
+  runner.poll(now, hooks);
+  CHECK_EQ(runner.poll(now + 1999, hooks), PLAN_RUNNING);
+  CHECK_EQ(runner.poll(now + 2000, hooks), PLAN_FAILED);
+  CHECK_EQ(runner.stepIndex(), 0);
+  CHECK(strcmp(hooks.log, "R300 S ") == 0);
+
+  // Gagal bersifat final walaupun arus akhirnya settle
+  hooks.settled = true;
+  CHECK_EQ(runner.poll(now + 3000, hooks), PLAN_FAILED);
+  CHECK(strcmp(hooks.log, "R300 S ") == 0);
+
+  // durationMs 0 = menunggu settle tanpa batas
+  plan.steps[0].durationMs = 0;
+  FakeHooks patient;
+  runner.start(plan);
+  runner.poll(0, patient);
+  CHECK_EQ(runner.poll(600000, patient), PLAN_RUNNING);
+}
+
+static void testAbort() {
+  TestPlan plan;
+  plan.count = 0;
+  plan.steps[plan.count++] = step(PLAN_OP_RAMP, 100);
+  plan.steps[plan.count++] = step(PLAN_OP_HOLD, 0, 1000, 0, 1);
+
+  PlanRunner runner;
+  FakeHooks hooks;
+  runner.abort();  // tidak berjalan: tidak berubah
+  CHECK_EQ(runner.status(), PLAN_IDLE);
+
+  runner.start(plan);
+  runner.poll(0, hooks);
+  hooks.settled = true;
+  runner.poll(50, hooks);
+  CHECK_EQ(runner.stepIndex(), 1);
+  runner.abort();
+  CHECK_EQ(runner.status(), PLAN_ABORTED);
+
+  // Setelah abort poll tidak menjalankan hook lagi (stop output urusan pemanggil)
+  CHECK_EQ(runner.poll(5000, hooks), PLAN_ABORTED);
+  CHECK(strcmp(hooks.log, "R100 rec1 ") == 0);
+  CHECK_EQ(hooks.stops, 0);
+
+  // Plan bisa dijalankan lagi dari awal
+  runner.start(plan);
+  CHECK_EQ(runner.status(), PLAN_RUNNING);
+  CHECK_EQ(runner.stepIndex(), 0);
+
+  // Plan kosong langsung selesai
+  TestPlan empty;
+  empty.count = 0;
+  runner.start(empty);
+  CHECK_EQ(runner.status(), PLAN_DONE);
+}
+
+int main() {
+  testSequencing();
+  testFixtureWaits();
+  testSettleTimeout();
+  testAbort();
+  return testResult("plan_runner");
+}
@@ -0,0 +1,148 @@
+#ifndef TEST_PLAN_H
+#define TEST_PLAN_H
+
+// ------------------- Interpreter Test Plan -------------------
+// Urutan langkah yang dijalankan di device (bukan dari browser): ramp ke X mA,
+// hold T detik sambil merekam, step ke Y, ulangi, ganti fixture. PlanRunner
+// murni state machine; efek ke hardware lewat PlanHooks sehingga bisa diuji
+// di host. poll() dipanggil tiap periode kontrol.
+
+#include <stdint.h>
+
+#define PLAN_MAX_STEPS 32
+#define PLAN_UNARMED   0xFF
+
+enum PlanOp : uint8_t {
+  PLAN_OP_RAMP = 0,  // value = mA, durationMs = timeout settle (0 = tanpa batas)
+  PLAN_OP_HOLD,      // durationMs, flag = rekam selama hold
+  PLAN_OP_REPEAT,    // kembali ke step arg, value = jumlah pengulangan
+  PLAN_OP_FIXTURE,   // arg = id fixture
+  PLAN_OP_STOP,
+  PLAN_OP_COUNT
+};
+
+static const char* const PLAN_OP_NAMES[PLAN_OP_COUNT] = { "ramp", "hold", "repeat", "fixture", "stop" };
+
+struct PlanStep {
+  PlanOp op;
+  uint8_t flag;
+  uint16_t arg;
+  int32_t value;
+  uint32_t durationMs;
+};
+
+struct TestPlan {
+  PlanStep steps[PLAN_MAX_STEPS];
+  uint8_t count;
+};
+
+enum PlanStatus : uint8_t { PLAN_IDLE = 0, PLAN_RUNNING, PLAN_DONE, PLAN_FAILED, PLAN_ABORTED };
+
+static const char* const PLAN_STATUS_NAMES[] = { "idle", "running", "done", "failed", "aborted" };
+
+class PlanHooks {
+ public:
+  virtual void planRamp(int32_t milliamps) = 0;
+  virtual bool planSettled() = 0;
+  virtual void planRecord(bool on, uint8_t step) = 0;
+  virtual bool planFixture(uint8_t fixture) = 0;  // false = belum selesai, panggil lagi
+  virtual void planStop() = 0;
+};
+
+class PlanRunner {
+ public:
+  PlanRunner() : _status(PLAN_IDLE), _index(0), _entered(false), _stepStartMs(0) {}
+
+  void start(const TestPlan& plan) {
+    _plan = plan;
+    _index = 0;
+    _entered = false;
+    for (uint8_t i = 0; i < PLAN_MAX_STEPS; i++) _repeatLeft[i] = PLAN_UNARMED;
+    _status = plan.count > 0 ? PLAN_RUNNING : PLAN_DONE;
+  }
+
+  void abort() {
+    if (_status == PLAN_RUNNING) _status = PLAN_ABORTED;
+  }
+
+  PlanStatus status() const { return _status; }
+  uint8_t stepIndex() const { return _index; }
+  const TestPlan& plan() const { return _plan; }
+
+  PlanStatus poll(uint32_t nowMs, PlanHooks& hooks) {
+    // Step instan (repeat, stop, fixture yang langsung selesai) dieksekusi
+    // berurutan dalam satu poll; guard mencegah loop repeat tanpa step waktu
+    for (uint8_t guard = 0; guard < PLAN_MAX_STEPS && _status == PLAN_RUNNING; guard++) {
+      if (_index >= _plan.count) {
+        hooks.planStop();
+        _status = PLAN_DONE;
+        break;
+      }
+      const PlanStep& step = _plan.steps[_index];
+      bool entering = !_entered;
+      if (entering) {
+        _entered = true;
+        _stepStartMs = nowMs;
+      }
+      uint32_t elapsedMs = nowMs - _stepStartMs;
+
+      switch (step.op) {
+        case PLAN_OP_RAMP:
+          if (entering) hooks.planRamp(step.value);
+          if (hooks.planSettled()) {
+            advance(_index + 1);
+          } else if (step.durationMs > 0 && elapsedMs >= step.durationMs) {
+            hooks.planStop();
+            _status = PLAN_FAILED;
+          } else {
+            return _status;
+          }
+          break;
+
+        case PLAN_OP_HOLD:
+          if (entering && step.flag) hooks.planRecord(true, _index);
+          if (elapsedMs < step.durationMs) return _status;
+          if (step.flag) hooks.planRecord(false, _index);
+          advance(_index + 1);
+          break;
+
+        case PLAN_OP_REPEAT:
+          if (_repeatLeft[_index] == PLAN_UNARMED) _repeatLeft[_index] = step.value;
+          if (_repeatLeft[_index] > 0) {
+            _repeatLeft[_index]--;
+            advance(step.arg);
+          } else {
+            _repeatLeft[_index] = PLAN_UNARMED;  // supaya repeat bersarang bisa dipakai ulang
+            advance(_index + 1);
+          }
+          break;
+
+        case PLAN_OP_FIXTURE:
+          if (!hooks.planFixture(step.arg)) return _status;
+          advance(_index + 1);
+          break;
+
+        default:  // PLAN_OP_STOP
+          hooks.planStop();
+          _status = PLAN_DONE;
+          break;
+      }
+    }
+    return _status;
+  }
+
+ private:
+  void advance(uint8_t index) {
+    _index = index;
+    _entered = false;
+  }
+
+  TestPlan _plan;
+  PlanStatus _status;
+  uint8_t _index;
+  bool _entered;
+  uint32_t _stepStartMs;
+  uint8_t _repeatLeft[PLAN_MAX_STEPS];
+};
+
+#endif
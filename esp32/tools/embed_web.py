@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Minify + gzip halaman dan script di esp32/web/ menjadi array PROGMEM di web_assets.h.
+
+Tiap halaman juga mendapat ETag dari hash SHA-256 isi ter-gzip, jadi ETag
+hanya berubah jika halamannya berubah.
+
+Jalankan ulang setiap kali file di esp32/web/ berubah:
+
+    python3 esp32/tools/embed_web.py
+
+Minifier sengaja konservatif: hanya membuang indentasi, baris kosong,
+komentar HTML, dan baris komentar // atau /* */ penuh. Baris baru dipertahankan
+supaya JS yang mengandalkan automatic semicolon insertion tetap valid.
+"""
+
+import gzip
+import hashlib
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUT = os.path.join(ROOT, "web_assets.h")
+
+# (file, simbol C, content type)
+PAGES = [
+    ("index.html", "WEB_INDEX", "text/html"),
+    ("injection.html", "WEB_INJECTION", "text/html"),
+    ("injection_normal.html", "WEB_INJECTION_NORMAL", "text/html"),
+    ("injection_200ma.html", "WEB_INJECTION_200MA", "text/html"),
+    ("data_submission.html", "WEB_DATA_SUBMISSION", "text/html"),
+    ("live.js", "WEB_LIVE_JS", "application/javascript"),
+]
+
+
+def minify(text):
+    text = re.sub(r"<!--.*?-->", "", text, flags=re.S)
+    out = []
+    in_block_comment = False
+    for line in text.splitlines():
+        line = line.strip()
+        if in_block_comment:
+            if line.endswith("*/"):
+                in_block_comment = False
+            continue
+        if not line or line.startswith("//"):
+            continue
+        if line.startswith("/*"):
+            in_block_comment = not line.endswith("*/")
+            continue
+        out.append(line)
+    return "\n".join(out) + "\n"
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parts = [
+        "#ifndef WEB_ASSETS_H",
+        "#define WEB_ASSETS_H",
+        "",
+        "// FILE HASIL GENERATE - jangan diedit manual.",
+        "// Sumber: esp32/web/*.html dan *.js, generator: esp32/tools/embed_web.py",
+        "",
+        "#include <Arduino.h>",
+        "#include \"web_asset.h\"",
+        "",
+    ]
+    for name, symbol, content_type in PAGES:
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            raw = f.read()
+        small = minify(raw.decode("utf-8")).encode("utf-8")
+        # mtime=0 supaya output deterministik antar build
+        packed = gzip.compress(small, compresslevel=9, mtime=0)
+        etag = '\\"%s\\"' % hashlib.sha256(packed).hexdigest()[:16]
+        parts.append("// %s: %d -> %d (minify) -> %d byte (gzip)" % (name, len(raw), len(small), len(packed)))
+        parts.append("static const uint8_t %s_GZ[] PROGMEM = {" % symbol)
+        parts.append(c_array(packed))
+        parts.append("};")
+        parts.append("static const WebAsset %s = {%s_GZ, sizeof(%s_GZ), \"%s\", \"%s\"};"
+                     % (symbol, symbol, symbol, content_type, etag))
+        parts.append("")
+    parts.append("#endif")
+    with open(OUT, "w", newline="\n") as f:
+        f.write("\n".join(parts) + "\n")
+    print("wrote", OUT)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Load test web server ESP32 dengan beberapa klien dashboard bersamaan.
+
+Tiap klien meniru satu tab dashboard: satu stream /events (SSE) terbuka
+selama test, seperti live.js, ditambah request HTTP sesekali: memuat halaman
+dan /live.js (dengan If-None-Match seperti browser yang sudah cache), /status
+sekali per rekaman, dan /api/diagnostics dari halaman settings.
+Hasil: requests/sec total, latency p50/p99/max per path, serta jumlah event
+dan jeda terlama antar event /events per klien.
+
+    python3 esp32/tools/loadtest.py --host 192.168.4.1 --clients 6 --duration 30
+
+Hanya butuh standard library Python 3.
+"""
+
+import argparse
+import http.client
+import socket
+import threading
+import time
+
+# (path, bobot) satu siklus klien; data live datang lewat /events, bukan polling
+MIX = [("/", 2), ("/live.js", 2), ("/status", 1), ("/api/diagnostics", 1)]
+
+
+class ClientStats:
+    def __init__(self):
+        self.latency = {}  # path -> [detik]
+        self.errors = 0
+        self.bytes = 0
+        self.events = 0
+        self.max_event_gap = 0.0  # detik
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    ordered = sorted(values)
+    k = min(len(ordered) - 1, int(round(p / 100.0 * (len(ordered) - 1))))
+    return ordered[k]
+
+
+def run_client(host, port, deadline, think, stats):
+    conn = None
+    etags = {}
+    cycle = [path for path, weight in MIX for _ in range(weight)]
+    i = 0
+    while time.monotonic() < deadline:
+        path = cycle[i % len(cycle)]
+        i += 1
+        headers = {"Accept-Encoding": "gzip"}
+        if path in etags:
+            headers["If-None-Match"] = etags[path]
+        start = time.monotonic()
+        try:
+            if conn is None:
+                conn = http.client.HTTPConnection(host, port, timeout=10)
+            conn.request("GET", path, headers=headers)
+            resp = conn.getresponse()
+            body = resp.read()
+            elapsed = time.monotonic() - start
+            if resp.status >= 400:
+                stats.errors += 1
+                continue
+            if resp.getheader("ETag"):
+                etags[path] = resp.getheader("ETag")
+            stats.bytes += len(body)
+            stats.latency.setdefault(path, []).append(elapsed)
+            if resp.getheader("Connection", "").lower() == "close":
+                conn.close()
+                conn = None
+        except (OSError, http.client.HTTPException):
+            stats.errors += 1
+            if conn is not None:
+                conn.close()
+            conn = None
+        if think > 0:
+            time.sleep(think)
+    if conn is not None:
+        conn.close()
+
+
+def run_events(host, port, deadline, stats):
+    """Tahan satu stream /events sampai deadline; hitung event "reading"."""
+    marker = b"event: reading"
+    try:
+        sock = socket.create_connection((host, port), timeout=10)
+    except OSError:
+        stats.errors += 1
+        return
+    sock.settimeout(1.0)
+    sock.sendall(("GET /events HTTP/1.1\r\nHost: %s\r\nAccept: text/event-stream\r\n\r\n" % host).encode())
+    tail = b""
+    last = time.monotonic()
+    try:
+        while time.monotonic() < deadline:
+            try:
+                chunk = sock.recv(4096)
+            except socket.timeout:
+                continue
+            if not chunk:
+                stats.errors += 1  # server menutup stream
+                break
+            stats.bytes += len(chunk)
+            data = tail + chunk
+            count = data.count(marker)
+            if count:
+                now = time.monotonic()
+                stats.max_event_gap = max(stats.max_event_gap, now - last)
+                last = now
+                stats.events += count
+            tail = data[-(len(marker) - 1):]
+    except OSError:
+        stats.errors += 1
+    finally:
+        sock.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="192.168.4.1")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=6)
+    parser.add_argument("--duration", type=float, default=30.0, help="detik")
+    parser.add_argument("--think", type=float, default=0.0, help="jeda antar request per klien (detik)")
+    args = parser.parse_args()
+
+    deadline = time.monotonic() + args.duration
+    all_stats = [ClientStats() for _ in range(args.clients)]
+    threads = []
+    for s in all_stats:
+        threads.append(threading.Thread(target=run_events, args=(args.host, args.port, deadline, s)))
+        threads.append(threading.Thread(target=run_client, args=(args.host, args.port, deadline, args.think, s)))
+    started = time.monotonic()
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    wall = time.monotonic() - started
+
+    merged = {}
+    errors = 0
+    total_bytes = 0
+    for s in all_stats:
+        errors += s.errors
+        total_bytes += s.bytes
+        for path, values in s.latency.items():
+            merged.setdefault(path, []).extend(values)
+    total = sum(len(v) for v in merged.values())
+
+    print("%d klien, %.1f s: %d request OK, %d error, %.1f req/s, %.1f KB/s"
+          % (args.clients, wall, total, errors, total / wall, total_bytes / 1024.0 / wall))
+    print("%-20s %8s %9s %9s %9s" % ("path", "count", "p50 ms", "p99 ms", "max ms"))
+    for path, values in sorted(merged.items()):
+        print("%-20s %8d %9.1f %9.1f %9.1f" % (path, len(values), percentile(values, 50) * 1000,
+                                               percentile(values, 99) * 1000, max(values) * 1000))
+    everything = [v for values in merged.values() for v in values]
+    print("%-20s %8d %9.1f %9.1f %9.1f" % ("(semua)", len(everything), percentile(everything, 50) * 1000,
+                                           percentile(everything, 99) * 1000,
+                                           max(everything) * 1000 if everything else 0.0))
+    events = sum(s.events for s in all_stats)
+    print("/events: %d event (%.1f/s per klien), jeda terlama %.0f ms"
+          % (events, events / wall / max(args.clients, 1),
+             max(s.max_event_gap for s in all_stats) * 1000 if all_stats else 0.0))
+
+
+if __name__ == "__main__":
+    main()
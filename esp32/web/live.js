@@ -0,0 +1,24 @@
+// Helper bersama semua halaman (disajikan /live.js lewat web_assets.h).
+
+// /events: snapshot penuh saat (re)connect, lalu hanya field yang berubah
+// tiap sample baru; digabung ke satu objek state di browser. render menerima
+// state gabungan dan delta event ini (untuk field yang hanya dikirim saat
+// berubah, mis. countdownRemainingMs).
+const live = {};
+function connectEvents(render) {
+    const source = new EventSource('/events');
+    source.addEventListener('reading', event => {
+        const delta = JSON.parse(event.data);
+        Object.assign(live, delta);
+        render(live, delta);
+    });
+}
+
+// POST yang butuh kerja lama dijawab {"pending":true}; polling GET sampai selesai
+function awaitJob(url, result) {
+    if (!result.pending) return Promise.resolve(result);
+    return new Promise(resolve => setTimeout(resolve, 500))
+        .then(() => fetch(url))
+        .then(response => response.json())
+        .then(next => awaitJob(url, next));
+}
@@ -0,0 +1,24 @@
+#ifndef WEB_ASSET_H
+#define WEB_ASSET_H
+
+// ------------------- Aset Web Statis -------------------
+// Halaman statis disimpan di flash sebagai gzip (lihat tools/embed_web.py dan
+// web_assets.h). Di ESP32 flash ter-mapping ke address space, jadi data bisa
+// langsung ditulis ke socket tanpa disalin ke heap.
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct WebAsset {
+  const uint8_t* data;      // isi ter-gzip, PROGMEM
+  size_t length;
+  const char* contentType;
+  const char* etag;         // hash isi saat build, sudah dalam tanda kutip
+};
+
+// URL aset tidak berversi, jadi browser wajib revalidasi tiap kali: dengan
+// ETag jawabannya 304 tanpa isi selama firmware sama, dan halaman baru
+// langsung terambil setelah flash ulang (max-age bisa menahan versi lama).
+#define WEB_ASSET_CACHE_CONTROL "no-cache"
+
+#endif
@@ -0,0 +1,1022 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// FILE HASIL GENERATE - jangan diedit manual.
+// Sumber: esp32/web/*.html dan *.js, generator: esp32/tools/embed_web.py
+
+#include <Arduino.h>
+#include "web_asset.h"
+
+// index.html: 55927 -> 34764 (minify) -> 8242 byte (gzip)
+static const uint8_t WEB_INDEX_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3d, 0xdb, 0x72, 0x1b, 0xc9,
+  0x75, 0xef, 0xf8, 0x8a, 0x5e, 0xb9, 0xe4, 0x01, 0x2c, 0x00, 0x04, 0xc0, 0x8b, 0x28, 0x42, 0xa0,
+  0x4d, 0xdd, 0x56, 0xdc, 0x5d, 0x49, 0x0c, 0xc9, 0x5d, 0x97, 0xa3, 0x52, 0xb9, 0x1a, 0x98, 0x06,
+  0x30, 0xe2, 0x00, 0x83, 0x9d, 0x0b, 0x29, 0xee, 0x9a, 0x79, 0xf3, 0x43, 0xaa, 0x52, 0x49, 0x55,
+  0x9c, 0x3c, 0xc4, 0xe5, 0x94, 0xe3, 0xc7, 0x7d, 0xcf, 0x43, 0xbe, 0x62, 0x3f, 0xc2, 0x3f, 0x10,
+  0x7f, 0x42, 0xce, 0x39, 0xdd, 0x3d, 0xd3, 0x3d, 0x17, 0x00, 0x24, 0x25, 0x4b, 0x49, 0xc5, 0x5b,
+  0x16, 0x31, 0x3d, 0xa7, 0xbb, 0x4f, 0x9f, 0x73, 0xfa, 0xdc, 0xfa, 0xcc, 0xcc, 0xc3, 0xcf, 0x9e,
+  0xbc, 0x7a, 0x7c, 0xfa, 0xab, 0xa3, 0xa7, 0x6c, 0x1a, 0xcf, 0xfc, 0xfd, 0xda, 0x43, 0xfd, 0x47,
+  0x70, 0x17, 0xfe, 0xc4, 0x5e, 0xec, 0x8b, 0xfd, 0xc7, 0xaf, 0x8e, 0x9f, 0xb2, 0x53, 0x11, 0xc5,
+  0xac, 0xc5, 0x1e, 0x07, 0x73, 0x37, 0x19, 0xc5, 0xde, 0xb9, 0x60, 0x27, 0x89, 0x17, 0x0b, 0x76,
+  0x2c, 0x22, 0x2f, 0x8a, 0xf9, 0x7c, 0x24, 0xd8, 0xd3, 0x73, 0xee, 0x27, 0x3c, 0x0e, 0xc2, 0x87,
+  0x1b, 0xb2, 0x63, 0xed, 0xe1, 0x4c, 0xc4, 0x9c, 0x8d, 0xa6, 0x3c, 0x8c, 0x44, 0x3c, 0x70, 0xbe,
+  0x3e, 0x7d, 0xd6, 0xda, 0x75, 0x74, 0xf3, 0x9c, 0xcf, 0xc4, 0xc0, 0x39, 0xf7, 0xc4, 0xc5, 0x22,
+  0x08, 0x63, 0x87, 0x8d, 0x82, 0x79, 0x2c, 0xe6, 0x00, 0x76, 0xe1, 0xb9, 0xf1, 0x74, 0xe0, 0x8a,
+  0x73, 0x6f, 0x24, 0x5a, 0x74, 0xd1, 0x64, 0xde, 0xdc, 0x8b, 0x3d, 0xee, 0xb7, 0xa2, 0x11, 0xf7,
+  0xc5, 0xa0, 0xdb, 0xee, 0xe0, 0x30, 0x51, 0x7c, 0x89, 0xb3, 0xfc, 0x8c, 0x7d, 0xcf, 0x66, 0x3c,
+  0x9c, 0x78, 0xf3, 0x3d, 0xd6, 0xe9, 0xb3, 0x05, 0x77, 0x5d, 0x6f, 0x3e, 0xa1, 0xdf, 0xc3, 0xe0,
+  0x5d, 0x2b, 0xf2, 0xbe, 0xa3, 0xcb, 0x61, 0x10, 0xba, 0x22, 0x6c, 0x41, 0x53, 0x9f, 0x5d, 0xd5,
+  0x7e, 0x71, 0x26, 0x2e, 0xc7, 0x21, 0xa0, 0x10, 0xb1, 0xc8, 0xf7, 0x5c, 0x71, 0x38, 0x67, 0xdf,
+  0xd7, 0xc6, 0x61, 0x30, 0x83, 0xc1, 0x82, 0x05, 0x1f, 0x79, 0xf1, 0x25, 0x8d, 0x10, 0x87, 0x7c,
+  0x1e, 0x8d, 0x83, 0x70, 0xb6, 0x27, 0x7f, 0xfa, 0x3c, 0x16, 0xbf, 0xaa, 0xf7, 0x3a, 0x8b, 0x77,
+  0x0d, 0x1c, 0x26, 0x0e, 0x4c, 0xf8, 0x6e, 0x15, 0x7c, 0x87, 0x80, 0xaf, 0x6a, 0xc3, 0xc0, 0xbd,
+  0xc4, 0x79, 0x60, 0xa9, 0xad, 0x31, 0x9f, 0x79, 0x3e, 0x74, 0x6a, 0xf1, 0xc5, 0xc2, 0x17, 0xad,
+  0xe8, 0x32, 0x8a, 0xc5, 0xac, 0xc9, 0x1e, 0xf9, 0xde, 0xfc, 0xec, 0x05, 0x1f, 0x9d, 0xd0, 0xf5,
+  0x33, 0x80, 0x6c, 0x32, 0xe7, 0x44, 0x4c, 0x02, 0xc1, 0xbe, 0x3e, 0x74, 0x9a, 0xec, 0x38, 0x18,
+  0x06, 0x71, 0xd0, 0x64, 0x11, 0x0c, 0xde, 0x8a, 0x44, 0xe8, 0x8d, 0xfb, 0xb5, 0x21, 0x1f, 0x9d,
+  0x4d, 0xc2, 0x20, 0x99, 0xbb, 0x7b, 0x0c, 0xba, 0x0b, 0x1e, 0xb6, 0x26, 0x21, 0x77, 0x3d, 0x20,
+  0x67, 0xbd, 0xbb, 0xb9, 0xed, 0x8a, 0x49, 0x93, 0xfd, 0xa4, 0xb3, 0x33, 0xdc, 0x71, 0xb7, 0x58,
+  0xe7, 0x2e, 0xfc, 0xee, 0x6e, 0x0d, 0x77, 0xf9, 0x0e, 0xeb, 0x76, 0x3a, 0x77, 0x1b, 0xfd, 0xda,
+  0xcc, 0x9b, 0xb7, 0xa6, 0xc2, 0x9b, 0x4c, 0xe3, 0x3d, 0x6c, 0x3a, 0x9f, 0xf6, 0x6b, 0x29, 0x11,
+  0x71, 0xa5, 0xfd, 0xda, 0x28, 0xf0, 0x83, 0x70, 0x0f, 0xfa, 0xf1, 0x5e, 0xa7, 0x37, 0xea, 0xc3,
+  0x4a, 0xda, 0xc8, 0x2e, 0x0e, 0x73, 0x85, 0x44, 0xfd, 0x77, 0x92, 0x51, 0xd0, 0x1f, 0x06, 0x80,
+  0x1e, 0x19, 0x43, 0x18, 0x4f, 0xe2, 0xa0, 0xcf, 0xf8, 0xdc, 0x9b, 0xf1, 0xd8, 0x0b, 0xa0, 0x49,
+  0xd3, 0xbb, 0xd3, 0xde, 0x8e, 0x90, 0x2c, 0x6d, 0x94, 0x36, 0x1c, 0xc7, 0x5a, 0xc7, 0xc5, 0x14,
+  0xc4, 0x0b, 0x96, 0x26, 0xb9, 0x86, 0xab, 0x49, 0x22, 0x8d, 0x4e, 0x86, 0xdd, 0x16, 0x5e, 0xca,
+  0xb9, 0x80, 0xb3, 0x71, 0x1c, 0xcc, 0x34, 0x8c, 0xeb, 0x45, 0x0b, 0x9f, 0x03, 0x7d, 0xc7, 0xbe,
+  0x80, 0xcb, 0xb7, 0x49, 0x14, 0x7b, 0xe3, 0xcb, 0x96, 0x92, 0x32, 0xc0, 0x02, 0x98, 0x26, 0x5a,
+  0x43, 0x11, 0x5f, 0x08, 0x31, 0xef, 0xd7, 0xb8, 0xef, 0x4d, 0xe6, 0x2d, 0x98, 0x72, 0x06, 0xb3,
+  0x8c, 0x00, 0x42, 0x84, 0x38, 0x39, 0x88, 0xcf, 0x94, 0xbb, 0xc1, 0x05, 0x2e, 0x04, 0xe6, 0xa2,
+  0xb1, 0x59, 0x38, 0x19, 0xf2, 0x7a, 0xa7, 0x49, 0xff, 0xb5, 0xbb, 0x0d, 0x22, 0x87, 0x5a, 0xc3,
+  0xb4, 0xab, 0xd9, 0x0b, 0x62, 0x27, 0x00, 0x97, 0x5d, 0xc4, 0x85, 0x1a, 0x2e, 0x14, 0x85, 0xef,
+  0x77, 0x3a, 0x6b, 0x72, 0x6c, 0x67, 0xe7, 0xbe, 0x10, 0x5c, 0x72, 0xec, 0xfe, 0xce, 0xd6, 0x90,
+  0xf7, 0x34, 0xc7, 0x60, 0xb0, 0xe1, 0x99, 0x17, 0xb7, 0xb2, 0x61, 0x5a, 0x23, 0xdf, 0x5b, 0x80,
+  0xcc, 0x89, 0x77, 0x71, 0x76, 0x1b, 0xaf, 0x5a, 0x63, 0xcf, 0xf7, 0x5b, 0x8a, 0x81, 0x24, 0x92,
+  0x0b, 0x1e, 0xc2, 0x34, 0x84, 0x35, 0x6c, 0xcb, 0x18, 0x08, 0x19, 0xb5, 0x86, 0x31, 0xca, 0x7f,
+  0x4a, 0xd7, 0x6e, 0x47, 0xad, 0xf5, 0xd6, 0x98, 0x4a, 0xfe, 0xed, 0xb1, 0x79, 0x30, 0x2f, 0x72,
+  0xb3, 0x6b, 0x0a, 0x97, 0x62, 0x38, 0xe1, 0xec, 0x8a, 0x51, 0x10, 0x2a, 0x71, 0x91, 0x3d, 0x2d,
+  0x12, 0xee, 0x20, 0x09, 0x69, 0x2d, 0x9e, 0x84, 0x49, 0x77, 0x1d, 0x08, 0x55, 0x2f, 0x2a, 0x2c,
+  0x6d, 0x6f, 0x1a, 0x9c, 0x93, 0xa0, 0x96, 0xef, 0xce, 0x56, 0x4f, 0xed, 0xe6, 0xf6, 0x85, 0x37,
+  0xf6, 0x5a, 0xa0, 0xce, 0xe2, 0x24, 0x02, 0x72, 0xa4, 0x22, 0xe4, 0xcd, 0x71, 0xe5, 0x2d, 0x29,
+  0x49, 0xa5, 0x92, 0x32, 0xe1, 0x40, 0xfc, 0x5d, 0x4b, 0x36, 0x89, 0x86, 0x5d, 0x6a, 0x2b, 0x5d,
+  0xb6, 0x21, 0x25, 0xdd, 0xcd, 0x82, 0x94, 0xd0, 0x12, 0x4b, 0x05, 0x5b, 0xa3, 0x09, 0x92, 0x3c,
+  0x17, 0xa3, 0x58, 0xb8, 0xb0, 0x2e, 0x93, 0x49, 0x3f, 0xe9, 0x76, 0x86, 0x0f, 0x76, 0x41, 0x15,
+  0x59, 0x74, 0x4d, 0x57, 0x07, 0x8b, 0xaa, 0xec, 0x29, 0xc6, 0x5b, 0xf0, 0xbf, 0x92, 0x9e, 0x13,
+  0x9e, 0x4c, 0x44, 0x04, 0x8c, 0xf7, 0x5c, 0x93, 0x2e, 0x78, 0x0d, 0x6b, 0x87, 0x7f, 0x41, 0xd4,
+  0x66, 0x0b, 0xa4, 0x26, 0x4a, 0x5a, 0x32, 0x9b, 0xc3, 0x2a, 0x43, 0xb1, 0x10, 0x3c, 0xae, 0x6f,
+  0x35, 0x59, 0x77, 0x1c, 0x36, 0x14, 0x89, 0xe4, 0x12, 0x4a, 0xd7, 0x65, 0x2a, 0x91, 0x4e, 0xc7,
+  0x84, 0xf3, 0xc5, 0x18, 0x28, 0x42, 0x7a, 0x44, 0x37, 0x85, 0x92, 0x4a, 0xb2, 0x4d, 0x23, 0xd8,
+  0x1a, 0xf1, 0xd0, 0x5d, 0x4b, 0x8d, 0x74, 0x77, 0x6c, 0x35, 0x42, 0xb3, 0x91, 0xe4, 0x11, 0x77,
+  0x97, 0x69, 0x80, 0xee, 0x76, 0x5e, 0x03, 0x74, 0x76, 0x1b, 0xcb, 0xa5, 0x31, 0xa7, 0x8a, 0xf0,
+  0x5f, 0x60, 0x43, 0x08, 0x2c, 0x20, 0x70, 0x49, 0xb1, 0x0a, 0xc1, 0x2a, 0xe8, 0x2d, 0x7d, 0xc3,
+  0x5a, 0xf4, 0x2a, 0x01, 0xdf, 0x22, 0x01, 0xb7, 0x17, 0xb3, 0x8b, 0x5b, 0xbc, 0xb0, 0x98, 0x6e,
+  0xaf, 0x91, 0x71, 0x1c, 0x68, 0xa9, 0x39, 0x22, 0x49, 0x94, 0x5a, 0x09, 0x93, 0x8f, 0x5a, 0xc9,
+  0x43, 0x2b, 0x51, 0x35, 0xd0, 0x74, 0x08, 0x05, 0x4c, 0x0f, 0xae, 0x42, 0x81, 0x02, 0x37, 0x5b,
+  0x29, 0x8b, 0xce, 0x27, 0xf6, 0x12, 0xc3, 0x00, 0xb6, 0xaa, 0xa8, 0xb7, 0x1e, 0x74, 0x40, 0x0d,
+  0x19, 0x78, 0xb7, 0x86, 0x13, 0x54, 0xc3, 0xa0, 0xf8, 0xb4, 0xfa, 0x88, 0xe2, 0x30, 0x38, 0x13,
+  0x28, 0xe2, 0xdb, 0xe2, 0xbe, 0x18, 0xea, 0x86, 0x4c, 0xe0, 0x0c, 0x82, 0x62, 0xbf, 0xd2, 0xee,
+  0x26, 0xb4, 0x6a, 0x41, 0xbd, 0x30, 0x42, 0xc1, 0x26, 0x71, 0xb3, 0xc5, 0x40, 0x81, 0xb8, 0x3c,
+  0x9a, 0x06, 0xe3, 0x31, 0xe8, 0x23, 0xb2, 0x78, 0x4c, 0xf0, 0x48, 0x18, 0xb3, 0xa1, 0xd3, 0x84,
+  0x84, 0xce, 0xc8, 0xc6, 0x87, 0x11, 0x48, 0x04, 0xe9, 0xc2, 0x00, 0x46, 0xde, 0xee, 0xdc, 0xed,
+  0xd7, 0xe4, 0x16, 0xa0, 0x9f, 0x65, 0x2c, 0xae, 0xb7, 0xb6, 0x51, 0xf7, 0xe2, 0xbf, 0x0d, 0x5b,
+  0xb3, 0x54, 0xd8, 0x9f, 0x12, 0x83, 0x2e, 0xd1, 0xf1, 0xf9, 0x50, 0xf8, 0xb6, 0x0d, 0x93, 0x6c,
+  0xd5, 0x3d, 0x76, 0x86, 0xf7, 0x7b, 0xbb, 0x9d, 0x52, 0x85, 0x8c, 0xfb, 0xc7, 0xc0, 0x2e, 0x59,
+  0x2c, 0x44, 0x38, 0xa2, 0xd5, 0xfa, 0xa0, 0x8c, 0x61, 0xfb, 0xa1, 0xcd, 0x95, 0xae, 0x59, 0x7b,
+  0x5b, 0xa9, 0x32, 0xe4, 0x76, 0x18, 0x80, 0x63, 0x27, 0x77, 0xc3, 0xcd, 0x77, 0x6f, 0x4e, 0xa7,
+  0x48, 0x98, 0xb5, 0xb7, 0xef, 0xad, 0x94, 0x8f, 0xc2, 0xbd, 0x45, 0x5e, 0x6f, 0x8e, 0x76, 0xf7,
+  0xcb, 0xe9, 0x5f, 0x8a, 0x6d, 0x09, 0x53, 0x90, 0x92, 0x2d, 0xa4, 0xc6, 0x22, 0x75, 0x72, 0xed,
+  0x4e, 0x20, 0xf3, 0x9a, 0x65, 0xe9, 0x26, 0x1b, 0xfa, 0xc1, 0xe8, 0xac, 0x30, 0xc7, 0xce, 0x9a,
+  0x46, 0x47, 0x63, 0xb1, 0x79, 0x7f, 0xab, 0xbb, 0xdd, 0x45, 0x2c, 0x22, 0xe1, 0xc3, 0x0a, 0xd1,
+  0x09, 0x5f, 0x24, 0xb1, 0xa1, 0x13, 0x3a, 0x28, 0x8e, 0x99, 0xbd, 0xeb, 0xe5, 0xdd, 0x85, 0x9f,
+  0x8c, 0x1f, 0x8c, 0xf9, 0x78, 0x98, 0x39, 0x01, 0x00, 0xc1, 0x40, 0xb6, 0xc1, 0x88, 0xa4, 0xfb,
+  0x70, 0x99, 0x47, 0x90, 0x12, 0xc2, 0xc4, 0x9a, 0x3c, 0x3e, 0x73, 0x9b, 0x71, 0xd8, 0xad, 0xda,
+  0xea, 0x4b, 0x4c, 0xf7, 0xc6, 0xc1, 0x28, 0x89, 0x14, 0xbe, 0xf2, 0x02, 0xb0, 0x0e, 0x92, 0x18,
+  0x77, 0x6b, 0xce, 0x15, 0x49, 0xc5, 0x9a, 0x3c, 0x98, 0x7e, 0x99, 0xf4, 0x19, 0x52, 0x5a, 0x62,
+  0x60, 0x72, 0x8b, 0xcc, 0x56, 0xd2, 0xab, 0x14, 0x52, 0xc9, 0x3a, 0x26, 0x75, 0xce, 0x3c, 0x99,
+  0x81, 0x13, 0x3f, 0x6a, 0xa9, 0x29, 0x4c, 0x3e, 0xde, 0x44, 0x59, 0x92, 0x95, 0x95, 0x73, 0x2f,
+  0x99, 0x4c, 0xba, 0x7b, 0x8a, 0x8f, 0x5b, 0xbb, 0xa6, 0x6a, 0xdf, 0x2a, 0xf5, 0x58, 0x7a, 0x59,
+  0xa3, 0xe5, 0x91, 0x29, 0x2f, 0xb7, 0xb7, 0x54, 0xcb, 0x28, 0x3a, 0x8e, 0x92, 0x30, 0xc2, 0xcb,
+  0x45, 0xe0, 0x49, 0x5c, 0xab, 0xb8, 0x68, 0xa2, 0xd9, 0x06, 0x57, 0xb0, 0xca, 0x4d, 0xc9, 0x41,
+  0x7a, 0xf3, 0x02, 0xe4, 0xe6, 0x70, 0xb7, 0x37, 0xde, 0xc9, 0x43, 0x96, 0x59, 0x4b, 0x0a, 0x2c,
+  0xeb, 0x10, 0x58, 0x6e, 0x37, 0x0a, 0xe0, 0x5c, 0x06, 0xbc, 0x25, 0xf0, 0x9d, 0xf6, 0x83, 0x1c,
+  0xbc, 0x56, 0xe7, 0x8a, 0xb6, 0x0f, 0x2a, 0x3d, 0x8b, 0xdc, 0xbe, 0x59, 0x83, 0x9a, 0x95, 0x8a,
+  0xd1, 0xda, 0x58, 0xa9, 0x20, 0x2f, 0xdb, 0x58, 0x1a, 0x08, 0x95, 0x17, 0x46, 0x63, 0x61, 0xcb,
+  0x0e, 0xe7, 0x2c, 0xc1, 0x81, 0xe5, 0xd1, 0x4e, 0x7a, 0x1d, 0x5f, 0x2e, 0xc4, 0xe0, 0x0e, 0xd0,
+  0x60, 0x22, 0xee, 0xbc, 0xc9, 0xeb, 0x01, 0x2d, 0x3f, 0x3b, 0x05, 0x2d, 0x50, 0xb1, 0xd5, 0x49,
+  0xfd, 0xe4, 0x36, 0x65, 0xe9, 0x4c, 0x7b, 0x7b, 0x3a, 0x9e, 0x51, 0xb8, 0xc6, 0xd3, 0x64, 0x36,
+  0x84, 0xf9, 0x75, 0x33, 0x04, 0xd0, 0x10, 0x96, 0x60, 0x0e, 0x42, 0x8f, 0xa3, 0x30, 0xb3, 0x9d,
+  0x96, 0x6b, 0xc7, 0x33, 0x69, 0x30, 0xd3, 0x28, 0x20, 0x4f, 0x96, 0xb8, 0x20, 0xd0, 0x40, 0xce,
+  0x61, 0x02, 0xda, 0x76, 0xae, 0x55, 0x76, 0x7e, 0x2f, 0x1b, 0xbb, 0xb3, 0x72, 0x07, 0x6b, 0xea,
+  0x53, 0xa8, 0x29, 0xb7, 0x6d, 0x3e, 0x3a, 0x43, 0x43, 0xb6, 0xd9, 0x29, 0x6e, 0xc9, 0x95, 0x71,
+  0xc6, 0x76, 0x85, 0xca, 0x5f, 0x6f, 0x67, 0xda, 0xdb, 0x59, 0xe2, 0xd5, 0x5a, 0x84, 0x10, 0xd8,
+  0x87, 0x97, 0xb9, 0x9d, 0xb7, 0x3e, 0x65, 0x99, 0x1a, 0x27, 0x02, 0x67, 0x67, 0xc9, 0x46, 0x27,
+  0x90, 0x64, 0x34, 0x12, 0x51, 0x54, 0x15, 0xef, 0x48, 0xa8, 0xf5, 0x62, 0xbd, 0x12, 0xc7, 0xa0,
+  0x57, 0x70, 0x85, 0xb7, 0x53, 0xec, 0x4a, 0x55, 0x40, 0x21, 0xbf, 0xd3, 0x96, 0x91, 0x63, 0x6b,
+  0x06, 0x48, 0x72, 0xf2, 0x9e, 0x2d, 0xf5, 0xaf, 0xb2, 0x15, 0xa5, 0xce, 0x4c, 0x9e, 0xe9, 0x05,
+  0x8b, 0x97, 0x67, 0x74, 0x01, 0xfd, 0x9d, 0x52, 0xbf, 0x26, 0x43, 0xca, 0x9b, 0x8f, 0x83, 0x9c,
+  0xe9, 0xaa, 0x62, 0x12, 0x0d, 0xd3, 0xeb, 0x3e, 0x68, 0xb2, 0xde, 0x26, 0x84, 0x6f, 0xbd, 0x6d,
+  0xf8, 0xa7, 0xd3, 0xde, 0x6d, 0x50, 0x7c, 0x4f, 0x37, 0xbb, 0x5b, 0xf7, 0x21, 0xac, 0x7b, 0x70,
+  0x1f, 0x6f, 0x6e, 0xe2, 0xcd, 0x9d, 0x46, 0x1a, 0xf0, 0xc3, 0x04, 0x6e, 0x18, 0x2c, 0xd0, 0x8d,
+  0x8e, 0x11, 0xe3, 0xa1, 0x9f, 0x84, 0xf5, 0x2e, 0x25, 0xcc, 0x32, 0xc3, 0x2e, 0xb6, 0x3a, 0x7c,
+  0x6c, 0xa2, 0x97, 0xf2, 0xf6, 0x1a, 0x18, 0x76, 0x10, 0xc3, 0xed, 0x0e, 0xfc, 0xd3, 0x7b, 0x50,
+  0xc0, 0x90, 0x30, 0xdf, 0x84, 0xf6, 0xee, 0xfd, 0xde, 0x0d, 0x30, 0xec, 0xec, 0x6c, 0x8f, 0xb7,
+  0x76, 0x4c, 0x0c, 0x45, 0x18, 0x06, 0xe1, 0xb5, 0xf0, 0x43, 0xba, 0xf5, 0x7a, 0x3b, 0xea, 0x1f,
+  0x1b, 0xbf, 0xde, 0x36, 0x60, 0xd5, 0xdd, 0xd9, 0x56, 0xff, 0x5c, 0x1b, 0xbf, 0x07, 0x0f, 0xba,
+  0xc3, 0xee, 0x30, 0xf3, 0x11, 0x33, 0xff, 0x59, 0xb9, 0x7d, 0x14, 0x3b, 0x58, 0xe9, 0x32, 0xb3,
+  0x49, 0x09, 0xa1, 0x6c, 0x29, 0x7a, 0x65, 0x57, 0xb5, 0x5f, 0xcc, 0x84, 0xeb, 0x71, 0x56, 0x37,
+  0x1c, 0xe3, 0xfb, 0x3b, 0xe0, 0x1a, 0x34, 0x60, 0x86, 0x34, 0x61, 0xc7, 0x2a, 0x42, 0x59, 0x96,
+  0xe9, 0x39, 0x56, 0x62, 0xfb, 0x0a, 0x19, 0x05, 0x56, 0x91, 0x42, 0xe8, 0x8e, 0x25, 0xb0, 0xad,
+  0x54, 0x2b, 0x67, 0xd5, 0x9a, 0x92, 0x99, 0x86, 0x89, 0xf2, 0xae, 0x0f, 0x37, 0x54, 0xae, 0xf8,
+  0xe1, 0x86, 0x4a, 0x6d, 0x63, 0x26, 0x16, 0xfe, 0xb8, 0xde, 0x39, 0x1b, 0xf9, 0x3c, 0x8a, 0x06,
+  0x4e, 0x6a, 0x01, 0x1d, 0xbb, 0x5d, 0x2e, 0x16, 0x1b, 0xa7, 0xdd, 0xfd, 0x3f, 0xff, 0xfe, 0x4f,
+  0x2c, 0xcd, 0x87, 0xc3, 0x60, 0x5d, 0x4c, 0x43, 0xcf, 0x40, 0x45, 0xee, 0xaf, 0x99, 0x19, 0x97,
+  0xc0, 0xb5, 0x87, 0x9c, 0x4d, 0x43, 0x31, 0x1e, 0x38, 0x1b, 0x3a, 0x4f, 0xe5, 0xe8, 0xf9, 0xcc,
+  0xc4, 0x95, 0x03, 0x13, 0xfe, 0xdb, 0x7f, 0xff, 0xd7, 0x3f, 0xb1, 0x13, 0xd5, 0xf8, 0x70, 0x83,
+  0xe3, 0x22, 0x00, 0x3d, 0x85, 0xa4, 0xe7, 0x62, 0xc2, 0x7c, 0xec, 0x9d, 0x90, 0x90, 0xa6, 0x83,
+  0x98, 0x89, 0xac, 0x42, 0xda, 0x87, 0x72, 0xe7, 0x0b, 0x3e, 0xdf, 0xff, 0xcb, 0x1f, 0x7f, 0xf7,
+  0x27, 0x40, 0x09, 0x7f, 0xca, 0x96, 0x74, 0xb8, 0x53, 0xe0, 0x9a, 0xb3, 0xff, 0xc4, 0xe8, 0x94,
+  0xc2, 0x19, 0x93, 0x1b, 0x94, 0x33, 0x62, 0x38, 0x87, 0x11, 0xb1, 0x07, 0x4e, 0x59, 0x9a, 0x47,
+  0x13, 0x57, 0x81, 0xd8, 0xa9, 0xa4, 0x2a, 0x39, 0xe8, 0x8d, 0x43, 0xb6, 0x09, 0xff, 0xef, 0xb5,
+  0xb7, 0x51, 0x22, 0xb2, 0x4c, 0x12, 0xb3, 0x9c, 0x63, 0x01, 0x11, 0x78, 0x8e, 0x79, 0x59, 0xfc,
+  0x54, 0x85, 0x55, 0x87, 0xba, 0xc8, 0x18, 0x0a, 0xa0, 0x07, 0x4e, 0xb2, 0x88, 0x4f, 0x28, 0x8c,
+  0x70, 0xf6, 0xbf, 0x3e, 0x3a, 0xdd, 0x7b, 0xb8, 0x41, 0xf7, 0x90, 0x40, 0xd4, 0x4a, 0x24, 0xca,
+  0x60, 0x58, 0x30, 0x1f, 0x4d, 0xd1, 0x4f, 0xc1, 0x46, 0x17, 0xb0, 0x7e, 0xc9, 0x67, 0xe2, 0x2b,
+  0x60, 0x7c, 0xbd, 0x81, 0xe3, 0x06, 0x0b, 0xda, 0x95, 0xe4, 0x15, 0x0e, 0x1c, 0x67, 0xbf, 0xd5,
+  0x62, 0x47, 0x9e, 0xef, 0x4d, 0x19, 0x0c, 0xcd, 0x5a, 0xad, 0x87, 0x1b, 0x12, 0xa0, 0x00, 0x79,
+  0x94, 0xf8, 0xc1, 0x84, 0xbb, 0xc9, 0x7c, 0x42, 0x58, 0xb0, 0xec, 0xba, 0xb2, 0xcb, 0x63, 0x7e,
+  0xc1, 0x35, 0xb8, 0xfc, 0x5d, 0x09, 0xfa, 0x24, 0x09, 0xbd, 0xb3, 0x20, 0xe2, 0xb3, 0xa1, 0x27,
+  0xe1, 0x8d, 0x86, 0xea, 0xf1, 0x3d, 0x5f, 0x4c, 0x80, 0xbb, 0x72, 0x02, 0x79, 0x51, 0x09, 0xfc,
+  0x39, 0x87, 0xdd, 0xe0, 0x4b, 0x58, 0xf9, 0x7b, 0xc9, 0xb8, 0x67, 0xc9, 0x82, 0xeb, 0x61, 0xf1,
+  0xb7, 0x01, 0xba, 0x21, 0x89, 0x5e, 0x2a, 0x76, 0x37, 0xe0, 0xed, 0x9c, 0xcf, 0xf8, 0x21, 0x7a,
+  0x98, 0xce, 0x3e, 0xf0, 0x89, 0x1b, 0xcc, 0x95, 0xb1, 0x2d, 0xf9, 0x9d, 0x0e, 0xaa, 0x2c, 0x87,
+  0xf8, 0x9c, 0xc1, 0x33, 0x10, 0xc9, 0x91, 0x98, 0x06, 0x3e, 0xe8, 0x82, 0x81, 0x73, 0x9a, 0xf8,
+  0x5e, 0xc4, 0x70, 0x08, 0xf6, 0x95, 0x98, 0x4f, 0xce, 0x38, 0xa0, 0x00, 0xa2, 0xcc, 0x87, 0xbe,
+  0x70, 0x0b, 0x12, 0x71, 0xac, 0xc4, 0x41, 0x23, 0x69, 0x69, 0x27, 0x3b, 0x0c, 0x60, 0xd5, 0x91,
+  0x32, 0x2b, 0x0b, 0xc9, 0x58, 0xde, 0x4f, 0x60, 0x45, 0xcf, 0x6d, 0x33, 0xea, 0xa3, 0x94, 0x52,
+  0x18, 0x0c, 0x6b, 0x9b, 0x7a, 0x51, 0x9b, 0x10, 0x69, 0xcb, 0x01, 0x1f, 0xa3, 0x41, 0x19, 0xdc,
+  0x51, 0x8e, 0xd9, 0x1d, 0x04, 0x45, 0x7b, 0xb3, 0x04, 0x52, 0x22, 0x74, 0xc7, 0x79, 0x5f, 0x4c,
+  0x09, 0xf5, 0x76, 0x3b, 0x05, 0xbc, 0xcf, 0xd8, 0xd7, 0x67, 0x49, 0x58, 0xbe, 0xeb, 0x34, 0xe0,
+  0x12, 0x52, 0x0b, 0x60, 0xc5, 0x29, 0xde, 0x5b, 0xb1, 0xfd, 0xd4, 0x54, 0x6f, 0x3d, 0x7b, 0x13,
+  0x16, 0xc4, 0xcd, 0xfe, 0x63, 0xac, 0xd3, 0xb0, 0x5f, 0x4e, 0xc9, 0x1d, 0xca, 0x14, 0x94, 0xdd,
+  0x20, 0xdd, 0x7b, 0x3e, 0x91, 0x26, 0x6a, 0xe0, 0x74, 0x7b, 0x1d, 0x87, 0xc9, 0x00, 0x45, 0x5e,
+  0xc0, 0xed, 0x91, 0x17, 0x8e, 0x7c, 0x61, 0x0f, 0x37, 0x9c, 0x80, 0x6a, 0x7f, 0x37, 0x70, 0x76,
+  0x00, 0x7c, 0x74, 0x29, 0xff, 0x02, 0xe9, 0xb6, 0x7b, 0x0e, 0xdb, 0xc8, 0xba, 0x20, 0x91, 0xce,
+  0x03, 0x3f, 0x06, 0xe7, 0xf3, 0x73, 0x9a, 0xcc, 0x1e, 0x04, 0x33, 0x9a, 0x55, 0xc3, 0xa8, 0x84,
+  0xe6, 0xc0, 0x51, 0x4e, 0xb7, 0x63, 0xa6, 0x2f, 0x79, 0x18, 0x72, 0x80, 0xde, 0xec, 0xed, 0xb4,
+  0xef, 0x6f, 0x3a, 0xc5, 0xc4, 0x66, 0x76, 0x6b, 0x83, 0x88, 0x78, 0x3e, 0x29, 0x23, 0x09, 0x71,
+  0xc1, 0x31, 0x91, 0xfc, 0x86, 0x5a, 0xf6, 0x3b, 0xdf, 0xac, 0xa0, 0xb3, 0xcc, 0x4a, 0x3a, 0xfb,
+  0xdf, 0xc8, 0x6e, 0xab, 0xa0, 0x3f, 0x1a, 0xed, 0x21, 0x8e, 0xc2, 0xa3, 0xb5, 0x9b, 0xd3, 0x5e,
+  0x86, 0x32, 0x1f, 0x96, 0xf6, 0x0a, 0x49, 0x4d, 0xfb, 0xd9, 0xc1, 0x9a, 0xc4, 0x7f, 0x2c, 0xfb,
+  0x7d, 0xb2, 0xc4, 0x0f, 0x53, 0x7f, 0xeb, 0xe6, 0xf4, 0x97, 0xf9, 0xa2, 0x0f, 0x4b, 0xff, 0x0c,
+  0x4f, 0xcd, 0x82, 0x1f, 0x7f, 0x58, 0x93, 0x05, 0x99, 0x4b, 0xf9, 0xc9, 0x72, 0x81, 0x83, 0xef,
+  0xe6, 0xc5, 0x89, 0x7b, 0x0b, 0x26, 0xf0, 0xfb, 0xbb, 0xc3, 0x31, 0xff, 0xb0, 0x4c, 0x48, 0xd1,
+  0xd4, 0x3c, 0xb8, 0xbb, 0x26, 0x0b, 0x0e, 0x74, 0xc7, 0x95, 0x16, 0x22, 0xef, 0x15, 0xdb, 0x77,
+  0xad, 0x33, 0x03, 0x30, 0x7d, 0x58, 0x5e, 0xf3, 0x22, 0x70, 0x21, 0x78, 0x20, 0x0b, 0xe4, 0xa1,
+  0x6f, 0xb5, 0xcc, 0xb8, 0xda, 0x96, 0x31, 0x86, 0xee, 0xd8, 0xbb, 0xe8, 0x8e, 0x62, 0xeb, 0x13,
+  0xe9, 0x64, 0x97, 0x99, 0xc4, 0x6f, 0x13, 0x6f, 0x74, 0xe6, 0xec, 0xbf, 0xe0, 0xf3, 0x84, 0xfb,
+  0x84, 0x40, 0xa5, 0x9f, 0x16, 0x2d, 0xc4, 0xc8, 0xe3, 0x48, 0x82, 0x04, 0xec, 0x38, 0x8f, 0xbd,
+  0x51, 0x1e, 0xbe, 0xd4, 0x59, 0x43, 0xf4, 0x66, 0x19, 0x12, 0x59, 0x98, 0x63, 0xe7, 0x4a, 0x8c,
+  0x2c, 0x45, 0x2e, 0x44, 0xc8, 0x9f, 0x66, 0xb1, 0x42, 0x66, 0x94, 0xdd, 0xae, 0x46, 0x81, 0x2d,
+  0xaf, 0xa6, 0x60, 0x6b, 0x55, 0x53, 0x38, 0xfb, 0x59, 0x00, 0xa5, 0x34, 0x2c, 0x52, 0x47, 0xc6,
+  0x51, 0x16, 0x79, 0x29, 0x8c, 0x32, 0x29, 0x64, 0xbb, 0x49, 0x14, 0x92, 0x53, 0xe6, 0xae, 0xe8,
+  0xdc, 0xe5, 0xce, 0xe0, 0x9c, 0x8c, 0xb8, 0x22, 0x1a, 0x85, 0xde, 0x42, 0xca, 0x19, 0xc8, 0x12,
+  0x44, 0xda, 0x0b, 0x1e, 0x33, 0x17, 0x7c, 0x53, 0xc0, 0xe9, 0x4c, 0x1d, 0x2d, 0x68, 0xa1, 0x0f,
+  0xd8, 0x8c, 0x10, 0x5a, 0x2d, 0xbb, 0xa4, 0x46, 0x68, 0x16, 0x12, 0x94, 0xc7, 0xb2, 0xd9, 0x29,
+  0x07, 0x56, 0xa2, 0x6c, 0x2c, 0x96, 0x15, 0x76, 0x8b, 0xd1, 0x2d, 0x77, 0xf0, 0x81, 0x83, 0xca,
+  0x38, 0x5f, 0x79, 0xe1, 0xf2, 0xc2, 0xc9, 0x83, 0x63, 0x84, 0xef, 0x8a, 0x11, 0x49, 0xba, 0x0f,
+  0x38, 0xc1, 0xfc, 0x24, 0xf0, 0x7f, 0x83, 0x08, 0xa6, 0xf3, 0xd5, 0x5b, 0x5d, 0x90, 0x76, 0x70,
+  0xed, 0xe4, 0x28, 0x39, 0x07, 0x1f, 0xc6, 0x1a, 0x42, 0x48, 0x9f, 0x2d, 0x2c, 0xed, 0x57, 0x98,
+  0x4e, 0xe9, 0x8c, 0x99, 0x37, 0x1f, 0x38, 0xa0, 0xab, 0x66, 0x1c, 0x94, 0x17, 0x88, 0x0d, 0xea,
+  0x20, 0xb1, 0x80, 0x9f, 0x8e, 0xde, 0x1e, 0x9d, 0xe2, 0xde, 0xcb, 0xa1, 0x44, 0x0e, 0x35, 0x41,
+  0x37, 0xae, 0xb3, 0x58, 0x6f, 0xbe, 0x72, 0xb1, 0xb8, 0xd6, 0x7b, 0xc6, 0x5a, 0x8b, 0xc4, 0xce,
+  0x67, 0xf9, 0x9d, 0x1c, 0x45, 0x28, 0xd5, 0x5e, 0x46, 0x90, 0x13, 0xea, 0xe8, 0xe4, 0xc6, 0x91,
+  0x05, 0x31, 0x6b, 0x93, 0x85, 0x66, 0xb2, 0xa8, 0xf2, 0x2c, 0x0c, 0x66, 0x72, 0xe8, 0x3c, 0x59,
+  0x96, 0x28, 0xd2, 0x64, 0xa8, 0x44, 0xec, 0x20, 0x4e, 0x42, 0x36, 0x14, 0x11, 0x0f, 0x81, 0x3a,
+  0x6f, 0xc5, 0x59, 0xe4, 0xb1, 0xfa, 0xdd, 0x86, 0x16, 0x77, 0xd0, 0x4e, 0x43, 0x90, 0xf6, 0x16,
+  0xdb, 0x60, 0xf7, 0x18, 0x8f, 0x79, 0xc2, 0xc0, 0x53, 0x17, 0xa1, 0xac, 0x3b, 0x6b, 0x5f, 0x47,
+  0xe8, 0x95, 0xca, 0xd3, 0x62, 0x5f, 0x48, 0x5a, 0x50, 0x32, 0xd6, 0x29, 0xea, 0xbb, 0xd8, 0x03,
+  0xf6, 0xa5, 0x0a, 0xaf, 0xb4, 0xd7, 0x7a, 0x3a, 0x4b, 0xfa, 0x83, 0x52, 0x67, 0x75, 0xb6, 0x1f,
+  0xec, 0xec, 0x3c, 0xd0, 0x3a, 0x2b, 0xcb, 0x2c, 0xef, 0x66, 0x71, 0xa3, 0x9d, 0x54, 0x2e, 0x4d,
+  0xbd, 0x95, 0x9e, 0x21, 0xdb, 0xe9, 0x64, 0x2a, 0x5c, 0xda, 0x4a, 0x0b, 0xdd, 0xba, 0x3b, 0x4d,
+  0x50, 0xbc, 0x98, 0xa8, 0x94, 0x59, 0xd6, 0xcd, 0x46, 0x7f, 0x89, 0x86, 0xde, 0x36, 0xf4, 0x94,
+  0x4a, 0x74, 0x6e, 0x37, 0xf5, 0xff, 0xd5, 0x71, 0x59, 0x1e, 0x87, 0x5e, 0x41, 0xab, 0xe3, 0xa9,
+  0x04, 0xcb, 0x17, 0x0d, 0x74, 0x29, 0x7d, 0xf4, 0x97, 0x3f, 0xfe, 0xeb, 0x3f, 0xb3, 0xe3, 0xa7,
+  0x8f, 0x5f, 0x1d, 0x3f, 0x39, 0x7c, 0xf9, 0x79, 0xbb, 0xdd, 0x2e, 0x51, 0xa5, 0x06, 0x42, 0x5b,
+  0x15, 0x26, 0xc3, 0x2e, 0x71, 0x22, 0x4a, 0xd9, 0x09, 0xf5, 0xdd, 0x7c, 0x3e, 0xbd, 0xd7, 0x50,
+  0x0a, 0x77, 0x04, 0x4c, 0x8b, 0x01, 0x72, 0x7e, 0x8a, 0x6c, 0x06, 0xdf, 0xa1, 0xb7, 0xd7, 0xe9,
+  0x54, 0x8b, 0x95, 0x99, 0xbc, 0x34, 0xf6, 0xbd, 0xbe, 0x0b, 0x3b, 0xdc, 0x38, 0x46, 0x51, 0x72,
+  0x17, 0xf3, 0x30, 0x7e, 0x14, 0xcf, 0x8d, 0x7d, 0x4f, 0x4d, 0xe8, 0x25, 0xa0, 0x15, 0x3f, 0xc1,
+  0x0b, 0x95, 0x82, 0x4c, 0x37, 0xfd, 0x1a, 0xe3, 0xe2, 0x66, 0x19, 0xe5, 0x06, 0x96, 0x6d, 0xca,
+  0xb9, 0x37, 0xb2, 0x14, 0x79, 0x21, 0xc7, 0xcc, 0xe7, 0x21, 0xc1, 0xb2, 0x5e, 0x87, 0xa2, 0x86,
+  0x15, 0x33, 0xab, 0x8c, 0xbe, 0x76, 0x7a, 0x47, 0x20, 0xa1, 0x25, 0x4b, 0x3a, 0xa6, 0x1b, 0x4b,
+  0xe6, 0xfd, 0xcb, 0x1f, 0xff, 0xe5, 0x3f, 0x99, 0x84, 0x62, 0xf5, 0x1e, 0x6a, 0x9c, 0xc6, 0xea,
+  0xa9, 0xc1, 0x88, 0x6a, 0x4a, 0x06, 0x8b, 0xfc, 0xac, 0xc1, 0x42, 0xd1, 0xb1, 0x6a, 0xca, 0x13,
+  0x00, 0x29, 0x6a, 0xd3, 0x5b, 0x7a, 0x78, 0xcf, 0x79, 0xe4, 0xf9, 0xec, 0x08, 0x54, 0x54, 0xf2,
+  0xd6, 0xe3, 0xf3, 0x12, 0xa9, 0xc5, 0x73, 0xab, 0xb1, 0x1f, 0x5c, 0xb4, 0xde, 0xa9, 0xda, 0x12,
+  0x1c, 0x30, 0xc6, 0x64, 0x46, 0x69, 0xe6, 0x28, 0x2b, 0x60, 0xf0, 0xf9, 0x22, 0x12, 0x94, 0x06,
+  0xa7, 0x5f, 0x45, 0xc7, 0x81, 0x06, 0xd2, 0x35, 0xdd, 0xa1, 0x1e, 0xed, 0x96, 0x5e, 0x93, 0xb5,
+  0x83, 0xe4, 0x0c, 0x7a, 0xe4, 0x8a, 0xa4, 0x56, 0xb7, 0x98, 0xd4, 0x32, 0x55, 0x14, 0x56, 0xda,
+  0xf4, 0x75, 0x16, 0xc8, 0x20, 0x54, 0x3c, 0x7d, 0x0f, 0x83, 0x2b, 0xfd, 0xa7, 0xf9, 0x50, 0x7f,
+  0x35, 0x9d, 0x35, 0xde, 0xf7, 0xd0, 0x32, 0x07, 0xaf, 0x46, 0xdd, 0x88, 0x43, 0xfa, 0x57, 0x93,
+  0x9d, 0x4a, 0xbf, 0xe5, 0x56, 0xd0, 0x39, 0x2a, 0x22, 0x1a, 0x42, 0xc5, 0x2e, 0x52, 0x13, 0x1d,
+  0x43, 0x08, 0x64, 0x9c, 0x02, 0x36, 0x32, 0xd5, 0x5d, 0xa6, 0xcd, 0xd3, 0xd3, 0xa0, 0x11, 0xdf,
+  0xe4, 0x63, 0x40, 0xe1, 0x91, 0xf0, 0x93, 0x19, 0xe3, 0x2e, 0x67, 0x60, 0x6a, 0x39, 0x4c, 0xef,
+  0x1a, 0xa8, 0xa8, 0x33, 0x8f, 0x0d, 0x92, 0x29, 0x5b, 0xa2, 0xd5, 0x94, 0x4b, 0x2c, 0x46, 0x76,
+  0x78, 0xe4, 0xac, 0xde, 0xf2, 0xd9, 0x6e, 0x4b, 0x86, 0x33, 0x2f, 0x3e, 0xf0, 0xfd, 0x27, 0x80,
+  0x8e, 0xb1, 0xe5, 0x32, 0x4a, 0x6f, 0x2b, 0x63, 0x63, 0x4b, 0xed, 0x0e, 0xcd, 0x73, 0x42, 0xbd,
+  0x59, 0x61, 0xeb, 0x94, 0x39, 0x3a, 0xb4, 0xdb, 0x11, 0x3e, 0x8a, 0x60, 0xd7, 0xe5, 0x8e, 0x43,
+  0x54, 0x74, 0x01, 0x04, 0x16, 0xd5, 0x66, 0xbc, 0x3c, 0xa2, 0x93, 0x8e, 0x35, 0x8b, 0xc2, 0xd1,
+  0xc0, 0xd9, 0xf0, 0xbd, 0x73, 0xd1, 0x7e, 0x1b, 0x21, 0xac, 0x6c, 0x4f, 0x01, 0xf6, 0x6b, 0xa0,
+  0x0d, 0x20, 0x86, 0xd3, 0x65, 0x3c, 0x03, 0xf6, 0x3d, 0xc8, 0xcc, 0xe8, 0x4c, 0x80, 0xc1, 0x99,
+  0x27, 0xbe, 0xdf, 0x64, 0x91, 0xf8, 0x16, 0x6c, 0x4b, 0x93, 0x2d, 0xc4, 0x5c, 0x2e, 0xfd, 0xfb,
+  0xab, 0x26, 0xfb, 0x36, 0x11, 0x09, 0xac, 0xf7, 0xf5, 0x9b, 0x26, 0x7a, 0xe7, 0x8f, 0x92, 0x08,
+  0x4b, 0x05, 0xb8, 0x1f, 0x09, 0xba, 0x7e, 0x09, 0xec, 0x90, 0xdd, 0xd9, 0x55, 0xbf, 0x36, 0x4e,
+  0xe6, 0xf2, 0x8c, 0x0f, 0x55, 0xd8, 0x37, 0x1e, 0x7f, 0x1e, 0xc7, 0x8b, 0x3a, 0x9e, 0xc7, 0x85,
+  0x02, 0xfc, 0xa1, 0x39, 0x1b, 0x8b, 0x78, 0x34, 0xad, 0x3b, 0x1b, 0x7c, 0xe1, 0x6d, 0x90, 0x06,
+  0x6c, 0x62, 0x2d, 0x87, 0x88, 0xa7, 0x01, 0x6c, 0x70, 0xe7, 0xe8, 0xd5, 0xc9, 0xa9, 0xc3, 0xae,
+  0x1a, 0xb5, 0x36, 0x88, 0xe4, 0xbc, 0x1e, 0x8a, 0x68, 0x01, 0x08, 0x0b, 0x36, 0xd8, 0x87, 0x11,
+  0xbc, 0x31, 0xab, 0x7f, 0xa6, 0x9b, 0xda, 0xc1, 0x59, 0x83, 0xc5, 0xd3, 0x30, 0xb8, 0x60, 0x73,
+  0x71, 0xc1, 0x9e, 0xe2, 0xb9, 0x67, 0x9d, 0xf4, 0x26, 0x7b, 0x7e, 0x7a, 0x7a, 0xc4, 0x1c, 0x70,
+  0xab, 0x52, 0x58, 0x49, 0xd9, 0x46, 0x5f, 0x23, 0xe1, 0x38, 0xfd, 0xda, 0x15, 0x1d, 0x3c, 0xa7,
+  0xe8, 0x2a, 0x92, 0x3c, 0x96, 0x27, 0x49, 0x84, 0xb1, 0xa4, 0x95, 0xa4, 0x0f, 0x90, 0x0a, 0xa7,
+  0xf9, 0xa5, 0x18, 0x9e, 0xd0, 0x75, 0xdd, 0xb9, 0x88, 0xf6, 0x36, 0x36, 0x70, 0x16, 0x3f, 0x18,
+  0x51, 0x11, 0x78, 0x7b, 0x1a, 0x00, 0xf8, 0x3d, 0xe6, 0x6c, 0x5c, 0x44, 0x0e, 0x0c, 0x2e, 0x3b,
+  0xb6, 0x83, 0x79, 0x00, 0xc4, 0x84, 0xfe, 0x30, 0x26, 0x2c, 0x43, 0xcd, 0xd3, 0x26, 0x9a, 0xb6,
+  0x81, 0xb7, 0xde, 0x48, 0xd4, 0x3b, 0x0d, 0x3c, 0x1f, 0x7d, 0xca, 0x81, 0x32, 0xf4, 0xb8, 0x07,
+  0x02, 0xaa, 0xee, 0x11, 0x30, 0x42, 0x36, 0x36, 0xcc, 0x31, 0x75, 0x44, 0x3a, 0x60, 0xe2, 0x1c,
+  0xb6, 0x80, 0x24, 0x90, 0x44, 0x18, 0x62, 0xbd, 0x38, 0xd2, 0x37, 0xda, 0xb8, 0xc3, 0x68, 0x1a,
+  0x40, 0x99, 0x39, 0x74, 0x36, 0x8b, 0x40, 0x17, 0x1c, 0x14, 0x62, 0x08, 0x50, 0x1a, 0x1f, 0xc5,
+  0xf0, 0xd7, 0xd4, 0xfb, 0x75, 0xe7, 0xcd, 0x9b, 0xbe, 0xa4, 0xb7, 0x04, 0x6c, 0x30, 0x49, 0xb9,
+  0x7e, 0xcd, 0x85, 0xe8, 0x39, 0x16, 0xab, 0xba, 0xc9, 0xcb, 0xee, 0x1b, 0x36, 0x18, 0x0c, 0x98,
+  0x23, 0xc2, 0xd0, 0x41, 0x82, 0xca, 0xb1, 0xda, 0xa1, 0x40, 0x03, 0x5d, 0xcf, 0xd8, 0x46, 0xd0,
+  0x58, 0xe3, 0x03, 0xa4, 0xe8, 0x35, 0xda, 0x6f, 0x03, 0x6f, 0x4e, 0xc8, 0xe2, 0x8a, 0xaf, 0x98,
+  0x00, 0x41, 0x33, 0x3b, 0x83, 0x92, 0x3b, 0x17, 0xd5, 0x7d, 0x90, 0xab, 0x57, 0x06, 0xa5, 0x46,
+  0x7e, 0x80, 0x02, 0xa4, 0xc8, 0x4f, 0x44, 0x22, 0xcc, 0x33, 0xbe, 0x82, 0xe4, 0xf6, 0x6b, 0x16,
+  0x5f, 0xa0, 0xf5, 0x35, 0xac, 0xe4, 0xd5, 0x10, 0x11, 0x95, 0x6e, 0x7f, 0x54, 0xcf, 0x2d, 0x39,
+  0x63, 0x99, 0xa6, 0xa5, 0x96, 0x51, 0x85, 0xe9, 0x68, 0xe6, 0xca, 0xe5, 0x93, 0x98, 0xe3, 0xfa,
+  0xad, 0x2d, 0x21, 0x25, 0xdc, 0x5e, 0x55, 0x93, 0x59, 0x24, 0x2a, 0x5d, 0x7e, 0x8e, 0x76, 0xda,
+  0xbe, 0xe3, 0x03, 0x4c, 0x20, 0xba, 0xf0, 0x17, 0xd7, 0xeb, 0x6a, 0x42, 0x34, 0xb2, 0x95, 0x29,
+  0xbc, 0x71, 0xd3, 0x23, 0x7d, 0x44, 0x8c, 0x9e, 0x61, 0x90, 0xc4, 0x75, 0x5b, 0xf4, 0x9b, 0x54,
+  0x5b, 0x8a, 0xbd, 0xfb, 0x45, 0x5a, 0xc9, 0x1f, 0xd6, 0xc6, 0x41, 0x01, 0x7d, 0x1c, 0xcc, 0x20,
+  0x58, 0x77, 0xeb, 0xb0, 0x64, 0x50, 0x09, 0xe1, 0x24, 0xdb, 0x3d, 0x4a, 0xf6, 0x73, 0x03, 0xfd,
+  0xf4, 0xa7, 0xb9, 0x16, 0x58, 0x17, 0x77, 0x2f, 0x51, 0x1f, 0x0a, 0xa2, 0x59, 0xba, 0xcf, 0xda,
+  0xaf, 0x8e, 0x9e, 0xbe, 0x94, 0x32, 0x65, 0xd3, 0x13, 0xc7, 0xf8, 0x0c, 0x47, 0xd7, 0xa2, 0x69,
+  0x2b, 0x1c, 0x2d, 0xe7, 0xa0, 0xcf, 0x60, 0xfa, 0x93, 0x38, 0x84, 0x95, 0xd7, 0xef, 0xdd, 0x4b,
+  0x67, 0x15, 0xdf, 0xa6, 0x20, 0x6a, 0xc7, 0x11, 0x28, 0xec, 0x5e, 0xd2, 0x1c, 0x38, 0xd7, 0x3d,
+  0x56, 0x87, 0xa5, 0xd0, 0x94, 0xe0, 0x7d, 0x88, 0x31, 0x38, 0x1f, 0x2e, 0xfb, 0x39, 0xe8, 0x0e,
+  0xb6, 0xa7, 0xa0, 0x70, 0xa5, 0xa9, 0x4e, 0x41, 0x96, 0x1c, 0x41, 0xc0, 0xe8, 0x45, 0xa2, 0x5e,
+  0x4f, 0xf9, 0xa9, 0x18, 0x69, 0x8b, 0x9e, 0xde, 0x34, 0x30, 0xe3, 0x1b, 0xd2, 0xc1, 0x44, 0xb7,
+  0x5c, 0x1f, 0x54, 0xa6, 0xb8, 0x6c, 0xb9, 0xc6, 0xbc, 0xdc, 0x9a, 0x7a, 0xc1, 0x90, 0x12, 0x5b,
+  0xbb, 0x2c, 0x92, 0x68, 0x9a, 0xc1, 0xe4, 0x35, 0x1e, 0x8e, 0x90, 0x45, 0xe7, 0x58, 0x05, 0x0d,
+  0xfa, 0xa2, 0xa1, 0x64, 0x58, 0x0f, 0xa4, 0xf4, 0xbd, 0x89, 0x80, 0x52, 0xf9, 0x80, 0xb8, 0xea,
+  0xa3, 0x49, 0x80, 0xa3, 0xe7, 0xfa, 0x01, 0x50, 0x1c, 0x26, 0x42, 0x93, 0xda, 0x05, 0x1b, 0x56,
+  0xb2, 0x15, 0x33, 0x60, 0xb2, 0x2a, 0xfd, 0x3c, 0x06, 0x34, 0xdd, 0x67, 0x03, 0xb9, 0x55, 0x33,
+  0xd9, 0x9a, 0x4b, 0x2c, 0x72, 0x80, 0xfd, 0x12, 0x44, 0xe5, 0x16, 0xb7, 0x17, 0x8c, 0xbd, 0x53,
+  0x65, 0x61, 0xc8, 0x30, 0x66, 0x5d, 0x9d, 0xa6, 0x5e, 0x9b, 0xb6, 0x44, 0xa9, 0xf2, 0x06, 0x1e,
+  0x89, 0xb6, 0x1f, 0x4c, 0xea, 0x0e, 0xa5, 0x08, 0xd2, 0x74, 0x95, 0x60, 0x32, 0x71, 0xe0, 0xee,
+  0x19, 0x9d, 0xa1, 0x37, 0xd8, 0x06, 0x50, 0x11, 0xb2, 0x2c, 0xc7, 0x18, 0x41, 0xc8, 0xcd, 0x0b,
+  0xbd, 0x11, 0x9e, 0xae, 0xda, 0x4a, 0xa7, 0x37, 0xf4, 0x9c, 0x48, 0xad, 0x86, 0x41, 0xd4, 0xd4,
+  0x36, 0x51, 0xa9, 0x3a, 0x53, 0x09, 0xbc, 0x53, 0x95, 0x55, 0x85, 0x65, 0xaa, 0x44, 0xa9, 0xbc,
+  0x8d, 0xd9, 0xd6, 0x03, 0x59, 0xea, 0x91, 0xd2, 0x15, 0xdb, 0x65, 0x90, 0x03, 0xe2, 0x57, 0x76,
+  0x33, 0x8d, 0x1a, 0x0f, 0xd1, 0xad, 0x02, 0xc5, 0x97, 0x12, 0x0f, 0xef, 0x72, 0x54, 0x42, 0xd0,
+  0xf3, 0x14, 0x04, 0x5f, 0xc4, 0x2f, 0xb8, 0xa9, 0x3c, 0x91, 0x1f, 0x7c, 0xc6, 0x8f, 0x44, 0x88,
+  0x47, 0xe4, 0x20, 0xd4, 0x35, 0xb3, 0x3c, 0x00, 0x9c, 0x87, 0x9a, 0xf3, 0x9c, 0xcf, 0xbe, 0xe3,
+  0x53, 0xf6, 0x02, 0xa6, 0x08, 0xa6, 0xdc, 0x69, 0xd6, 0x9c, 0x27, 0x10, 0xf6, 0x45, 0xe0, 0x39,
+  0x85, 0xe1, 0x25, 0xfb, 0x8a, 0x9f, 0x45, 0x7c, 0xce, 0xd9, 0x33, 0xfe, 0x96, 0x87, 0x78, 0xf3,
+  0xd5, 0xd9, 0xd9, 0x25, 0x3b, 0x98, 0xbb, 0xa0, 0x1a, 0x22, 0x76, 0x1a, 0x82, 0xc8, 0x06, 0xd8,
+  0xfc, 0x22, 0x99, 0x72, 0xe0, 0x94, 0xcb, 0x7e, 0xc9, 0xa7, 0x97, 0x89, 0xeb, 0x61, 0x1b, 0x40,
+  0x79, 0xec, 0x20, 0x7c, 0x9b, 0x40, 0xff, 0xc7, 0x1c, 0x53, 0x2e, 0x82, 0xcb, 0xf6, 0xc9, 0xc4,
+  0x63, 0xbf, 0x4a, 0xa2, 0x64, 0x4c, 0x97, 0x58, 0x6f, 0xc0, 0x0e, 0x87, 0x21, 0x9f, 0x7a, 0x33,
+  0x6c, 0xf8, 0x22, 0xf1, 0xc1, 0x55, 0x4b, 0x22, 0x70, 0xdb, 0x7c, 0x3f, 0x59, 0x00, 0xfd, 0x2f,
+  0xb1, 0xf9, 0x59, 0xe8, 0xb9, 0xc1, 0x8c, 0x9d, 0x26, 0x80, 0x50, 0x00, 0xe8, 0xa9, 0x49, 0xc6,
+  0xee, 0x94, 0xfb, 0xf4, 0xeb, 0xad, 0xc7, 0x5e, 0x26, 0x10, 0x86, 0x4c, 0xb9, 0x1a, 0xbc, 0xf6,
+  0x06, 0x9a, 0x55, 0x6d, 0x03, 0xad, 0x15, 0x16, 0xe9, 0x85, 0x89, 0x0f, 0xf8, 0x73, 0x9a, 0x89,
+  0x90, 0x65, 0x2f, 0x27, 0xdc, 0x9b, 0x27, 0x21, 0x3b, 0x0e, 0xc6, 0xde, 0x19, 0x36, 0xbf, 0x84,
+  0x8b, 0x03, 0x9f, 0x86, 0x3f, 0x82, 0xd1, 0x7c, 0xce, 0xbe, 0x14, 0x33, 0xfc, 0x73, 0x02, 0x94,
+  0x99, 0xc3, 0x7a, 0x62, 0x7e, 0x26, 0x07, 0x37, 0xab, 0x21, 0x68, 0x86, 0x83, 0xd0, 0x8b, 0x80,
+  0x58, 0xc0, 0x4a, 0x5f, 0xae, 0x35, 0x84, 0x5d, 0x73, 0xe0, 0xb3, 0x2f, 0xa7, 0xdc, 0x0b, 0x69,
+  0xc4, 0x13, 0x7e, 0xe9, 0x8d, 0x01, 0x87, 0xa7, 0xfe, 0xcc, 0x53, 0x18, 0xaa, 0xea, 0x08, 0x85,
+  0xa2, 0x22, 0xe4, 0x41, 0x74, 0x39, 0xe5, 0xb2, 0x4b, 0xd6, 0x36, 0x4c, 0xd8, 0xb1, 0xf7, 0x9d,
+  0x5c, 0xef, 0x11, 0x04, 0x5c, 0x10, 0x40, 0x5d, 0x72, 0xa0, 0x79, 0x14, 0xc3, 0x32, 0x92, 0xf0,
+  0xad, 0x17, 0x07, 0x72, 0x4c, 0x55, 0x44, 0x41, 0x43, 0x9e, 0x04, 0x73, 0x8f, 0x9d, 0x04, 0xe3,
+  0x4b, 0x3e, 0xb7, 0x47, 0x73, 0xf1, 0xc1, 0x58, 0x8d, 0x03, 0x55, 0x52, 0x10, 0xfc, 0xdf, 0x26,
+  0x3e, 0x10, 0x82, 0x87, 0xec, 0xb9, 0xe7, 0xf2, 0x4b, 0x1e, 0x63, 0xa7, 0x2f, 0x41, 0x0f, 0x02,
+  0x1b, 0x1f, 0xf1, 0xcb, 0x44, 0xce, 0xed, 0x45, 0x33, 0xce, 0x8e, 0x80, 0x1a, 0x1e, 0xe8, 0x57,
+  0xf0, 0x66, 0x66, 0x38, 0x90, 0xb2, 0x4e, 0x20, 0x75, 0x31, 0x46, 0x62, 0x78, 0x1c, 0x8f, 0x05,
+  0x0c, 0x68, 0xb8, 0x6b, 0xce, 0x71, 0x97, 0xb5, 0xd8, 0x09, 0x0f, 0x41, 0xf2, 0x58, 0xcc, 0x29,
+  0xdd, 0xf6, 0x53, 0xf8, 0xe1, 0x7b, 0x10, 0x2e, 0xf8, 0x20, 0x63, 0x38, 0xee, 0x71, 0x0f, 0x60,
+  0x4e, 0xb3, 0x36, 0x84, 0x48, 0x48, 0x56, 0xf1, 0xe6, 0xe6, 0xb2, 0x9b, 0x5b, 0x6b, 0x8c, 0xbe,
+  0x0d, 0x30, 0x5f, 0xf2, 0x20, 0x62, 0x67, 0xfc, 0xcc, 0x2b, 0xb9, 0xbf, 0xb3, 0xe2, 0xfe, 0x7d,
+  0x8d, 0xc0, 0x30, 0x90, 0x56, 0xfb, 0xa7, 0x6c, 0xc8, 0xdf, 0x26, 0x98, 0x25, 0x77, 0x93, 0xb3,
+  0xd8, 0x23, 0x79, 0x3e, 0xde, 0x5d, 0x09, 0x55, 0x7b, 0x23, 0xb7, 0xee, 0x14, 0xa3, 0x13, 0xac,
+  0x24, 0x90, 0xd6, 0x3f, 0x35, 0x02, 0xf9, 0x72, 0xa0, 0x54, 0xb9, 0xa6, 0xc5, 0x43, 0xd0, 0xc3,
+  0x0d, 0x46, 0xc9, 0x0c, 0x9d, 0x49, 0xd8, 0xf5, 0x4f, 0x7d, 0x81, 0x3f, 0x1f, 0x5d, 0x1e, 0x82,
+  0xaa, 0xcc, 0x2a, 0x8c, 0x1a, 0xa6, 0x12, 0xa0, 0x62, 0x94, 0x65, 0xfd, 0xb2, 0x8a, 0x95, 0xb4,
+  0x5f, 0xb8, 0x7a, 0xb6, 0x30, 0x3f, 0x97, 0x3c, 0xc9, 0x11, 0xae, 0xd4, 0x38, 0x29, 0x32, 0xd2,
+  0x61, 0x93, 0x56, 0xc4, 0x00, 0xc1, 0xb5, 0xa5, 0x13, 0xb7, 0xd3, 0xea, 0x8c, 0x54, 0xff, 0xa5,
+  0x46, 0xb4, 0x14, 0x48, 0x9a, 0xb1, 0xec, 0x96, 0x2c, 0xa1, 0x1f, 0xc8, 0x50, 0xa2, 0xa6, 0x50,
+  0x6b, 0x7b, 0xa0, 0xa1, 0xc3, 0xe7, 0xa7, 0x2f, 0xbe, 0xc2, 0x3b, 0xf6, 0xd1, 0xd4, 0x9d, 0x3b,
+  0x58, 0xd8, 0x61, 0xd4, 0xe4, 0xc0, 0xae, 0x49, 0xcc, 0xc2, 0x0e, 0x18, 0x48, 0x0f, 0x53, 0x98,
+  0xf7, 0x2a, 0xcf, 0xb1, 0xe3, 0x1c, 0xbb, 0x3e, 0x06, 0xd9, 0x69, 0x15, 0x03, 0x96, 0xa3, 0x49,
+  0x1b, 0x7c, 0xad, 0x19, 0xda, 0x28, 0x0a, 0x1f, 0x4c, 0x58, 0x8a, 0x02, 0xab, 0x56, 0xf8, 0xbe,
+  0x28, 0x98, 0x7a, 0x22, 0x25, 0x33, 0x29, 0x46, 0xaf, 0x3d, 0x95, 0x55, 0x85, 0x03, 0x1a, 0x26,
+  0x37, 0x97, 0xa5, 0x79, 0xd2, 0x68, 0xa0, 0x4e, 0xcd, 0xf8, 0x5c, 0x8f, 0x2b, 0xde, 0x35, 0xcc,
+  0xc0, 0x4c, 0xcd, 0x60, 0x90, 0x7a, 0x04, 0x76, 0x2a, 0x16, 0x8a, 0xda, 0x75, 0x47, 0x02, 0x18,
+  0xcc, 0xf9, 0x52, 0xa0, 0x53, 0xe4, 0x1c, 0xa3, 0xb3, 0x59, 0xa7, 0x01, 0xe1, 0x07, 0x3e, 0xcb,
+  0x2d, 0x21, 0x53, 0x21, 0x44, 0xc0, 0xb4, 0x11, 0xd3, 0x23, 0x8f, 0x65, 0xbd, 0x3e, 0x52, 0x17,
+  0xb1, 0x91, 0xcc, 0xd0, 0x3a, 0xe0, 0xb5, 0xc9, 0x94, 0x37, 0xe8, 0x48, 0x97, 0xdf, 0x79, 0x8d,
+  0xc3, 0xbe, 0x41, 0xae, 0x95, 0x8c, 0x7c, 0x0f, 0xf0, 0x62, 0x7f, 0xfe, 0xc3, 0xef, 0x9c, 0x74,
+  0x5e, 0x59, 0x85, 0x45, 0xc9, 0x1e, 0x44, 0x5a, 0x97, 0x89, 0x98, 0xbc, 0xc0, 0x67, 0x20, 0xc0,
+  0xd3, 0x9a, 0x7a, 0xbe, 0x5b, 0x97, 0xbd, 0x1a, 0x32, 0x10, 0xaf, 0x46, 0xaf, 0x41, 0x8f, 0xaa,
+  0x85, 0xac, 0x8e, 0x5a, 0x0c, 0xd5, 0x57, 0xb7, 0x0f, 0x7f, 0x1e, 0x0e, 0xd8, 0x2e, 0xfc, 0xbd,
+  0x77, 0x2f, 0xdb, 0x01, 0x16, 0xb1, 0x3c, 0x25, 0x7e, 0xab, 0x16, 0x16, 0x9a, 0x1a, 0x23, 0x25,
+  0xe4, 0x10, 0xd8, 0x72, 0x46, 0xae, 0x61, 0xa6, 0x14, 0xf2, 0x90, 0x60, 0x64, 0x9c, 0x3e, 0xdb,
+  0xd8, 0x60, 0x4f, 0xc4, 0x98, 0x27, 0x7e, 0xcc, 0x8e, 0xbb, 0x00, 0x5e, 0x2c, 0xf0, 0x2a, 0xd9,
+  0xbb, 0xd6, 0x69, 0x77, 0x8a, 0xff, 0x4c, 0xfa, 0x70, 0x95, 0xdb, 0x30, 0x3d, 0x3d, 0x6f, 0x68,
+  0xfd, 0xa6, 0x7c, 0x6a, 0x39, 0xd2, 0xb2, 0xae, 0xe6, 0xc9, 0x76, 0x2a, 0x5c, 0xb9, 0xf3, 0xdf,
+  0x65, 0xfd, 0xf3, 0x47, 0xc5, 0xe9, 0x18, 0xb9, 0x53, 0xdd, 0x95, 0x38, 0x18, 0x07, 0xc0, 0xe9,
+  0x18, 0xe6, 0x99, 0xed, 0xb2, 0x01, 0xac, 0xb3, 0xdd, 0x4c, 0x17, 0x59, 0x87, 0x5f, 0xcb, 0xfa,
+  0xe7, 0x8e, 0xc9, 0x1a, 0xf4, 0x40, 0x49, 0xce, 0x81, 0x46, 0x24, 0xfb, 0xb5, 0x4a, 0x37, 0x17,
+  0x45, 0x4a, 0xb2, 0x69, 0x90, 0x3a, 0xdb, 0xc4, 0x40, 0x9b, 0x3e, 0xb9, 0x1d, 0xe8, 0x18, 0x67,
+  0xcd, 0xb0, 0x1b, 0x72, 0x84, 0xc8, 0x03, 0x3b, 0xe9, 0x73, 0xc8, 0x6d, 0x4a, 0x0b, 0xbe, 0x94,
+  0xc1, 0xa9, 0x95, 0x1c, 0xb4, 0xea, 0x10, 0x32, 0x78, 0xb9, 0x01, 0x33, 0x79, 0x70, 0x30, 0x65,
+  0x08, 0xf7, 0x4d, 0xca, 0x15, 0x81, 0xe8, 0x39, 0x4c, 0x80, 0xb2, 0xe9, 0x53, 0x39, 0x58, 0x35,
+  0x7d, 0xf5, 0x71, 0x50, 0xa3, 0xd8, 0x57, 0xbd, 0x9a, 0x40, 0x4f, 0x55, 0x39, 0x46, 0x76, 0xf4,
+  0xd3, 0xb8, 0x3e, 0x02, 0xd9, 0xe9, 0x4d, 0xe3, 0x26, 0xd8, 0xcb, 0x23, 0x98, 0xea, 0xae, 0x4a,
+  0x13, 0xd8, 0x32, 0xa0, 0xcb, 0x4d, 0xd6, 0x90, 0x02, 0xbb, 0x20, 0xe5, 0x13, 0x14, 0x04, 0x05,
+  0xb4, 0x4a, 0x0e, 0x56, 0x32, 0x71, 0x99, 0x20, 0xac, 0x62, 0xc3, 0x52, 0x01, 0x58, 0x57, 0x8a,
+  0x3e, 0xb4, 0x20, 0x98, 0x1a, 0x3d, 0x77, 0x30, 0xa9, 0xb3, 0xd4, 0xa0, 0xa1, 0x3d, 0x54, 0xf5,
+  0x69, 0x9d, 0x54, 0xbd, 0x91, 0xe5, 0xc0, 0xfb, 0xa9, 0xa1, 0x90, 0x07, 0x00, 0x2f, 0x64, 0xdc,
+  0x5f, 0x77, 0xf0, 0xf4, 0x92, 0x4e, 0x4d, 0xd1, 0x95, 0x97, 0x23, 0xa3, 0x60, 0xb4, 0xdb, 0xa8,
+  0xad, 0xd6, 0xa2, 0x59, 0xc1, 0xad, 0xb2, 0x32, 0x1b, 0x12, 0xd2, 0xc9, 0xb2, 0xeb, 0x0b, 0xff,
+  0xd2, 0x74, 0x50, 0x5e, 0xbb, 0x89, 0x7c, 0x9f, 0x49, 0x13, 0xe2, 0x11, 0xa9, 0xfb, 0x30, 0x3f,
+  0x45, 0x70, 0x25, 0x39, 0xe4, 0x08, 0xe8, 0x3c, 0x77, 0x31, 0xd5, 0xbc, 0xc0, 0x77, 0x27, 0x3d,
+  0xf3, 0x03, 0x1e, 0xd7, 0xf5, 0x10, 0x0d, 0xf6, 0x9b, 0xdf, 0xe0, 0x33, 0x62, 0x25, 0xca, 0x54,
+  0x8f, 0xfd, 0xa1, 0x14, 0xc1, 0x12, 0x16, 0xe6, 0x44, 0xa8, 0x92, 0x0b, 0xf2, 0x0c, 0x19, 0xd9,
+  0x80, 0xde, 0x84, 0x46, 0x18, 0xd3, 0x83, 0xb3, 0x03, 0xe0, 0x07, 0xab, 0x87, 0x7c, 0xb6, 0x60,
+  0x7f, 0x87, 0x37, 0x35, 0x15, 0x30, 0x75, 0xa8, 0x7e, 0x37, 0x19, 0x20, 0x03, 0xe1, 0xe1, 0x24,
+  0xc1, 0x0d, 0x3a, 0xf4, 0xfc, 0x86, 0x43, 0x7e, 0x4e, 0x21, 0x1b, 0xf4, 0xfd, 0xb5, 0xb9, 0xaa,
+  0x5c, 0xd8, 0x68, 0x1a, 0x5c, 0xa8, 0x1d, 0xaa, 0xd2, 0xc0, 0x87, 0xaa, 0xc4, 0x64, 0xc2, 0x27,
+  0xdc, 0xdf, 0x23, 0xb4, 0xed, 0xac, 0x52, 0xe1, 0xc4, 0xc3, 0x3a, 0xd9, 0x26, 0xe1, 0xcc, 0x27,
+  0x86, 0xa4, 0x08, 0x7d, 0x98, 0x7d, 0x66, 0x55, 0x9f, 0x34, 0xaa, 0xd5, 0x4c, 0x29, 0x8b, 0x8c,
+  0xe3, 0x76, 0xc0, 0x17, 0x19, 0x42, 0x55, 0x0e, 0x6c, 0x28, 0xc2, 0xb7, 0x1c, 0x62, 0x68, 0xd6,
+  0x43, 0x0e, 0x78, 0x31, 0x6d, 0x1c, 0x4a, 0x26, 0xe6, 0x4d, 0x7d, 0x5e, 0x79, 0x5b, 0xfb, 0x44,
+  0x2e, 0xcc, 0xb1, 0x73, 0x7f, 0x72, 0x93, 0xa4, 0xd9, 0xbf, 0x74, 0x76, 0x49, 0x47, 0x2a, 0xf3,
+  0x67, 0x4f, 0x4f, 0x8e, 0x36, 0x7b, 0xac, 0x6e, 0xab, 0xfa, 0x6a, 0xe6, 0x8f, 0x7c, 0xc1, 0x43,
+  0x9d, 0x69, 0xab, 0x17, 0x72, 0x6f, 0xb4, 0xd1, 0xaa, 0xf2, 0x71, 0x95, 0x69, 0xbc, 0x1b, 0x53,
+  0xfc, 0x56, 0xf6, 0x35, 0xb7, 0xb1, 0x8a, 0xf2, 0xa9, 0x8a, 0x23, 0x56, 0x89, 0xa7, 0x91, 0xc8,
+  0x5e, 0x46, 0xeb, 0xba, 0xe1, 0x53, 0x49, 0xfa, 0xca, 0x9c, 0x27, 0x2c, 0xf1, 0x2b, 0x31, 0x46,
+  0xfb, 0xd9, 0xed, 0x75, 0xc8, 0x3d, 0xa7, 0x62, 0x8c, 0x04, 0x9c, 0x67, 0x50, 0xa8, 0x7a, 0x7f,
+  0x96, 0x92, 0x35, 0x12, 0x71, 0xca, 0x0a, 0xcd, 0x71, 0x3d, 0x5e, 0xab, 0x95, 0x7a, 0xbc, 0x6a,
+  0xb0, 0x01, 0x7b, 0xc1, 0xe3, 0x69, 0x7b, 0xec, 0x07, 0xb0, 0xb8, 0x74, 0xda, 0x0d, 0xb6, 0xd3,
+  0x29, 0x51, 0x8f, 0xe9, 0xfd, 0xbb, 0x70, 0x7f, 0x09, 0x85, 0x73, 0x35, 0x3b, 0x0d, 0xdb, 0x25,
+  0xa8, 0xa9, 0x53, 0x0c, 0x85, 0x42, 0xa3, 0xbd, 0xe0, 0x2e, 0x59, 0x8b, 0x7a, 0xaf, 0xc9, 0x9c,
+  0x0e, 0x88, 0x31, 0xa8, 0xa0, 0x3d, 0xa4, 0xac, 0x02, 0x54, 0x08, 0x14, 0x01, 0xe5, 0x9e, 0x48,
+  0xb1, 0x82, 0x60, 0xaa, 0xd3, 0x58, 0x4b, 0x1c, 0x3f, 0x98, 0xd0, 0x95, 0x2b, 0xe2, 0x3f, 0xfc,
+  0x96, 0x19, 0xac, 0x07, 0x53, 0x1a, 0x71, 0xef, 0x33, 0xf6, 0x42, 0xcc, 0x2f, 0xbd, 0x19, 0x96,
+  0xb1, 0xd2, 0xd9, 0xa6, 0xb4, 0x8e, 0x58, 0x8a, 0x72, 0xc2, 0xcf, 0xc5, 0xc1, 0xdc, 0xc5, 0x9c,
+  0x7f, 0x7d, 0xd9, 0xbe, 0xcf, 0x1c, 0x77, 0x6b, 0xd7, 0xcb, 0x63, 0xba, 0x92, 0x3d, 0x1f, 0x63,
+  0x92, 0xff, 0xe9, 0xea, 0xe0, 0x24, 0xab, 0xcf, 0xcc, 0x64, 0x80, 0xaa, 0x07, 0xd7, 0xef, 0xa9,
+  0x0a, 0x19, 0x15, 0xf6, 0x34, 0x2d, 0xe2, 0x49, 0x3f, 0xd2, 0xd0, 0x13, 0xad, 0x2a, 0x35, 0xe0,
+  0xa1, 0xd9, 0xab, 0xb9, 0x6f, 0x1c, 0x9c, 0x5c, 0xc9, 0xa4, 0x17, 0x8d, 0x42, 0x0b, 0xa4, 0x5f,
+  0x66, 0x4f, 0xd5, 0x52, 0x92, 0xfe, 0x2a, 0xd3, 0x51, 0xb8, 0x8f, 0xb1, 0xd0, 0x48, 0x6e, 0x62,
+  0x6a, 0xb6, 0x0e, 0x65, 0x4b, 0x09, 0xb8, 0xe6, 0x18, 0xf8, 0x5f, 0x76, 0xd8, 0x98, 0xd9, 0xa5,
+  0x02, 0x2b, 0x3f, 0xe5, 0x24, 0x97, 0x0d, 0x7c, 0x8c, 0xde, 0x92, 0x9d, 0x84, 0xd4, 0xf5, 0x0e,
+  0xd2, 0x53, 0x77, 0xca, 0x2a, 0x1b, 0xd2, 0x32, 0x85, 0xb7, 0x11, 0x39, 0x8a, 0x0a, 0x44, 0xf6,
+  0xc0, 0x92, 0x14, 0x53, 0x14, 0xb3, 0x07, 0x33, 0x50, 0x67, 0xa5, 0x20, 0xed, 0xac, 0xbd, 0x1d,
+  0x07, 0xcf, 0xbc, 0x77, 0xc2, 0xad, 0xf7, 0x1a, 0x4b, 0xb3, 0x20, 0x48, 0xd7, 0x8a, 0x94, 0x90,
+  0x4c, 0x12, 0x5f, 0x55, 0xdc, 0x4e, 0xaf, 0x8e, 0xa5, 0x77, 0xa8, 0x27, 0xee, 0x97, 0xa6, 0x3f,
+  0x50, 0x2f, 0xe3, 0x59, 0xdb, 0x71, 0x6a, 0xba, 0x3e, 0x5c, 0x3a, 0x47, 0xcf, 0x53, 0x48, 0xe3,
+  0x7c, 0xd8, 0x80, 0x63, 0xb9, 0xaf, 0xf6, 0xb1, 0xe2, 0x14, 0xa4, 0x18, 0x11, 0xa4, 0x2c, 0xd1,
+  0x45, 0x37, 0x96, 0xe8, 0x5d, 0xe9, 0xd9, 0x6a, 0xa9, 0x46, 0xdf, 0x16, 0x8c, 0x40, 0x44, 0x6a,
+  0x77, 0x4f, 0xd7, 0xd6, 0x68, 0x39, 0x84, 0xbb, 0x3f, 0xfe, 0xd0, 0x66, 0x5f, 0xe1, 0x81, 0x55,
+  0xcc, 0xce, 0x04, 0xdd, 0x97, 0xac, 0x80, 0x5b, 0xa4, 0x9e, 0x53, 0x85, 0x51, 0xe1, 0xce, 0xfd,
+  0xe3, 0xdf, 0xb3, 0x13, 0x31, 0x4b, 0xb8, 0x4c, 0x57, 0xb2, 0x04, 0x93, 0xad, 0xf5, 0xe3, 0x6e,
+  0xeb, 0x78, 0xb7, 0xc1, 0xa2, 0xc4, 0xe5, 0xd3, 0x54, 0xfd, 0x4b, 0x63, 0x6f, 0x25, 0xc1, 0x0b,
+  0x9e, 0x6d, 0x69, 0x61, 0xbb, 0x2c, 0xde, 0xd6, 0xc7, 0xdb, 0x39, 0xbb, 0xf0, 0x99, 0x69, 0x17,
+  0x74, 0x94, 0x26, 0x05, 0xf1, 0x5c, 0xdb, 0xfa, 0x19, 0x7f, 0x57, 0xef, 0x34, 0xd5, 0x6f, 0x6f,
+  0x5e, 0x07, 0xcd, 0xd5, 0x94, 0x91, 0x0f, 0x58, 0x48, 0x39, 0x3c, 0xc6, 0x3c, 0x68, 0x60, 0x1b,
+  0xa9, 0x66, 0xf0, 0x56, 0xa9, 0xab, 0xf7, 0x6f, 0x39, 0x94, 0xae, 0x0c, 0xc2, 0x19, 0x04, 0xa1,
+  0xdf, 0x91, 0x24, 0x7a, 0xd1, 0x4b, 0xfe, 0xb2, 0x7e, 0xde, 0x60, 0x3f, 0x67, 0x1d, 0xb6, 0xc7,
+  0xce, 0xa5, 0x70, 0x10, 0x6e, 0x44, 0x11, 0xeb, 0x44, 0x23, 0xeb, 0xb9, 0xd2, 0x9e, 0x14, 0x41,
+  0xb3, 0x53, 0x67, 0x6d, 0x5f, 0x8d, 0x13, 0xf7, 0x14, 0xba, 0x91, 0x8b, 0xa2, 0xcb, 0x6b, 0xee,
+  0x3f, 0x0e, 0xc7, 0xfe, 0x0a, 0x84, 0x5f, 0x93, 0x9e, 0xa5, 0x62, 0x9c, 0x23, 0x62, 0x56, 0xbf,
+  0x56, 0xf6, 0xc8, 0x85, 0x2b, 0xfc, 0x98, 0x67, 0x3a, 0xf5, 0x06, 0xc2, 0x48, 0x6a, 0x57, 0x09,
+  0x8a, 0x4d, 0x65, 0xc5, 0x10, 0x1d, 0xfd, 0x23, 0x45, 0x4d, 0x39, 0x52, 0x74, 0xcd, 0xf4, 0x7f,
+  0x4a, 0x0d, 0xd5, 0x51, 0xd3, 0x44, 0x8f, 0x73, 0x8f, 0x11, 0xb6, 0x99, 0xde, 0x62, 0x0f, 0xd1,
+  0x2d, 0x55, 0x5d, 0x3b, 0x46, 0xfb, 0x3e, 0x3a, 0x0d, 0xe9, 0x9d, 0x2e, 0xbe, 0x1b, 0xa8, 0x9c,
+  0x54, 0xba, 0xc2, 0x23, 0x47, 0xa4, 0x13, 0x19, 0xf7, 0x3d, 0x51, 0x99, 0x8a, 0x6b, 0x53, 0x29,
+  0xb2, 0xfb, 0x7f, 0x7c, 0x32, 0x75, 0x33, 0x62, 0x58, 0x64, 0xda, 0xdc, 0x31, 0xe8, 0xb4, 0x49,
+  0x2f, 0x51, 0xca, 0x6d, 0x75, 0xaa, 0x97, 0x31, 0x08, 0x54, 0x92, 0xb7, 0xfa, 0x5f, 0x72, 0x22,
+  0x4c, 0x1c, 0xc8, 0x1d, 0x01, 0x93, 0xeb, 0xec, 0x0b, 0x08, 0x7c, 0x9c, 0x3f, 0xff, 0xfe, 0x3f,
+  0xf0, 0x0d, 0x25, 0xcf, 0x79, 0xc8, 0x17, 0x6c, 0x91, 0xbe, 0xdc, 0x02, 0x8c, 0x9a, 0x2f, 0x86,
+  0x70, 0x01, 0x26, 0x26, 0xf1, 0x13, 0xb2, 0x2e, 0xba, 0x50, 0xd5, 0xf4, 0xa8, 0x3f, 0x2b, 0xf7,
+  0xff, 0xaa, 0x26, 0x88, 0x0b, 0x6f, 0x5e, 0x58, 0x7f, 0xa6, 0x70, 0xfd, 0x15, 0x18, 0x27, 0x93,
+  0xda, 0x58, 0xae, 0x33, 0x8d, 0xba, 0x2e, 0x9c, 0x2c, 0x1b, 0x4f, 0x6f, 0xac, 0x9d, 0xc7, 0x5c,
+  0x2b, 0xb9, 0x92, 0x82, 0x2b, 0x2f, 0x00, 0xe3, 0x72, 0xf3, 0x01, 0xbc, 0x96, 0x9c, 0x3a, 0x4b,
+  0x79, 0x66, 0x61, 0xd7, 0xe1, 0x4d, 0xed, 0x27, 0xe6, 0xe7, 0xd6, 0x32, 0x03, 0x7a, 0x92, 0x76,
+  0xc1, 0x1e, 0xe4, 0xee, 0x0c, 0x70, 0xcc, 0xb5, 0x72, 0x86, 0x7a, 0xaf, 0x5e, 0x78, 0xf1, 0x54,
+  0x16, 0x0a, 0x02, 0x32, 0xe0, 0x0a, 0xdd, 0xcd, 0xaa, 0xc5, 0x56, 0x25, 0x75, 0x8d, 0x24, 0xfa,
+  0xf2, 0x9c, 0x6e, 0x98, 0xcc, 0x1d, 0x2a, 0xc3, 0xce, 0x47, 0xae, 0x56, 0xfd, 0xd7, 0x8a, 0x4c,
+  0xde, 0x6d, 0x52, 0xf6, 0xd7, 0x49, 0x0b, 0xbd, 0x87, 0x94, 0xed, 0xa7, 0x10, 0x90, 0x17, 0xa2,
+  0x6f, 0x49, 0x5e, 0xd3, 0xb4, 0x17, 0xc3, 0x6c, 0x09, 0x53, 0xe9, 0x70, 0x1f, 0x6a, 0xd9, 0x67,
+  0x1c, 0x0b, 0x77, 0xf4, 0x63, 0x82, 0x15, 0xd2, 0xc3, 0xbe, 0xf4, 0x61, 0xe7, 0xab, 0x9c, 0x5a,
+  0x32, 0x8f, 0x93, 0x33, 0x36, 0x4b, 0x7c, 0xee, 0x51, 0xaa, 0x29, 0x6c, 0x5f, 0x3f, 0xdd, 0x5c,
+  0x2e, 0x6f, 0x95, 0xd9, 0x66, 0xf9, 0x6c, 0xd7, 0xca, 0x5c, 0xf3, 0x95, 0xfd, 0x38, 0x80, 0xa5,
+  0x5b, 0x56, 0x6a, 0x0d, 0x59, 0x04, 0x9a, 0x4f, 0x42, 0xdd, 0x32, 0x6d, 0x7a, 0x95, 0x85, 0xd1,
+  0x54, 0xd0, 0x5c, 0xba, 0x5b, 0x74, 0x9d, 0x48, 0x55, 0xb6, 0xab, 0xf2, 0x80, 0xf8, 0x83, 0xe5,
+  0x5e, 0xff, 0x0f, 0x87, 0xa9, 0xf9, 0xf2, 0xdb, 0xd2, 0x34, 0x1c, 0xb1, 0x0b, 0x23, 0xbd, 0xd2,
+  0xfd, 0x63, 0xe7, 0xdb, 0x99, 0xeb, 0x41, 0x57, 0xb0, 0x8c, 0x7c, 0x5e, 0xbd, 0x11, 0xd2, 0x01,
+  0xcb, 0xb2, 0x53, 0x76, 0x2e, 0x3a, 0x67, 0xad, 0x3e, 0x61, 0xb9, 0xfc, 0x60, 0xe2, 0xf7, 0x3e,
+  0xce, 0xf6, 0x97, 0x6a, 0x98, 0x8f, 0x25, 0x7c, 0x9f, 0x52, 0x7a, 0x77, 0xed, 0x6c, 0x6e, 0x69,
+  0xee, 0xf6, 0xf6, 0xbb, 0xc8, 0xf4, 0xc8, 0xde, 0xd7, 0x16, 0x32, 0x2d, 0x00, 0xc1, 0x3f, 0xa2,
+  0x87, 0xe2, 0x22, 0xb2, 0x02, 0x1f, 0x58, 0xdc, 0x56, 0x9f, 0xe3, 0xe7, 0xf2, 0x0f, 0x36, 0x3d,
+  0xb4, 0x2d, 0x4b, 0xe3, 0x9f, 0xeb, 0x17, 0x5a, 0xad, 0x5d, 0xbf, 0xa1, 0x1f, 0x49, 0x5c, 0xb2,
+  0x9e, 0x42, 0xfd, 0x54, 0xae, 0x5e, 0x44, 0xa1, 0x6b, 0x3b, 0xf4, 0x79, 0xbb, 0xfd, 0xd7, 0x5c,
+  0x13, 0xc9, 0xc1, 0xb2, 0xa2, 0x94, 0x95, 0x2c, 0x5c, 0xb5, 0x64, 0x1d, 0x12, 0xa1, 0xff, 0x51,
+  0xb5, 0xfc, 0xbc, 0x5c, 0x2e, 0x17, 0xbb, 0x75, 0x9d, 0xd0, 0x32, 0x87, 0x28, 0x58, 0x54, 0xfa,
+  0x43, 0x94, 0x06, 0x65, 0xa7, 0x02, 0xb6, 0x13, 0x23, 0x40, 0x9f, 0x4f, 0x3c, 0xf9, 0xd2, 0x07,
+  0x34, 0x5b, 0xd8, 0xcc, 0x7d, 0x2e, 0x4f, 0xab, 0x8b, 0x95, 0xbe, 0x46, 0x36, 0xfd, 0xd6, 0x27,
+  0x21, 0xd7, 0x3a, 0xd5, 0x90, 0x4f, 0x03, 0x2f, 0x0b, 0xbf, 0xb3, 0x87, 0x84, 0xcb, 0xea, 0x7d,
+  0x31, 0x96, 0xaa, 0x48, 0xd9, 0xe3, 0x2d, 0xf5, 0x74, 0xdd, 0x99, 0xb8, 0x8c, 0xaa, 0x6a, 0x3f,
+  0xdb, 0x3e, 0x78, 0xc1, 0x10, 0x43, 0xa1, 0x6f, 0x48, 0x47, 0x94, 0x84, 0x52, 0xae, 0x70, 0x37,
+  0x0e, 0xf7, 0xcd, 0x67, 0x93, 0xef, 0x6c, 0xde, 0x51, 0xcf, 0xce, 0xde, 0xb9, 0xfe, 0xb3, 0xc9,
+  0x77, 0xca, 0x9e, 0x4d, 0xa6, 0x47, 0x93, 0xad, 0xda, 0xe2, 0x12, 0x34, 0x9c, 0x1b, 0x9e, 0x6b,
+  0xa8, 0xd6, 0xe0, 0x62, 0x49, 0x5d, 0x70, 0x6c, 0xa4, 0x17, 0x47, 0xc2, 0xf7, 0x65, 0xdc, 0xbf,
+  0x04, 0xde, 0x25, 0x78, 0x0d, 0xa9, 0x2b, 0x73, 0xa3, 0x48, 0x15, 0x7a, 0x3a, 0xd6, 0xe7, 0x7f,
+  0x96, 0x3d, 0x42, 0xee, 0x98, 0xc3, 0xd8, 0x64, 0xc7, 0xd7, 0x5b, 0xcd, 0x27, 0xfb, 0x74, 0x16,
+  0x80, 0x6b, 0x02, 0x19, 0xc7, 0x17, 0xd8, 0x52, 0xe3, 0xc3, 0x21, 0xf0, 0x84, 0x5e, 0x22, 0xab,
+  0x59, 0x91, 0x7b, 0x29, 0xd0, 0x1d, 0xea, 0x67, 0x15, 0x50, 0xbf, 0xf6, 0x58, 0x8b, 0x75, 0xdf,
+  0xa8, 0x71, 0xe8, 0x05, 0xb4, 0x8e, 0xb9, 0xe8, 0xe3, 0xb5, 0x16, 0x7c, 0x7c, 0x8b, 0xc5, 0x96,
+  0xbc, 0xdd, 0xa3, 0xec, 0x09, 0x7a, 0x13, 0x29, 0x69, 0x32, 0xd6, 0xc2, 0x4c, 0x82, 0xde, 0x06,
+  0xbd, 0x72, 0x64, 0xaa, 0x4b, 0xa7, 0xb3, 0x73, 0xb1, 0x92, 0xa3, 0x43, 0xa3, 0x64, 0x6b, 0x69,
+  0x6f, 0x4d, 0x56, 0x5b, 0xf5, 0x2e, 0x39, 0x6d, 0x34, 0x66, 0x01, 0xf1, 0xef, 0x75, 0x64, 0x69,
+  0x41, 0x46, 0x80, 0x9c, 0x14, 0xe1, 0x39, 0xbe, 0x92, 0x91, 0xfc, 0x97, 0xac, 0xe4, 0x17, 0x42,
+  0xb2, 0x97, 0xc8, 0xec, 0xa8, 0x37, 0x88, 0xf7, 0xd7, 0xf9, 0x92, 0x54, 0xee, 0x5d, 0x33, 0x3b,
+  0xe5, 0x6f, 0x6f, 0xc9, 0x7f, 0x69, 0xe4, 0xce, 0xfe, 0xe7, 0x41, 0xa0, 0xdf, 0x22, 0xec, 0x98,
+  0xf5, 0x28, 0x1f, 0x70, 0x01, 0xe5, 0x1f, 0xb4, 0xba, 0xe9, 0x02, 0x1e, 0x71, 0x13, 0x7f, 0x7b,
+  0x05, 0xc7, 0x4b, 0x90, 0x2f, 0x68, 0xc2, 0x56, 0x36, 0xcc, 0x5a, 0xab, 0xcf, 0x0d, 0x50, 0x86,
+  0x1a, 0xe9, 0x56, 0x58, 0xcf, 0x5b, 0xcf, 0x44, 0x11, 0x94, 0x9f, 0xf5, 0x64, 0x40, 0xaa, 0x71,
+  0x30, 0x77, 0x59, 0x72, 0xef, 0xb8, 0xa2, 0xfd, 0x44, 0x3f, 0xe5, 0x2f, 0xd5, 0xb3, 0x79, 0x1b,
+  0xc0, 0x0b, 0x09, 0x09, 0xfb, 0xa5, 0x0f, 0x1f, 0x2d, 0xcd, 0xbd, 0xe2, 0x21, 0xa6, 0x9b, 0x3f,
+  0x72, 0x83, 0x03, 0xa2, 0x05, 0xce, 0x3f, 0x82, 0xa3, 0x46, 0x2c, 0x68, 0xae, 0x82, 0x3b, 0x94,
+  0x7f, 0x4f, 0x05, 0xba, 0xfa, 0x52, 0x08, 0xd6, 0x76, 0xfe, 0x14, 0x7c, 0xb9, 0xdf, 0x96, 0x4f,
+  0xc6, 0xbb, 0x20, 0x4b, 0xb4, 0xc0, 0x42, 0x12, 0x3b, 0x1d, 0xa8, 0xd2, 0x89, 0xb4, 0x33, 0xd2,
+  0xef, 0xd9, 0xeb, 0xf8, 0x64, 0x28, 0x66, 0x3b, 0x27, 0xf8, 0x92, 0x0e, 0xf9, 0xb2, 0x11, 0x76,
+  0x89, 0x0f, 0xb6, 0xa6, 0x27, 0xf4, 0xd7, 0x23, 0x98, 0x8a, 0x04, 0xa8, 0xce, 0x04, 0x16, 0x8b,
+  0xaf, 0x13, 0x67, 0x0e, 0xf2, 0xc3, 0xac, 0x01, 0x80, 0xeb, 0x66, 0xed, 0xe5, 0xe1, 0xd1, 0x9e,
+  0x25, 0x8a, 0xcd, 0xda, 0xf3, 0x83, 0x93, 0xc3, 0xaf, 0x7e, 0xfd, 0xf5, 0x17, 0x87, 0x7b, 0x15,
+  0x0f, 0x11, 0x35, 0xa9, 0x88, 0x0e, 0xb0, 0x99, 0x2d, 0xf6, 0xe8, 0x19, 0xf9, 0x27, 0xf8, 0x25,
+  0x30, 0x70, 0xe5, 0x83, 0xc3, 0x93, 0x57, 0xaa, 0x50, 0xad, 0x81, 0xe1, 0xab, 0xf5, 0x62, 0x10,
+  0xda, 0x9b, 0x2d, 0xc4, 0x09, 0xdf, 0x0f, 0x52, 0xb3, 0xdf, 0x0f, 0xd2, 0xac, 0xc9, 0xb7, 0xdd,
+  0x83, 0x56, 0xfc, 0xde, 0x51, 0x44, 0x6a, 0x9d, 0x5e, 0x2e, 0x84, 0x03, 0x10, 0xf8, 0x9d, 0x52,
+  0x4f, 0xbe, 0x90, 0x63, 0x03, 0xeb, 0x69, 0x9c, 0xab, 0x26, 0x7d, 0xd0, 0x74, 0x8f, 0x7d, 0x71,
+  0xf2, 0xea, 0x25, 0xd0, 0x03, 0x67, 0xf4, 0xc6, 0x97, 0x75, 0x1c, 0xbc, 0x51, 0xbb, 0xba, 0x46,
+  0x41, 0x0e, 0x34, 0xe3, 0x83, 0x3e, 0x00, 0x40, 0x09, 0xc0, 0x2f, 0x82, 0x61, 0x29, 0xba, 0x12,
+  0xac, 0xa4, 0xd7, 0xed, 0x04, 0x49, 0xd9, 0x56, 0x18, 0xab, 0xad, 0xc2, 0x45, 0xf9, 0x4a, 0x89,
+  0xf5, 0xc4, 0x2b, 0x8b, 0x30, 0x2b, 0x04, 0xec, 0x0f, 0xbf, 0x65, 0x54, 0x6a, 0x34, 0x14, 0x21,
+  0x31, 0x12, 0xd4, 0xf4, 0x99, 0x07, 0x6a, 0x05, 0xeb, 0x39, 0x22, 0x11, 0x9e, 0x8b, 0x70, 0x1d,
+  0xa9, 0xca, 0x0a, 0xc3, 0xde, 0x8f, 0xd8, 0xff, 0xfb, 0x3f, 0xb0, 0xcf, 0x31, 0xa8, 0xc2, 0x72,
+  0xde, 0x09, 0xa1, 0x83, 0x44, 0x4e, 0x2b, 0x50, 0x90, 0x18, 0x69, 0xe4, 0xb7, 0x12, 0xb7, 0x8a,
+  0x22, 0xdc, 0x8f, 0xbf, 0xb9, 0x61, 0x95, 0x14, 0x46, 0x96, 0x84, 0x8e, 0x6b, 0x2c, 0xab, 0x51,
+  0x08, 0x7a, 0x9f, 0x05, 0xe1, 0x6c, 0x79, 0x86, 0x05, 0xa9, 0x88, 0x50, 0xcb, 0x2a, 0xaf, 0x0b,
+  0xb6, 0xf2, 0x34, 0x78, 0xec, 0x07, 0x89, 0x5b, 0xa7, 0x17, 0xcb, 0xe0, 0xf0, 0xf2, 0x0d, 0x33,
+  0x8b, 0x90, 0xfe, 0xaa, 0xe7, 0xe0, 0xb2, 0xf0, 0xf1, 0x36, 0x86, 0x74, 0x75, 0xc7, 0x0c, 0x2a,
+  0xeb, 0x89, 0x6f, 0x9e, 0x95, 0xf5, 0x72, 0xa4, 0x69, 0x9e, 0xa9, 0xcb, 0xfa, 0x1a, 0x64, 0xa8,
+  0x38, 0x41, 0x26, 0x03, 0x9a, 0x4d, 0x95, 0x1d, 0xca, 0x7e, 0x7c, 0xa9, 0xf9, 0x30, 0xd6, 0x73,
+  0xa9, 0x31, 0xc8, 0x11, 0x47, 0x19, 0x84, 0x3c, 0x79, 0x9a, 0xb5, 0x2f, 0x5f, 0x3d, 0x79, 0xfa,
+  0xeb, 0x93, 0xaf, 0x0f, 0xa1, 0xaf, 0x66, 0x09, 0x12, 0xa6, 0xee, 0x9c, 0x05, 0xae, 0xc0, 0xef,
+  0x8e, 0x38, 0x8d, 0x66, 0xed, 0x78, 0x8f, 0x75, 0x4c, 0xbd, 0x7f, 0xfb, 0x02, 0x49, 0x2a, 0x07,
+  0x3e, 0xae, 0x2a, 0x8b, 0x4c, 0x43, 0xed, 0x67, 0x9e, 0xf0, 0xdd, 0x65, 0x3c, 0x23, 0xfd, 0x77,
+  0x9c, 0xea, 0x5c, 0x82, 0xa7, 0x63, 0x6c, 0xfa, 0x95, 0x9e, 0x06, 0xaf, 0x2e, 0xbe, 0xbc, 0x2a,
+  0x7d, 0xe9, 0xd5, 0x5f, 0xd1, 0xb6, 0xf5, 0xff, 0xdf, 0xbe, 0xa9, 0xdd, 0x42, 0x52, 0x22, 0xd7,
+  0x81, 0xcf, 0x0f, 0x28, 0xf0, 0x71, 0xe2, 0xfb, 0x97, 0x9f, 0xb1, 0x63, 0x31, 0x16, 0xa1, 0xc0,
+  0x88, 0xf5, 0xf0, 0x89, 0x65, 0x5b, 0x42, 0x7d, 0xe3, 0xd0, 0xed, 0xaf, 0xa5, 0x4c, 0xd3, 0x9c,
+  0xf8, 0x7b, 0x36, 0x84, 0xcf, 0xb8, 0x87, 0x09, 0xff, 0x38, 0x50, 0x6b, 0x58, 0x62, 0x06, 0xaf,
+  0xd6, 0xb0, 0x18, 0x9f, 0xa4, 0x19, 0x24, 0x13, 0xa8, 0x79, 0x84, 0x65, 0x14, 0xd9, 0x1a, 0x6f,
+  0x67, 0x12, 0x65, 0x1e, 0x95, 0x5e, 0xf5, 0x5e, 0xa7, 0xd7, 0xa4, 0x1f, 0xba, 0x4d, 0xf9, 0x9c,
+  0x7f, 0x13, 0xdf, 0x09, 0xfc, 0x8d, 0xad, 0xd3, 0xe5, 0x57, 0x7c, 0xab, 0x29, 0xa0, 0x46, 0xc8,
+  0x12, 0x72, 0x5e, 0x08, 0x80, 0x5a, 0x80, 0x06, 0x4c, 0xbe, 0xe3, 0x5d, 0xdf, 0x55, 0x6f, 0x02,
+  0x4a, 0x4b, 0x51, 0xbc, 0xb9, 0xaa, 0x3b, 0xdc, 0x48, 0xa7, 0x6e, 0xd2, 0x13, 0xfd, 0xea, 0x15,
+  0x01, 0xf2, 0x13, 0xbc, 0x83, 0xdc, 0xa8, 0x3f, 0x63, 0x75, 0x7c, 0xa5, 0x89, 0x7e, 0xad, 0x10,
+  0x7e, 0xa2, 0x0f, 0x90, 0x50, 0x04, 0x90, 0xef, 0x99, 0x7f, 0x92, 0x7d, 0xc0, 0x77, 0xa0, 0x86,
+  0xe9, 0xdb, 0xa7, 0x2f, 0x73, 0x50, 0x2b, 0xc7, 0xa0, 0x5c, 0xf0, 0x0b, 0x4d, 0xa4, 0x21, 0x9a,
+  0x2c, 0xad, 0x7c, 0xa3, 0xe3, 0xa8, 0xfc, 0xa9, 0xb6, 0x7e, 0xe3, 0x12, 0xbe, 0x21, 0x80, 0x20,
+  0xdb, 0xf2, 0x41, 0x38, 0x18, 0x64, 0x34, 0x15, 0xf2, 0x65, 0x5c, 0x58, 0xd5, 0xb0, 0xd4, 0xd3,
+  0xb8, 0x4e, 0x79, 0xc8, 0xd2, 0x6a, 0xe4, 0x02, 0x7a, 0xf4, 0x30, 0x1e, 0x5a, 0xbb, 0x11, 0x5f,
+  0xe0, 0x73, 0x21, 0xab, 0x4b, 0x22, 0x2a, 0xcf, 0xed, 0x97, 0x14, 0x88, 0x5b, 0x1f, 0x01, 0xc9,
+  0x9f, 0x40, 0x90, 0xc5, 0x51, 0x10, 0xa9, 0xe6, 0xef, 0xd2, 0x83, 0x38, 0xdf, 0xa4, 0xeb, 0x91,
+  0x82, 0x67, 0x7f, 0xf2, 0xa4, 0x69, 0x75, 0xa5, 0x0f, 0xc4, 0x35, 0xfa, 0xf2, 0xa0, 0x19, 0xbf,
+  0x77, 0xdd, 0xf9, 0x26, 0xf7, 0x90, 0xfe, 0x01, 0x1e, 0x09, 0x53, 0x17, 0x5d, 0x5b, 0xf4, 0x33,
+  0xf9, 0xe4, 0x44, 0x3a, 0x6b, 0x67, 0x59, 0x35, 0x91, 0xf5, 0x35, 0x8d, 0xfc, 0x22, 0xb2, 0x39,
+  0x88, 0xa2, 0x79, 0xbc, 0xad, 0xcf, 0x85, 0x28, 0xbc, 0x6d, 0x24, 0xf4, 0x43, 0x1c, 0x1a, 0x7f,
+  0xbc, 0x9a, 0x1d, 0x2c, 0x13, 0x09, 0xfb, 0xdb, 0x12, 0xa5, 0x54, 0x2d, 0x31, 0xa9, 0x92, 0xb0,
+  0x3f, 0xfe, 0x90, 0xc7, 0x30, 0xff, 0x4d, 0x8d, 0x66, 0x7e, 0x84, 0x32, 0x04, 0x7f, 0xfc, 0x21,
+  0x3b, 0xfc, 0x3d, 0x4a, 0x37, 0xa9, 0xa4, 0x71, 0xf6, 0x4e, 0x2f, 0x5a, 0xe0, 0x9a, 0x44, 0xce,
+  0x7d, 0xad, 0x21, 0xbf, 0x2a, 0x63, 0x1e, 0x2c, 0xe6, 0xc9, 0x2f, 0x22, 0xf7, 0x49, 0x8a, 0xa6,
+  0x01, 0x4f, 0xe8, 0x5b, 0xd8, 0xdf, 0x35, 0xdf, 0x9d, 0x70, 0x78, 0xb3, 0xaa, 0x5e, 0xa3, 0x2f,
+  0xec, 0x6f, 0xa3, 0xce, 0x00, 0x5f, 0xce, 0xb7, 0xfc, 0xb1, 0xa9, 0xac, 0xab, 0x59, 0x1a, 0x77,
+  0xa4, 0xdf, 0x06, 0x77, 0xf5, 0xbe, 0x3d, 0x2d, 0x77, 0xa9, 0x8f, 0x85, 0x5d, 0x09, 0x02, 0x3f,
+  0x09, 0xf7, 0x58, 0x7f, 0x09, 0x6e, 0xa9, 0x52, 0x32, 0xbe, 0x45, 0xd7, 0xb0, 0xcd, 0x56, 0xe1,
+  0x93, 0x74, 0xd9, 0xf7, 0xe8, 0xfa, 0xcb, 0xc7, 0x93, 0x6f, 0xc6, 0xc8, 0x1b, 0xb5, 0x14, 0x1f,
+  0xb4, 0xdd, 0xa8, 0xc6, 0x52, 0x4c, 0x4f, 0x4e, 0x0e, 0x9f, 0x18, 0x7e, 0xc2, 0xfb, 0xc0, 0xd5,
+  0xfa, 0x7c, 0xde, 0x8d, 0xd0, 0x7d, 0x62, 0x8f, 0x70, 0x25, 0x79, 0x89, 0xd7, 0x4f, 0x31, 0xc6,
+  0x8b, 0xea, 0xb6, 0x19, 0x49, 0x4b, 0x09, 0xac, 0x57, 0x9a, 0xf4, 0x6b, 0xc6, 0x8b, 0x67, 0x37,
+  0xf4, 0xfb, 0x7c, 0xa7, 0xf1, 0xcc, 0xdf, 0xaf, 0xfd, 0x0f, 0xaa, 0x8a, 0x4e, 0xb3, 0xcc, 0x87,
+  0x00, 0x00,
+};
+static const WebAsset WEB_INDEX = {WEB_INDEX_GZ, sizeof(WEB_INDEX_GZ), "text/html", "\"17a37b053f1b6cec\""};
+
+// injection.html: 13144 -> 9296 (minify) -> 2545 byte (gzip)
+static const uint8_t WEB_INJECTION_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x5a, 0xe9, 0x6e, 0xdb, 0x48,
+  0x12, 0xfe, 0xaf, 0xa7, 0xe8, 0x99, 0x20, 0x20, 0x85, 0xb5, 0x4e, 0x5b, 0x76, 0x46, 0x87, 0x07,
+  0x8e, 0x0f, 0xc0, 0xbb, 0x48, 0x6c, 0x58, 0x4a, 0x80, 0xc5, 0x62, 0x31, 0xa0, 0xc8, 0xa6, 0xd4,
+  0x09, 0xc9, 0xe6, 0x92, 0x4d, 0x1f, 0x13, 0xf8, 0x81, 0xe6, 0x65, 0xe6, 0x99, 0xb6, 0xaa, 0xbb,
+  0x79, 0x8a, 0x94, 0x64, 0xaf, 0xe7, 0xd7, 0x22, 0x48, 0x44, 0x36, 0xab, 0xbe, 0x3a, 0xba, 0xae,
+  0x26, 0x33, 0xfd, 0xe9, 0xe2, 0xe6, 0x7c, 0xf1, 0xcf, 0xdb, 0x4b, 0xb2, 0x16, 0xbe, 0x77, 0xda,
+  0x9a, 0xa6, 0x3f, 0xd4, 0x72, 0xe0, 0x47, 0x30, 0xe1, 0xd1, 0xd3, 0xf3, 0x9b, 0xbb, 0x4b, 0xb2,
+  0xa0, 0xb1, 0x98, 0xf6, 0xd4, 0x42, 0x6b, 0xea, 0x53, 0x61, 0x11, 0x7b, 0x6d, 0x45, 0x31, 0x15,
+  0x33, 0xe3, 0xcb, 0xe2, 0xaa, 0xf3, 0xc1, 0x48, 0x97, 0x03, 0xcb, 0xa7, 0x33, 0xe3, 0x9e, 0xd1,
+  0x87, 0x90, 0x47, 0xc2, 0x20, 0x36, 0x0f, 0x04, 0x0d, 0x80, 0xec, 0x81, 0x39, 0x62, 0x3d, 0x73,
+  0xe8, 0x3d, 0xb3, 0x69, 0x47, 0xde, 0x1c, 0x10, 0x16, 0x30, 0xc1, 0x2c, 0xaf, 0x13, 0xdb, 0x96,
+  0x47, 0x67, 0x83, 0x6e, 0x1f, 0x61, 0x62, 0xf1, 0x84, 0x52, 0x96, 0xdc, 0x79, 0x22, 0x3f, 0x88,
+  0x0b, 0xfc, 0x1d, 0xd7, 0xf2, 0x99, 0xf7, 0x34, 0x26, 0x67, 0x11, 0x50, 0x4f, 0x88, 0x6f, 0x45,
+  0x2b, 0x16, 0x8c, 0xc9, 0xb0, 0x1f, 0x3e, 0x4e, 0xc8, 0xd2, 0xb2, 0xbf, 0xaf, 0x22, 0x9e, 0x04,
+  0xce, 0x98, 0xbc, 0x73, 0xfb, 0xf8, 0x67, 0x42, 0x9e, 0x5b, 0x5d, 0x94, 0x6c, 0xb1, 0x80, 0x46,
+  0x80, 0xe2, 0x5b, 0x8f, 0x4a, 0xe6, 0x98, 0x1c, 0xf7, 0x25, 0x57, 0x8a, 0xd1, 0x27, 0x56, 0x22,
+  0x78, 0x19, 0xe5, 0x61, 0xcd, 0x04, 0x9d, 0x90, 0xd0, 0x72, 0x1c, 0x16, 0xac, 0x32, 0x39, 0x3c,
+  0x72, 0x68, 0xd4, 0x89, 0x2c, 0x87, 0x25, 0xf1, 0x98, 0x0c, 0xe4, 0x22, 0xc8, 0x71, 0x79, 0xe4,
+  0x77, 0x90, 0x35, 0x94, 0x82, 0x72, 0xd5, 0x88, 0xd4, 0xc3, 0xb3, 0x96, 0xd4, 0x83, 0x27, 0x0e,
+  0x8b, 0x43, 0xcf, 0x02, 0x23, 0x96, 0x1e, 0xb7, 0xbf, 0xa7, 0x0a, 0x74, 0x96, 0x5c, 0x08, 0xee,
+  0x8f, 0xc9, 0x08, 0xd1, 0xa4, 0xb1, 0x0f, 0x94, 0xad, 0xd6, 0x02, 0xe8, 0xb8, 0xe7, 0x20, 0x40,
+  0x4c, 0x3d, 0x6a, 0x0b, 0x74, 0x56, 0x98, 0x88, 0x7f, 0x89, 0xa7, 0x10, 0xfc, 0x2b, 0xe8, 0xa3,
+  0x30, 0xfe, 0x0d, 0xa8, 0xda, 0xa8, 0x41, 0xbf, 0xff, 0xbe, 0xa0, 0xf0, 0xa0, 0xa0, 0x30, 0xdc,
+  0x81, 0x2a, 0x31, 0xf7, 0x98, 0x43, 0xde, 0x39, 0x8e, 0xb3, 0x61, 0xc8, 0x48, 0xd1, 0x3e, 0x76,
+  0x62, 0xf6, 0xbb, 0xe4, 0xd6, 0xcf, 0x61, 0x49, 0xda, 0xb7, 0x14, 0x01, 0x08, 0xca, 0xb1, 0x81,
+  0x9e, 0x1c, 0x96, 0x7c, 0x88, 0xe2, 0x52, 0x18, 0x25, 0x32, 0xe0, 0x01, 0xad, 0x17, 0x64, 0x27,
+  0x51, 0xcc, 0x81, 0x22, 0xe4, 0x0c, 0x02, 0x23, 0xd2, 0x36, 0x83, 0x68, 0x0a, 0x38, 0xc7, 0x61,
+  0x26, 0xb2, 0x13, 0x46, 0x0c, 0xf0, 0x31, 0x04, 0x4a, 0x1b, 0xdc, 0xef, 0x9f, 0x2c, 0x5d, 0x17,
+  0x70, 0xb8, 0x87, 0x30, 0x7a, 0xab, 0xca, 0x3c, 0xe3, 0x35, 0xbf, 0x97, 0xdb, 0x5e, 0xe1, 0x1c,
+  0x1d, 0x2f, 0x0f, 0x33, 0xda, 0x98, 0x42, 0x80, 0x38, 0x35, 0x12, 0x8e, 0xed, 0x93, 0xd1, 0x89,
+  0xd3, 0x20, 0x21, 0xe3, 0xaa, 0x97, 0x31, 0x3a, 0x1a, 0x2d, 0x8f, 0x87, 0x39, 0x75, 0x62, 0xdb,
+  0x34, 0x8e, 0xab, 0x54, 0xc3, 0x0f, 0xd6, 0xc9, 0xd1, 0xa8, 0x49, 0x82, 0xe2, 0xa9, 0xc7, 0x1f,
+  0xd0, 0x13, 0x7a, 0x78, 0x94, 0xd3, 0x0a, 0x1e, 0x56, 0x49, 0x1c, 0xfb, 0x70, 0xd4, 0x0c, 0x0e,
+  0x0c, 0xf5, 0xc8, 0xf6, 0x87, 0xe1, 0xe1, 0xa1, 0xf2, 0x4e, 0x04, 0xe9, 0x0f, 0x5b, 0x1d, 0x17,
+  0x83, 0x76, 0x15, 0x31, 0x70, 0x09, 0xfe, 0xdb, 0x11, 0xd4, 0x87, 0x35, 0x41, 0x3b, 0x20, 0x21,
+  0xf1, 0x03, 0x4c, 0x05, 0x37, 0x4a, 0xff, 0x02, 0x8d, 0x15, 0xaa, 0x20, 0x99, 0xd4, 0x24, 0x43,
+  0x8a, 0x5d, 0x95, 0x4e, 0x7f, 0xa1, 0x36, 0x75, 0x27, 0xe5, 0x28, 0xab, 0x0f, 0x20, 0x0c, 0xfd,
+  0x8e, 0xe5, 0xb1, 0x15, 0x00, 0xdb, 0x54, 0xc5, 0x10, 0x00, 0xdf, 0x5b, 0x5e, 0x42, 0xd3, 0x7a,
+  0xa1, 0xc2, 0x69, 0x78, 0xd4, 0x90, 0x53, 0xda, 0x35, 0xef, 0x8e, 0x7e, 0x19, 0xf5, 0x47, 0x27,
+  0x92, 0x3d, 0xcd, 0xd2, 0x62, 0x34, 0x4a, 0xf6, 0x94, 0x36, 0x8d, 0x8a, 0xba, 0xb4, 0x05, 0xfe,
+  0x58, 0x58, 0x22, 0x89, 0x3b, 0xa1, 0x15, 0x48, 0x98, 0x3d, 0xec, 0xa8, 0x71, 0x8e, 0x06, 0x69,
+  0x88, 0x1a, 0xe7, 0x88, 0x3a, 0x8e, 0x55, 0x9b, 0xd6, 0xf6, 0x21, 0x3d, 0xb6, 0x97, 0xb9, 0xb2,
+  0x83, 0xd1, 0xe8, 0x64, 0x78, 0x54, 0xc4, 0xa4, 0x51, 0xc4, 0x37, 0xf6, 0xdc, 0xfd, 0xe0, 0x9c,
+  0x34, 0x20, 0xba, 0x23, 0xbb, 0x84, 0x78, 0x32, 0x1c, 0xd8, 0x65, 0x44, 0x16, 0xb8, 0x7c, 0x43,
+  0xc5, 0x01, 0xb5, 0xdd, 0x41, 0x2d, 0xe0, 0x92, 0xd2, 0x11, 0x2d, 0x00, 0xf6, 0xed, 0xd1, 0xd1,
+  0xb1, 0x34, 0x7b, 0xda, 0xd3, 0x15, 0x7f, 0xda, 0xd3, 0x8d, 0x07, 0x4b, 0x3f, 0xfc, 0x38, 0xec,
+  0x9e, 0xd8, 0x9e, 0x15, 0xc7, 0x33, 0x23, 0xab, 0xe5, 0xd8, 0x20, 0xd6, 0x83, 0x62, 0x53, 0x82,
+  0xbb, 0x12, 0x69, 0x1a, 0xbd, 0x46, 0xed, 0x72, 0x65, 0x55, 0x6e, 0xbb, 0x71, 0xfa, 0x95, 0x7b,
+  0xc2, 0x5a, 0xd1, 0x69, 0x0f, 0x1e, 0x95, 0x09, 0x64, 0x58, 0x19, 0x84, 0x39, 0x70, 0xa9, 0x88,
+  0xbe, 0xca, 0x95, 0xd3, 0x7e, 0xb7, 0xdf, 0x27, 0x5f, 0x53, 0x8e, 0x4d, 0xc6, 0xad, 0xf2, 0xce,
+  0x93, 0x28, 0x82, 0xd0, 0xdd, 0x2e, 0xcf, 0x56, 0x44, 0x45, 0x79, 0x67, 0xaf, 0x94, 0x77, 0x47,
+  0x63, 0x06, 0xdb, 0x16, 0xd8, 0x3b, 0x4c, 0x8c, 0x32, 0xba, 0xa2, 0xd4, 0x3f, 0xff, 0xa8, 0x88,
+  0xdd, 0xc4, 0xc8, 0x7b, 0x20, 0x2a, 0xa0, 0x92, 0x09, 0xd6, 0xb0, 0x51, 0xc5, 0xe2, 0x13, 0x77,
+  0x00, 0x0a, 0x77, 0x8b, 0xe0, 0xe5, 0x78, 0xda, 0x93, 0x04, 0xd8, 0xea, 0x65, 0x6b, 0x93, 0xa2,
+  0x33, 0x42, 0xc2, 0x03, 0x18, 0x2d, 0x82, 0x15, 0x74, 0xb9, 0x24, 0x74, 0xa0, 0xce, 0xe0, 0xea,
+  0x85, 0xaa, 0x43, 0x66, 0x1b, 0xe1, 0x79, 0x28, 0x18, 0x0f, 0x88, 0xd4, 0x7b, 0x66, 0xf8, 0x56,
+  0x90, 0x58, 0x60, 0xe3, 0x27, 0xf9, 0x4b, 0xae, 0x83, 0x6f, 0x00, 0x09, 0xcf, 0xa7, 0x3d, 0x45,
+  0xb7, 0xc1, 0x30, 0xec, 0xf7, 0x7d, 0xcb, 0x38, 0xc5, 0x9f, 0x33, 0x72, 0x06, 0xcd, 0x7f, 0x0f,
+  0x9e, 0x28, 0x09, 0x04, 0xf3, 0xc1, 0x8a, 0x3b, 0x75, 0x21, 0x0d, 0x21, 0xe6, 0x90, 0xf8, 0x2c,
+  0x68, 0x17, 0xb8, 0x7a, 0xca, 0xa2, 0xb2, 0x8f, 0xd0, 0x3c, 0x3f, 0x37, 0xc2, 0x48, 0x9d, 0x56,
+  0xaa, 0x19, 0x85, 0xac, 0x52, 0x43, 0x50, 0xc4, 0x83, 0x55, 0x1a, 0x28, 0xa9, 0xdf, 0xf4, 0x2a,
+  0x99, 0xc6, 0xc0, 0x54, 0x0c, 0x12, 0x7c, 0xbe, 0xc0, 0x99, 0xa0, 0xc6, 0x0d, 0x48, 0x0b, 0x88,
+  0x61, 0xae, 0x07, 0x8d, 0xed, 0x88, 0x49, 0x95, 0x8d, 0xd3, 0x33, 0xe7, 0x5b, 0x02, 0xb2, 0x97,
+  0x1e, 0x25, 0x16, 0xd4, 0x75, 0x26, 0x12, 0x30, 0xec, 0x81, 0x89, 0x35, 0x51, 0x8e, 0x95, 0x03,
+  0x5c, 0xc4, 0xbd, 0x69, 0x2f, 0xdc, 0xb5, 0xf3, 0x52, 0x40, 0x06, 0x72, 0xae, 0xf8, 0x0c, 0x22,
+  0xb3, 0x7b, 0x66, 0x64, 0xad, 0x44, 0xce, 0x06, 0x95, 0x30, 0xc9, 0xb8, 0xe6, 0x50, 0x2c, 0x30,
+  0xcb, 0xcf, 0xd2, 0x85, 0x71, 0xc1, 0xd8, 0x8c, 0x2a, 0xf5, 0xe4, 0x69, 0xff, 0xbd, 0xb6, 0x2f,
+  0x8f, 0x29, 0x39, 0x26, 0x11, 0x35, 0x26, 0x45, 0x18, 0x47, 0x15, 0xbd, 0xb4, 0x04, 0xdc, 0xb9,
+  0x99, 0xd1, 0x37, 0x70, 0x34, 0x9c, 0x19, 0x30, 0x3f, 0x19, 0xe9, 0x5e, 0xf7, 0x37, 0x43, 0x30,
+  0xd3, 0xc6, 0x14, 0x6b, 0x16, 0xab, 0x5e, 0x23, 0x43, 0x71, 0xd3, 0x1f, 0xcb, 0x04, 0x1a, 0x43,
+  0x90, 0xe7, 0x82, 0xba, 0xcf, 0x9e, 0xc2, 0x2c, 0x55, 0x18, 0x54, 0x94, 0x6a, 0xe0, 0xfe, 0x48,
+  0x7c, 0x14, 0x81, 0x94, 0xeb, 0x31, 0xfb, 0xbb, 0x5e, 0xc2, 0x8c, 0xc1, 0x88, 0x9f, 0xe3, 0x8d,
+  0xae, 0x76, 0x0a, 0xae, 0x11, 0x17, 0xfb, 0x7b, 0x0a, 0xca, 0xc3, 0x2a, 0x26, 0x0f, 0x35, 0x64,
+  0xd3, 0x9e, 0xcc, 0x81, 0x64, 0xb7, 0x0c, 0xd5, 0x9e, 0xb4, 0x98, 0x64, 0xe9, 0xb3, 0xaa, 0xf2,
+  0x6b, 0xfe, 0x70, 0x05, 0x61, 0x21, 0x75, 0x97, 0xcf, 0x09, 0x24, 0xd9, 0xb9, 0xc7, 0x13, 0xa7,
+  0x00, 0xae, 0x5d, 0x87, 0xf1, 0x23, 0x91, 0xc0, 0xcf, 0x16, 0x72, 0x21, 0x90, 0x42, 0x4d, 0xd1,
+  0x17, 0x5c, 0xf2, 0x9a, 0xf4, 0x1e, 0x22, 0xbd, 0x6d, 0xec, 0x59, 0x79, 0x92, 0x10, 0xb2, 0xe1,
+  0xcb, 0xed, 0x62, 0x5c, 0x1f, 0x1a, 0x72, 0x82, 0x96, 0x82, 0x91, 0x50, 0x1f, 0x5b, 0xe4, 0x65,
+  0x44, 0xff, 0x93, 0xb0, 0x88, 0x3a, 0x2f, 0x2b, 0x74, 0x01, 0x83, 0x95, 0xcf, 0xd7, 0xb7, 0x3b,
+  0xc5, 0x21, 0xa1, 0x16, 0x27, 0x2f, 0x5f, 0x27, 0xee, 0x3b, 0xe4, 0xf1, 0x3c, 0x61, 0x60, 0xe2,
+  0x3f, 0x6e, 0x2e, 0x2e, 0x7f, 0x9b, 0x7f, 0xb9, 0xde, 0x6d, 0x68, 0xc6, 0xa3, 0xc5, 0xe7, 0xf7,
+  0xaf, 0xd3, 0x61, 0x6d, 0xc5, 0xcc, 0xbb, 0x83, 0x9a, 0x48, 0x4c, 0x79, 0x49, 0x92, 0x6f, 0xac,
+  0xbd, 0x53, 0x0b, 0xcd, 0xa5, 0x75, 0x48, 0xef, 0xb0, 0x7d, 0xf1, 0xc0, 0x7b, 0xca, 0x35, 0xd0,
+  0xc1, 0xa7, 0xd8, 0x55, 0x20, 0x18, 0x4d, 0xa1, 0x98, 0x86, 0x99, 0xec, 0x31, 0xd0, 0xec, 0x12,
+  0x4f, 0xc4, 0xc5, 0x50, 0x43, 0x13, 0x0a, 0xc5, 0x58, 0xa2, 0xc5, 0x31, 0xd4, 0xbf, 0xb9, 0xac,
+  0xba, 0xb5, 0x15, 0xb9, 0x31, 0x49, 0x8a, 0x2e, 0xd2, 0x24, 0x75, 0x33, 0xa9, 0x1e, 0x14, 0x71,
+  0xe0, 0x56, 0xc7, 0xa5, 0xe6, 0x6a, 0x90, 0x1d, 0x2a, 0xf2, 0x24, 0xfa, 0xf9, 0x81, 0x05, 0x0e,
+  0x7f, 0xe8, 0xc2, 0x59, 0xd1, 0xc2, 0x42, 0xdd, 0x5d, 0x47, 0xd4, 0x9d, 0x19, 0x3d, 0xe3, 0xe7,
+  0xd3, 0x8f, 0x30, 0x71, 0x61, 0x42, 0x7d, 0x82, 0x81, 0x88, 0x7c, 0xa2, 0x41, 0xb2, 0x99, 0x54,
+  0xfa, 0x47, 0x95, 0x79, 0x12, 0x47, 0x36, 0x70, 0x7a, 0xec, 0x9e, 0x76, 0xbf, 0xc5, 0xa8, 0xbf,
+  0x5a, 0xcf, 0x08, 0x4e, 0x5b, 0x1e, 0x15, 0x44, 0x77, 0x92, 0x85, 0xee, 0xc3, 0x64, 0x46, 0xd2,
+  0xd6, 0x3a, 0x91, 0xcf, 0xb1, 0x41, 0x9f, 0x41, 0x4b, 0xb9, 0xc7, 0x47, 0xae, 0xe5, 0xc5, 0x74,
+  0xd2, 0x72, 0x93, 0x40, 0x36, 0x19, 0x52, 0xd3, 0xa9, 0xc9, 0x8f, 0x16, 0x58, 0x05, 0xfb, 0xe1,
+  0x2b, 0x34, 0x87, 0xdb, 0x89, 0x0f, 0x02, 0xba, 0x2b, 0x2a, 0x2e, 0x3d, 0x8a, 0x97, 0x1f, 0x9f,
+  0xae, 0x1d, 0x33, 0xef, 0xfc, 0x6d, 0x55, 0x58, 0x27, 0x9a, 0x4f, 0xfb, 0x7d, 0x1b, 0x6b, 0xb1,
+  0xab, 0xb6, 0x53, 0xbe, 0x4a, 0x4b, 0xdc, 0xc6, 0x5f, 0xed, 0x9e, 0x19, 0x46, 0xa5, 0x4d, 0xee,
+  0xd4, 0xa1, 0xd0, 0x51, 0x33, 0x8c, 0x6a, 0x27, 0xdc, 0x06, 0xb2, 0xd1, 0x35, 0x11, 0x65, 0x63,
+  0x43, 0x50, 0xd4, 0xa4, 0xc5, 0x5c, 0x62, 0x2a, 0x9f, 0xce, 0xf2, 0x3d, 0x92, 0xee, 0x2e, 0x5b,
+  0xd3, 0xc5, 0xa8, 0x3c, 0x57, 0xaf, 0x5f, 0x70, 0x37, 0xab, 0x93, 0x01, 0xec, 0x6b, 0x45, 0xf7,
+  0x2a, 0xc7, 0xbe, 0xb3, 0x01, 0x20, 0xe9, 0xcd, 0xea, 0xca, 0xc8, 0xfe, 0x0c, 0xa9, 0x8d, 0xfc,
+  0x8d, 0x03, 0xce, 0xa4, 0x55, 0x35, 0xb8, 0x2b, 0x33, 0xa9, 0x9b, 0xef, 0xb9, 0x21, 0x5f, 0x93,
+  0x00, 0xe5, 0x33, 0xa1, 0x10, 0x6b, 0xa4, 0x6c, 0xb5, 0x9a, 0xe1, 0xf6, 0x30, 0xba, 0x6e, 0xca,
+  0xdb, 0xc3, 0x70, 0xa0, 0xf7, 0x21, 0xef, 0x6c, 0xc2, 0x52, 0x26, 0xcc, 0x38, 0x05, 0x26, 0x1d,
+  0x30, 0xec, 0xc0, 0xfc, 0x90, 0x08, 0x0a, 0x2e, 0x80, 0x89, 0x10, 0x32, 0x35, 0xf8, 0x4b, 0x9c,
+  0x80, 0x25, 0xa7, 0xc9, 0x07, 0xe9, 0x4c, 0xba, 0x87, 0x17, 0x8a, 0x53, 0xeb, 0x6e, 0xeb, 0xaf,
+  0xd8, 0x23, 0x75, 0xaa, 0x3b, 0x9e, 0x19, 0x8c, 0x40, 0xd1, 0x5f, 0x6a, 0x2c, 0xfc, 0xa9, 0x14,
+  0x96, 0x7c, 0xfe, 0x52, 0xa3, 0x17, 0x58, 0xbc, 0x3b, 0x95, 0xb2, 0xc2, 0x50, 0xb1, 0x4f, 0xbd,
+  0x29, 0xf8, 0x1b, 0x31, 0xde, 0x1b, 0x2a, 0x99, 0xf2, 0xca, 0x86, 0xc0, 0x2e, 0x15, 0xf6, 0xda,
+  0x34, 0x60, 0x92, 0x17, 0xbf, 0x65, 0x58, 0xbf, 0xea, 0xd9, 0x10, 0xd8, 0x94, 0x06, 0xad, 0xae,
+  0x58, 0xd3, 0xc0, 0x84, 0x03, 0x53, 0x08, 0xc9, 0x0e, 0xb6, 0x9f, 0x92, 0xf4, 0x5a, 0x8a, 0x33,
+  0xdb, 0x29, 0x09, 0xce, 0x35, 0xf8, 0x18, 0x8b, 0x02, 0x07, 0x83, 0x3d, 0xbe, 0x32, 0x8d, 0xcc,
+  0x20, 0x6d, 0xa0, 0x33, 0x36, 0x0e, 0x34, 0x72, 0xbb, 0xe2, 0x81, 0xc2, 0x28, 0x08, 0xda, 0xa1,
+  0xbe, 0x1b, 0x85, 0xa1, 0x9c, 0x11, 0xa9, 0x01, 0x56, 0xc8, 0x7a, 0xf8, 0x6e, 0xb3, 0x93, 0xc5,
+  0xf0, 0xaf, 0x96, 0xfc, 0x99, 0x49, 0x48, 0x10, 0xf8, 0xc3, 0xa7, 0x62, 0xcd, 0xe1, 0xe0, 0x6e,
+  0xdc, 0xde, 0xcc, 0x17, 0xc6, 0xf3, 0x56, 0xab, 0xbe, 0xc5, 0x3c, 0xd8, 0xb4, 0x4a, 0x69, 0x84,
+  0x77, 0x5d, 0xdd, 0x8c, 0x51, 0x85, 0x52, 0xaf, 0x10, 0x11, 0xd6, 0xf4, 0xc6, 0xfd, 0xca, 0xa6,
+  0xdf, 0x76, 0x63, 0x44, 0x6c, 0xe1, 0x55, 0x43, 0x6e, 0x0d, 0x2b, 0x0b, 0x3c, 0x16, 0xd0, 0x4e,
+  0x5a, 0x45, 0x9a, 0x21, 0xb2, 0x01, 0x76, 0x37, 0x88, 0xda, 0x2b, 0x35, 0x33, 0x98, 0x86, 0x1c,
+  0x36, 0xa4, 0xf6, 0x90, 0x2d, 0x1d, 0x52, 0x5b, 0x69, 0xd4, 0x66, 0xb6, 0xb3, 0x0c, 0x6e, 0x0a,
+  0x2f, 0x4c, 0x15, 0x3a, 0xbb, 0xfb, 0xf2, 0xd9, 0x78, 0x45, 0x64, 0xfd, 0x7f, 0xfa, 0x1b, 0x73,
+  0xb1, 0x92, 0x09, 0xe8, 0xe7, 0xcd, 0xf4, 0x49, 0x4f, 0x3d, 0x6f, 0x97, 0x3d, 0x70, 0xc6, 0x7a,
+  0xa3, 0xe4, 0xa9, 0x1b, 0xaa, 0x80, 0x89, 0x8a, 0x8f, 0x72, 0xa2, 0x8b, 0xcd, 0x76, 0x83, 0x17,
+  0x78, 0x18, 0x52, 0xc7, 0x48, 0x0d, 0xde, 0x27, 0xb8, 0xe6, 0x8b, 0x9b, 0xdb, 0x37, 0x88, 0xae,
+  0xd7, 0x2b, 0x59, 0xdc, 0x95, 0x32, 0xfb, 0xb6, 0x72, 0xbe, 0x2d, 0x5c, 0xf7, 0x8e, 0xb9, 0xe6,
+  0xb0, 0xdd, 0x19, 0xf1, 0x2f, 0x08, 0xd7, 0x8d, 0xb6, 0xa5, 0xdd, 0xe1, 0x43, 0x55, 0xb4, 0x56,
+  0x34, 0x9f, 0x88, 0x5f, 0x3e, 0xd9, 0xee, 0xdd, 0x6c, 0xd3, 0x13, 0xd1, 0x16, 0x93, 0x36, 0x06,
+  0xd6, 0x4a, 0x7f, 0xd4, 0xea, 0x96, 0xec, 0xc9, 0x8f, 0xf4, 0xdb, 0xf6, 0x2a, 0x3b, 0xc2, 0xb7,
+  0xb7, 0x8c, 0x73, 0x05, 0xd0, 0x9a, 0xd3, 0x3d, 0xc0, 0xcb, 0x8b, 0x6e, 0x18, 0xc9, 0xdf, 0x0b,
+  0xea, 0x5a, 0x70, 0x9a, 0x33, 0xb3, 0xa9, 0x1a, 0x8f, 0x72, 0x17, 0x32, 0x34, 0x49, 0x40, 0x1f,
+  0xc8, 0x95, 0xbe, 0x35, 0xf7, 0x50, 0x2a, 0xc3, 0x50, 0xa1, 0x0d, 0xa2, 0xf0, 0xf5, 0x40, 0x86,
+  0x88, 0x9c, 0xa6, 0x7c, 0x05, 0xd0, 0x3e, 0x68, 0xe1, 0x49, 0xbe, 0xf2, 0x04, 0x4f, 0xeb, 0xf0,
+  0x24, 0x3f, 0x6f, 0x57, 0x9e, 0x67, 0xc7, 0x69, 0x20, 0xba, 0x1b, 0x93, 0xfe, 0x41, 0x2b, 0x3d,
+  0xd9, 0x8c, 0xab, 0x85, 0xea, 0xa0, 0xa5, 0x5f, 0x26, 0x4b, 0x32, 0xfd, 0x50, 0x5e, 0xe7, 0x6f,
+  0x60, 0x15, 0x02, 0x0c, 0x5b, 0x70, 0xeb, 0xc3, 0x19, 0x12, 0xad, 0x05, 0x61, 0xd4, 0x84, 0xfd,
+  0xe2, 0xd7, 0xf3, 0x9b, 0xb9, 0x88, 0x58, 0xb0, 0x32, 0xdb, 0xad, 0xe7, 0x49, 0x9e, 0xf7, 0xea,
+  0x38, 0xfb, 0x82, 0x52, 0xa4, 0x38, 0x2e, 0xb2, 0x5c, 0x97, 0x9d, 0x5c, 0x2b, 0x07, 0x2e, 0xca,
+  0x1f, 0xa7, 0x8b, 0x13, 0x45, 0xa2, 0x75, 0x2e, 0x93, 0xe8, 0x45, 0x4d, 0x92, 0x9b, 0x52, 0xa6,
+  0xca, 0xd7, 0x35, 0xe1, 0x5d, 0xf3, 0x73, 0xb5, 0x5f, 0xd1, 0x15, 0xa3, 0x9e, 0xb3, 0x2d, 0x5d,
+  0xf4, 0x6b, 0x84, 0xb6, 0x1a, 0xe8, 0x14, 0x3d, 0xc6, 0x92, 0xba, 0xd2, 0x1f, 0x87, 0x1a, 0xa4,
+  0x80, 0x3b, 0xe5, 0xc4, 0x6b, 0x0e, 0x65, 0x95, 0x2a, 0x36, 0x00, 0x15, 0xa1, 0x1d, 0xd4, 0x12,
+  0x2b, 0x7e, 0xab, 0x5c, 0xf2, 0x0f, 0x5a, 0xf8, 0xbd, 0x82, 0x46, 0xf1, 0x98, 0xfc, 0x30, 0x74,
+  0xfe, 0x74, 0x16, 0x4f, 0x21, 0x35, 0x80, 0xc2, 0x0a, 0xa1, 0xfc, 0xaa, 0xb3, 0x7b, 0x0f, 0x5d,
+  0x6e, 0x3c, 0x1f, 0xc8, 0x4f, 0xda, 0x63, 0xf2, 0xf7, 0xf9, 0xcd, 0x67, 0xc8, 0x0f, 0xdc, 0x3d,
+  0xe6, 0x3e, 0xc9, 0x3a, 0x0b, 0x9b, 0xf8, 0x82, 0x3d, 0x8b, 0xe4, 0x0b, 0x0e, 0xb5, 0x5f, 0xca,
+  0x41, 0xca, 0xae, 0x6d, 0x0e, 0xda, 0x78, 0xe5, 0x91, 0xba, 0x4a, 0x62, 0x15, 0x67, 0x37, 0x85,
+  0xf5, 0x92, 0x4a, 0xa3, 0x39, 0x2a, 0xa7, 0x08, 0x19, 0x53, 0xca, 0x81, 0xd8, 0xb0, 0x35, 0xb9,
+  0x9b, 0x78, 0xde, 0xd3, 0x4f, 0xe4, 0x8e, 0xba, 0x14, 0x42, 0x05, 0x42, 0xe3, 0xfa, 0x62, 0x2c,
+  0x5b, 0xb9, 0x56, 0x24, 0x4a, 0x1f, 0x5c, 0x3b, 0x93, 0xbd, 0x0a, 0x8d, 0xec, 0x24, 0x66, 0xb1,
+  0x09, 0xee, 0x6b, 0x80, 0xfc, 0x24, 0xd6, 0xa8, 0xfe, 0x95, 0xc5, 0x3c, 0x50, 0x1b, 0xa6, 0x39,
+  0x65, 0x83, 0x2c, 0x1a, 0x25, 0x55, 0x0b, 0x75, 0x52, 0x43, 0x34, 0x17, 0x3d, 0xd8, 0x3a, 0x88,
+  0x05, 0x88, 0x2b, 0xf5, 0x1d, 0xee, 0x7f, 0xde, 0xba, 0xb7, 0xb1, 0xf1, 0x52, 0x2a, 0xa3, 0xf7,
+  0x08, 0xbf, 0xca, 0xe6, 0x36, 0x4a, 0xc6, 0xdc, 0xc4, 0xdd, 0x06, 0xa6, 0x4d, 0xbe, 0xd0, 0xe2,
+  0x03, 0xc8, 0x8d, 0x3b, 0xfd, 0x35, 0x4e, 0x85, 0xf9, 0xb6, 0xe6, 0x51, 0xfa, 0xbc, 0x56, 0xed,
+  0x49, 0xc5, 0xb2, 0x54, 0xc8, 0x57, 0x3c, 0xc5, 0x91, 0xaf, 0xdb, 0x9a, 0x5d, 0xe9, 0x23, 0x5a,
+  0x2d, 0xaa, 0xa6, 0xa8, 0xa2, 0x9e, 0x6d, 0x43, 0xad, 0x7e, 0x27, 0xab, 0x05, 0xae, 0xad, 0x30,
+  0x12, 0xfb, 0xcf, 0x3f, 0x8c, 0x37, 0x2f, 0x6d, 0xce, 0xd6, 0xa2, 0xf6, 0x8c, 0xe2, 0x02, 0x98,
+  0x63, 0x2f, 0xb1, 0xa9, 0xc6, 0x66, 0x79, 0x73, 0xb2, 0xf9, 0xad, 0xf4, 0x02, 0x6f, 0x42, 0x7a,
+  0x3d, 0x38, 0xca, 0xc8, 0xff, 0xa1, 0xc3, 0x7e, 0xa7, 0xe9, 0xd4, 0xd2, 0x2a, 0xbc, 0x3f, 0xec,
+  0xe9, 0x2f, 0xb5, 0x3d, 0xf5, 0x1f, 0x87, 0xfe, 0x0b, 0x55, 0x4c, 0x15, 0x62, 0x50, 0x24, 0x00,
+  0x00,
+};
+static const WebAsset WEB_INJECTION = {WEB_INJECTION_GZ, sizeof(WEB_INJECTION_GZ), "text/html", "\"64f92a26ccfac02d\""};
+
+// injection_normal.html: 4584 -> 3552 (minify) -> 1228 byte (gzip)
+static const uint8_t WEB_INJECTION_NORMAL_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x57, 0x6d, 0x4f, 0xdb, 0x3a,
+  0x14, 0xfe, 0xde, 0x5f, 0xe1, 0xbb, 0x09, 0xb9, 0xbd, 0x5b, 0xd2, 0x14, 0x28, 0x2f, 0x6d, 0xd3,
+  0x2b, 0xc6, 0x98, 0xb4, 0x0f, 0x8c, 0x09, 0x18, 0xd2, 0x3e, 0x5d, 0xb9, 0x89, 0xdb, 0x9a, 0x39,
+  0x76, 0xe4, 0x38, 0x2d, 0x0c, 0xf1, 0x83, 0xf6, 0x67, 0xf6, 0x9b, 0xee, 0xb1, 0x9d, 0xa4, 0x4d,
+  0x28, 0x45, 0x62, 0x57, 0x08, 0xd2, 0xda, 0xcf, 0x79, 0xce, 0x73, 0x5e, 0x7c, 0x1c, 0x46, 0x7f,
+  0x7d, 0xbc, 0x38, 0xbd, 0xfe, 0xfe, 0xf5, 0x0c, 0xcd, 0x75, 0xc2, 0xc7, 0xad, 0x51, 0xf9, 0xa0,
+  0x24, 0x86, 0x87, 0x66, 0x9a, 0xd3, 0xf1, 0xe9, 0xc5, 0xe5, 0x19, 0xba, 0xa6, 0x99, 0x46, 0x1e,
+  0xfa, 0x22, 0x55, 0x42, 0x38, 0xfa, 0x2c, 0x6e, 0x69, 0xa4, 0x99, 0x14, 0xa3, 0xae, 0xc3, 0xb4,
+  0x46, 0x09, 0xd5, 0x04, 0x45, 0x73, 0xa2, 0x32, 0xaa, 0x43, 0xfc, 0xed, 0xfa, 0x93, 0x77, 0x84,
+  0xcb, 0x65, 0x41, 0x12, 0x1a, 0xe2, 0x05, 0xa3, 0xcb, 0x54, 0x2a, 0x8d, 0x51, 0x24, 0x85, 0xa6,
+  0x02, 0x60, 0x4b, 0x16, 0xeb, 0x79, 0x18, 0xd3, 0x05, 0x8b, 0xa8, 0x67, 0xbf, 0xbc, 0x47, 0x4c,
+  0x30, 0xcd, 0x08, 0xf7, 0xb2, 0x88, 0x70, 0x1a, 0xf6, 0xfc, 0xc0, 0xd0, 0x64, 0xfa, 0xde, 0x78,
+  0x99, 0xc8, 0xf8, 0x1e, 0x3d, 0xa0, 0x29, 0xd8, 0x7b, 0x53, 0x92, 0x30, 0x7e, 0x3f, 0x40, 0x27,
+  0x0a, 0xd0, 0x43, 0x94, 0x10, 0x35, 0x63, 0x62, 0x80, 0x76, 0x83, 0xf4, 0x6e, 0x88, 0x26, 0x24,
+  0xfa, 0x31, 0x53, 0x32, 0x17, 0xf1, 0x00, 0xbd, 0x9d, 0x06, 0xe6, 0x67, 0x88, 0x1e, 0x5b, 0xbe,
+  0xf1, 0x4c, 0x98, 0xa0, 0x0a, 0x58, 0x12, 0x72, 0xe7, 0x7c, 0x0e, 0xd0, 0x41, 0x60, 0xad, 0x4a,
+  0x8e, 0x00, 0x91, 0x5c, 0xcb, 0x3a, 0xcb, 0x72, 0xce, 0x34, 0x1d, 0xa2, 0x94, 0xc4, 0x31, 0x13,
+  0xb3, 0xca, 0x8f, 0x54, 0x31, 0x55, 0x9e, 0x22, 0x31, 0xcb, 0xb3, 0x01, 0xea, 0xd9, 0xc5, 0xc2,
+  0x8f, 0x92, 0xdc, 0x4b, 0x89, 0xa0, 0x1c, 0x7c, 0xd5, 0xf5, 0x1c, 0x4d, 0x8f, 0xa7, 0xe4, 0x25,
+  0xae, 0xa3, 0x75, 0x45, 0x06, 0x81, 0x5c, 0x08, 0x19, 0x67, 0x06, 0x56, 0x8f, 0xe4, 0x19, 0x14,
+  0xec, 0x15, 0x11, 0xf6, 0x82, 0x60, 0x67, 0x45, 0xd7, 0x5b, 0x01, 0x27, 0xb9, 0xd6, 0x52, 0x78,
+  0x46, 0x5c, 0x0a, 0x70, 0x4d, 0xef, 0xb4, 0x47, 0x38, 0x9b, 0x01, 0x2a, 0x82, 0x1a, 0x51, 0xb5,
+  0x51, 0xc4, 0x44, 0x0b, 0x00, 0x57, 0x01, 0xf4, 0xfa, 0xb0, 0xb3, 0x57, 0xcb, 0x61, 0x6f, 0x2d,
+  0xa6, 0x01, 0x12, 0x52, 0xd0, 0x27, 0x11, 0xf6, 0x0d, 0x22, 0xca, 0x55, 0x26, 0x01, 0x91, 0x4a,
+  0xe6, 0xbc, 0xd9, 0xe2, 0x66, 0xec, 0x27, 0x05, 0x8e, 0x83, 0x22, 0x9d, 0xe0, 0xce, 0xcb, 0x34,
+  0x51, 0xba, 0x99, 0xca, 0xdd, 0x23, 0x72, 0xb8, 0xdf, 0x07, 0x16, 0xc9, 0x0d, 0x49, 0x51, 0xa4,
+  0xca, 0x42, 0xa6, 0x4d, 0x83, 0x38, 0xda, 0xeb, 0x3f, 0x6b, 0x60, 0x90, 0x4d, 0x83, 0x83, 0xe8,
+  0xb0, 0x7f, 0x18, 0x6f, 0x30, 0x50, 0x70, 0x46, 0x20, 0xf8, 0x0c, 0x0c, 0x62, 0x96, 0xa5, 0x9c,
+  0x40, 0x2f, 0xce, 0x14, 0x03, 0xa8, 0xf9, 0xeb, 0x69, 0x9a, 0xc0, 0x9a, 0xa6, 0x50, 0x28, 0x9e,
+  0x27, 0xc2, 0x34, 0xc7, 0x54, 0x95, 0xbf, 0x80, 0x21, 0xa9, 0x4b, 0xdb, 0xc6, 0xf4, 0x16, 0xdc,
+  0x4d, 0x2d, 0xf4, 0x98, 0x46, 0x74, 0x3a, 0xac, 0xe7, 0x7d, 0x73, 0x5a, 0x37, 0xd5, 0x11, 0x88,
+  0x17, 0x84, 0xe7, 0xb4, 0x3c, 0x41, 0x2e, 0xc9, 0xbb, 0xfb, 0x06, 0x6f, 0x17, 0x96, 0x94, 0xcd,
+  0xe6, 0x7a, 0x00, 0x84, 0x7c, 0x15, 0xf1, 0xdb, 0xfd, 0xe3, 0x7e, 0xd0, 0x3f, 0xb4, 0xe6, 0x9c,
+  0x4c, 0x6c, 0x3b, 0xaf, 0xd7, 0xc8, 0x9a, 0x97, 0xd8, 0x32, 0x5b, 0x2e, 0x26, 0x6f, 0x22, 0xa1,
+  0xb9, 0x92, 0x42, 0xd2, 0x63, 0x6b, 0xd4, 0x2d, 0xce, 0xf1, 0xa8, 0x5b, 0x4c, 0x18, 0x73, 0xa0,
+  0xe1, 0x11, 0xb3, 0x05, 0x8a, 0x38, 0xc9, 0xb2, 0x10, 0x57, 0x7d, 0x6d, 0x8e, 0xfd, 0xbc, 0x37,
+  0x6e, 0x4e, 0x1c, 0x74, 0x2e, 0x63, 0x0a, 0xf6, 0x3d, 0xd8, 0x4e, 0xc7, 0xe7, 0x44, 0xe4, 0xb0,
+  0xcb, 0xaa, 0xdd, 0xe2, 0xe0, 0x41, 0xdb, 0xeb, 0x39, 0x22, 0xf1, 0x6d, 0x0e, 0x6d, 0x33, 0xe1,
+  0x14, 0x11, 0xa8, 0x06, 0xd3, 0xb9, 0x31, 0x4d, 0xeb, 0x0e, 0xcb, 0x3a, 0xe2, 0x8d, 0xcb, 0x8d,
+  0x55, 0x9b, 0x00, 0x3c, 0xbe, 0x91, 0x5c, 0x93, 0x19, 0x70, 0xc1, 0x56, 0x1d, 0x60, 0x13, 0x8c,
+  0x11, 0x8b, 0xe1, 0xa3, 0x03, 0xdd, 0xd8, 0x95, 0x71, 0xe0, 0x07, 0x01, 0xba, 0x29, 0x2d, 0x9e,
+  0x1a, 0x6e, 0xf5, 0x77, 0x9a, 0x2b, 0x05, 0x45, 0xdc, 0xee, 0x2f, 0x72, 0xa0, 0x75, 0x7f, 0x27,
+  0xaf, 0xf4, 0x77, 0x49, 0x33, 0x06, 0x89, 0x13, 0xd1, 0x0b, 0x21, 0xaa, 0x0a, 0xb7, 0xee, 0xf5,
+  0xf7, 0xaf, 0x86, 0xdb, 0xa7, 0x1c, 0xb5, 0xf9, 0x68, 0x2b, 0xbd, 0x37, 0x3e, 0x29, 0x4b, 0x84,
+  0x4e, 0xdd, 0x2e, 0x54, 0x79, 0xaf, 0x6e, 0xd6, 0x9c, 0x7d, 0xc6, 0xd2, 0xf5, 0xe4, 0x54, 0xaa,
+  0x10, 0x57, 0x45, 0xbe, 0xb2, 0x38, 0xbc, 0xa2, 0x1c, 0xa0, 0x51, 0x06, 0xbe, 0xac, 0xe8, 0x0a,
+  0xf5, 0xd1, 0x1d, 0x5b, 0x50, 0xbd, 0x03, 0x9d, 0x09, 0xdb, 0xe3, 0x51, 0xd7, 0xb2, 0x01, 0x2b,
+  0x13, 0x69, 0xae, 0x91, 0xbe, 0x4f, 0xe1, 0xe2, 0x52, 0x44, 0xcc, 0x8a, 0x80, 0x9b, 0x1e, 0xea,
+  0xc2, 0x30, 0x4a, 0x98, 0x08, 0x71, 0x80, 0xcd, 0xdd, 0x12, 0x62, 0x98, 0xb9, 0x18, 0xd9, 0x6c,
+  0xd9, 0x35, 0x29, 0xe0, 0x7a, 0x04, 0xa6, 0x10, 0xe7, 0x69, 0x0c, 0x93, 0xa1, 0x12, 0xd7, 0xd6,
+  0x73, 0x96, 0xb9, 0xa3, 0xd9, 0xc1, 0x1b, 0xd3, 0xb5, 0x3e, 0xa4, 0x0d, 0xc2, 0x7d, 0xaf, 0x76,
+  0x61, 0x18, 0x57, 0x13, 0xd2, 0xfa, 0xe1, 0x2c, 0xfa, 0x01, 0xa2, 0xcc, 0xf7, 0xea, 0xe0, 0xb4,
+  0x81, 0xfb, 0xca, 0xce, 0xd0, 0xb5, 0xdb, 0xdb, 0x11, 0x6d, 0x61, 0x94, 0x69, 0x8d, 0x50, 0xa6,
+  0x0d, 0x3e, 0x98, 0xb0, 0x9b, 0xe8, 0x9e, 0x16, 0xde, 0x9e, 0xfc, 0x10, 0x3f, 0x7f, 0xbf, 0x78,
+  0xc0, 0x35, 0x70, 0x97, 0xc8, 0xf3, 0x21, 0x9a, 0x71, 0xb8, 0x12, 0xf4, 0x66, 0xc9, 0x44, 0x2c,
+  0x97, 0x3e, 0x97, 0x11, 0x31, 0x02, 0xfc, 0xb9, 0xa2, 0xd3, 0x10, 0x77, 0xf1, 0x9b, 0xf1, 0x07,
+  0x33, 0xca, 0xb5, 0x44, 0xe7, 0xd0, 0x27, 0xe8, 0x9c, 0x8a, 0xfc, 0x59, 0x71, 0x59, 0xa4, 0x58,
+  0xaa, 0x51, 0xa6, 0x22, 0xb0, 0xe4, 0x6c, 0x41, 0xfd, 0x5b, 0x98, 0x05, 0xd0, 0x10, 0x76, 0xbd,
+  0x02, 0x8c, 0x5b, 0xd3, 0x5c, 0xb8, 0x19, 0xd3, 0x2c, 0x9f, 0xab, 0x1c, 0x7a, 0x68, 0xc5, 0x32,
+  0xca, 0x13, 0x08, 0xca, 0x9f, 0x51, 0x7d, 0xc6, 0xa9, 0xf9, 0xf8, 0xe1, 0xfe, 0x73, 0xdc, 0x7e,
+  0xda, 0x72, 0x1d, 0xdf, 0x24, 0xe2, 0xd4, 0xbd, 0x07, 0xa1, 0xd0, 0x75, 0x09, 0x7a, 0x87, 0xf0,
+  0x0e, 0x1e, 0xb6, 0xa6, 0x54, 0x47, 0xf3, 0x36, 0xee, 0xc2, 0x9b, 0xd4, 0xbf, 0x95, 0xe5, 0x3f,
+  0x45, 0x23, 0x01, 0xc8, 0xf9, 0x6b, 0xf9, 0x7a, 0x4e, 0x45, 0x1b, 0x8e, 0x60, 0x2a, 0x45, 0x46,
+  0x51, 0x38, 0x46, 0xe5, 0x67, 0x4b, 0xde, 0xee, 0x94, 0x10, 0x50, 0x4b, 0xcc, 0x36, 0x1c, 0x9b,
+  0x4c, 0x72, 0x0a, 0xe9, 0x9a, 0xb5, 0xf1, 0xea, 0xb4, 0xb9, 0x70, 0xe2, 0x01, 0x7e, 0x5f, 0x30,
+  0x77, 0x86, 0xad, 0xc7, 0x55, 0xb4, 0xcd, 0x2e, 0x82, 0x38, 0x37, 0x0b, 0x04, 0xa0, 0xa6, 0xe1,
+  0xe5, 0xb7, 0x2f, 0xf8, 0x15, 0xda, 0x1e, 0x5a, 0x35, 0x75, 0xab, 0x71, 0x6f, 0xdd, 0xd3, 0x18,
+  0x1b, 0x51, 0x4d, 0x61, 0xb5, 0x6e, 0x7c, 0x41, 0xd7, 0xd5, 0xf5, 0xc5, 0xd7, 0xff, 0x59, 0x98,
+  0x4c, 0x53, 0x27, 0xec, 0xe5, 0xba, 0x17, 0xe3, 0xa2, 0x53, 0x5c, 0xc0, 0x21, 0xdc, 0xf3, 0x7f,
+  0xd0, 0x2d, 0x38, 0x30, 0x6d, 0xd2, 0x48, 0x07, 0xcc, 0x7e, 0x70, 0x71, 0x59, 0xdc, 0x66, 0x56,
+  0xff, 0xd6, 0x9e, 0xac, 0x5d, 0x4f, 0x4d, 0x0f, 0xc6, 0xda, 0x2f, 0x10, 0xbe, 0x96, 0x9f, 0xd8,
+  0x1d, 0x8d, 0xdb, 0xbb, 0x1d, 0xd3, 0xa1, 0xe8, 0x06, 0x6f, 0xd1, 0x5e, 0xbb, 0x84, 0x36, 0xb2,
+  0x16, 0x88, 0x26, 0xeb, 0xc9, 0x36, 0xd6, 0xe6, 0x3d, 0xb3, 0x91, 0x78, 0x05, 0x6a, 0x72, 0xff,
+  0xfe, 0x85, 0x5f, 0x55, 0x24, 0x9b, 0x44, 0xbf, 0xda, 0x47, 0x7f, 0x9b, 0xd7, 0xe8, 0x4e, 0xc5,
+  0x1e, 0x74, 0xfe, 0xa4, 0x88, 0x2f, 0x92, 0x97, 0xe3, 0xe0, 0xd1, 0x74, 0xa0, 0x80, 0xae, 0x3b,
+  0x5b, 0x80, 0x65, 0xd6, 0xae, 0x17, 0x1a, 0x34, 0xac, 0xcd, 0xaa, 0x6e, 0xf1, 0x42, 0xd5, 0x75,
+  0xff, 0xc8, 0xfd, 0x07, 0x53, 0xdf, 0x65, 0x4f, 0xe0, 0x0d, 0x00, 0x00,
+};
+static const WebAsset WEB_INJECTION_NORMAL = {WEB_INJECTION_NORMAL_GZ, sizeof(WEB_INJECTION_NORMAL_GZ), "text/html", "\"d1e24226d7ef8587\""};
+
+// injection_200ma.html: 7620 -> 5709 (minify) -> 1889 byte (gzip)
+static const uint8_t WEB_INJECTION_200MA_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0xdb, 0x6e, 0xdb, 0x38,
+  0x10, 0x7d, 0xf7, 0x57, 0xb0, 0x5d, 0xb4, 0xb2, 0xb7, 0x91, 0x2c, 0x3b, 0x71, 0xda, 0xfa, 0xb6,
+  0xc8, 0xad, 0x40, 0x1f, 0xba, 0x2d, 0xda, 0x6c, 0x81, 0x7d, 0x5a, 0xd0, 0x12, 0x6d, 0xb3, 0x95,
+  0x44, 0x81, 0xa4, 0xe2, 0x64, 0x83, 0x7c, 0x50, 0x7f, 0xa6, 0xdf, 0xb4, 0x33, 0xa4, 0x24, 0x4b,
+  0xb2, 0x62, 0x17, 0xc1, 0x22, 0x88, 0x2f, 0xd4, 0xcc, 0x99, 0xe1, 0xcc, 0x99, 0x19, 0xd2, 0xd3,
+  0x67, 0x97, 0x1f, 0x2f, 0xae, 0xff, 0xfe, 0x74, 0x45, 0xd6, 0x3a, 0x8e, 0xe6, 0x9d, 0x69, 0xf1,
+  0xc6, 0x68, 0x08, 0x6f, 0x9a, 0xeb, 0x88, 0xcd, 0x2f, 0x3e, 0x7e, 0xbe, 0x22, 0xd7, 0x4c, 0x69,
+  0xe2, 0x92, 0xa1, 0xef, 0xc7, 0x67, 0xe4, 0x7d, 0xf2, 0x8d, 0x05, 0x9a, 0x8b, 0x64, 0xda, 0xb7,
+  0x22, 0x9d, 0x69, 0xcc, 0x34, 0x25, 0xc1, 0x9a, 0x4a, 0xc5, 0xf4, 0xcc, 0xf9, 0xeb, 0xfa, 0x9d,
+  0xfb, 0xc6, 0x29, 0x96, 0x13, 0x1a, 0xb3, 0x99, 0x73, 0xc3, 0xd9, 0x26, 0x15, 0x52, 0x3b, 0x24,
+  0x10, 0x89, 0x66, 0x09, 0x88, 0x6d, 0x78, 0xa8, 0xd7, 0xb3, 0x90, 0xdd, 0xf0, 0x80, 0xb9, 0xe6,
+  0xcb, 0x11, 0xe1, 0x09, 0xd7, 0x9c, 0x46, 0xae, 0x0a, 0x68, 0xc4, 0x66, 0x03, 0xcf, 0x47, 0x18,
+  0xa5, 0xef, 0xd0, 0xca, 0x42, 0x84, 0x77, 0xe4, 0x9e, 0x2c, 0x41, 0xdf, 0x5d, 0xd2, 0x98, 0x47,
+  0x77, 0x63, 0x72, 0x26, 0x41, 0x7a, 0x42, 0x62, 0x2a, 0x57, 0x3c, 0x19, 0x83, 0x83, 0xe9, 0xed,
+  0x84, 0x2c, 0x68, 0xf0, 0x7d, 0x25, 0x45, 0x96, 0x84, 0x63, 0xf2, 0xdb, 0xd2, 0xc7, 0xbf, 0x09,
+  0x79, 0xe8, 0x78, 0x68, 0x99, 0xf2, 0x84, 0x49, 0x40, 0x89, 0xe9, 0xad, 0xb5, 0x39, 0x26, 0xa7,
+  0xbe, 0xd1, 0x2a, 0x30, 0x7c, 0x42, 0x33, 0x2d, 0xea, 0x28, 0x9b, 0x35, 0xd7, 0x6c, 0x42, 0x52,
+  0x1a, 0x86, 0x3c, 0x59, 0x95, 0x76, 0x84, 0x0c, 0x99, 0x74, 0x25, 0x0d, 0x79, 0xa6, 0xc6, 0x64,
+  0x60, 0x16, 0xc1, 0x8e, 0xd2, 0x54, 0x67, 0xca, 0x4d, 0x69, 0xc2, 0x22, 0x30, 0x55, 0x77, 0x67,
+  0xb9, 0x3c, 0x0e, 0xc2, 0x43, 0x50, 0x6f, 0xaa, 0x0e, 0xa1, 0x04, 0xf1, 0x0b, 0x19, 0xb0, 0x03,
+  0x5f, 0x95, 0x88, 0x78, 0x88, 0x68, 0x8c, 0xd2, 0xd7, 0xd6, 0x68, 0x16, 0x04, 0x4c, 0x3d, 0x62,
+  0x35, 0x3c, 0x61, 0x61, 0x48, 0x5b, 0x21, 0x82, 0x63, 0x76, 0x1a, 0x2c, 0x0c, 0x84, 0xe6, 0x31,
+  0xf8, 0x10, 0x72, 0x95, 0x46, 0xb4, 0x8c, 0xb4, 0xe2, 0xff, 0xb2, 0x31, 0x39, 0x31, 0x1e, 0x99,
+  0x85, 0x0d, 0xe3, 0xab, 0xb5, 0x1e, 0x03, 0x56, 0x04, 0xfb, 0xd0, 0xec, 0x56, 0xbb, 0x34, 0xe2,
+  0x2b, 0x70, 0x34, 0x80, 0xb4, 0x32, 0x39, 0x81, 0x0c, 0x47, 0x42, 0xa2, 0xd5, 0xe0, 0x78, 0x74,
+  0x32, 0xda, 0xdd, 0x08, 0x98, 0x4a, 0xa5, 0x58, 0x49, 0x74, 0x77, 0x41, 0x31, 0x1b, 0x79, 0x26,
+  0x06, 0xbe, 0xff, 0x62, 0x42, 0xd6, 0xb9, 0x81, 0xb6, 0x64, 0xbe, 0x59, 0xbe, 0x5d, 0xd2, 0x47,
+  0x22, 0x2f, 0x6e, 0x98, 0x5c, 0x46, 0x62, 0x33, 0x26, 0x6b, 0x1e, 0x86, 0x2c, 0xd9, 0x6f, 0x78,
+  0xc9, 0x23, 0x0c, 0x53, 0x61, 0xcc, 0x9a, 0xae, 0x07, 0x2d, 0x77, 0x5f, 0x4b, 0x9a, 0x28, 0x8e,
+  0x84, 0x1f, 0x5b, 0x47, 0x89, 0xef, 0x8d, 0x14, 0x61, 0x54, 0x31, 0x03, 0xb9, 0xc8, 0xb4, 0x16,
+  0x89, 0x8b, 0x7a, 0x29, 0x20, 0xb6, 0x45, 0xa4, 0xc5, 0x91, 0x85, 0x4e, 0x40, 0xb8, 0xa4, 0xc1,
+  0x60, 0x04, 0x4f, 0x8e, 0x6b, 0x44, 0x1c, 0x54, 0x98, 0x31, 0x26, 0x89, 0x48, 0xd8, 0xce, 0xc6,
+  0x47, 0x28, 0x11, 0x64, 0x52, 0x61, 0xbc, 0x53, 0xc1, 0xad, 0xb5, 0x4a, 0xde, 0x06, 0xa7, 0x39,
+  0x27, 0xc1, 0x9c, 0x0b, 0xbc, 0x94, 0xba, 0x49, 0x8d, 0xe1, 0x1b, 0xfa, 0x1a, 0x77, 0x99, 0x27,
+  0x2d, 0x67, 0x7a, 0xa9, 0x21, 0xd2, 0x1d, 0x2e, 0xe5, 0x61, 0x69, 0x55, 0x40, 0xc9, 0xa6, 0xc2,
+  0x69, 0xf0, 0x7a, 0xf4, 0x3a, 0x6c, 0x51, 0x90, 0xd0, 0x67, 0x60, 0xf3, 0x0a, 0x14, 0x72, 0xd2,
+  0x8d, 0xc9, 0x4a, 0x72, 0x10, 0xc5, 0x57, 0x57, 0xb3, 0x18, 0xd6, 0x34, 0x73, 0x41, 0x31, 0x8b,
+  0x13, 0xcc, 0xf3, 0x52, 0x16, 0xff, 0x20, 0x43, 0x53, 0x1b, 0xb6, 0xd6, 0xf0, 0xe6, 0xd8, 0x4d,
+  0x5f, 0xd8, 0x5b, 0x16, 0xb0, 0xe5, 0xa4, 0x1e, 0xf7, 0xf6, 0xb0, 0xb6, 0xe5, 0x11, 0x80, 0x6f,
+  0x68, 0x94, 0xb1, 0x7a, 0x71, 0x0c, 0x4f, 0x1e, 0x29, 0x8e, 0xa2, 0x10, 0x4e, 0xde, 0x8e, 0xfc,
+  0x91, 0x2d, 0xd3, 0x88, 0x2e, 0x4c, 0x79, 0x56, 0x73, 0x64, 0xd4, 0x0b, 0xd9, 0x22, 0x5a, 0x76,
+  0x4f, 0xee, 0x42, 0x00, 0xb9, 0xe2, 0xdc, 0xa5, 0x87, 0xce, 0xb4, 0x9f, 0x37, 0xc3, 0x69, 0x3f,
+  0xef, 0xd2, 0xd8, 0x15, 0xe1, 0x2d, 0xe4, 0x37, 0x24, 0x88, 0xa8, 0x52, 0x33, 0xa7, 0x6c, 0x73,
+  0xd8, 0x3b, 0xd7, 0x83, 0xb9, 0xed, 0xda, 0x67, 0xd0, 0xd4, 0xaa, 0xad, 0x1b, 0x1e, 0x74, 0xa6,
+  0xe9, 0x1c, 0x97, 0x63, 0xaa, 0x39, 0xf4, 0xdb, 0xe8, 0x0e, 0xda, 0x2f, 0x3e, 0x47, 0x46, 0x49,
+  0xd8, 0x31, 0xc9, 0x12, 0xcd, 0xa3, 0xbc, 0xeb, 0x73, 0x45, 0x20, 0xa6, 0xc1, 0x9a, 0x85, 0x47,
+  0x44, 0xaf, 0x59, 0x42, 0x2c, 0x9b, 0x86, 0x6e, 0xcc, 0x93, 0x4c, 0x33, 0xf0, 0x1f, 0xa4, 0x43,
+  0xb1, 0x01, 0xe8, 0xb4, 0xee, 0x4f, 0x91, 0x66, 0xa7, 0x75, 0xb9, 0xb1, 0x6a, 0xe2, 0xe3, 0xcc,
+  0xbf, 0x8a, 0x48, 0xd3, 0x15, 0x9b, 0xf6, 0xe1, 0x51, 0x5d, 0xc0, 0xc4, 0xdf, 0x21, 0x3c, 0x84,
+  0x8f, 0x56, 0xe8, 0xab, 0x59, 0x99, 0xfb, 0x9e, 0xef, 0x93, 0xaf, 0x85, 0xc6, 0xae, 0xe2, 0x5e,
+  0x7b, 0x17, 0x76, 0xc7, 0xfb, 0xed, 0xe5, 0x61, 0xa9, 0xda, 0x3b, 0x7b, 0xa2, 0xbd, 0xcf, 0x4c,
+  0x71, 0x08, 0x60, 0x12, 0x1c, 0xd8, 0xa2, 0x2c, 0xe5, 0xaa, 0x56, 0x7f, 0xfe, 0x68, 0x98, 0xdd,
+  0xc5, 0xa8, 0xce, 0x20, 0x0b, 0x65, 0x57, 0x3e, 0x99, 0x05, 0x24, 0xc6, 0xf1, 0xfc, 0x8b, 0x59,
+  0x19, 0x93, 0xa9, 0x02, 0xb1, 0x8a, 0xcc, 0x35, 0x30, 0x1f, 0x5d, 0xa4, 0x30, 0x6f, 0x81, 0x34,
+  0x26, 0xd1, 0x40, 0x3c, 0x10, 0x9a, 0x03, 0x6f, 0x8e, 0x91, 0x37, 0x15, 0xe9, 0x4b, 0xa6, 0x02,
+  0xc9, 0x53, 0x64, 0x15, 0xc4, 0x31, 0xe2, 0xd0, 0x00, 0x2c, 0x35, 0x40, 0x75, 0xc1, 0x80, 0xc3,
+  0x66, 0x9e, 0x1a, 0x8e, 0xe5, 0xfc, 0x02, 0x49, 0x7c, 0x68, 0x78, 0x65, 0xd9, 0xb2, 0xeb, 0x7f,
+  0x6d, 0x16, 0xd9, 0x0d, 0x98, 0xa5, 0xcb, 0x62, 0xc5, 0xd4, 0xc1, 0xcc, 0x29, 0x1b, 0x87, 0xe9,
+  0x8f, 0x10, 0x9f, 0xe1, 0xd8, 0xf7, 0x5b, 0xf0, 0xaa, 0x03, 0xc7, 0xc2, 0x15, 0x2b, 0xe7, 0xb8,
+  0xf0, 0x08, 0x5a, 0x3b, 0x04, 0x8e, 0x8e, 0x3a, 0xc6, 0x3b, 0xb3, 0x92, 0x83, 0x54, 0x87, 0x99,
+  0x33, 0x7f, 0x3c, 0x45, 0xd5, 0xb9, 0x81, 0xa6, 0xec, 0xf7, 0xf2, 0x29, 0xcc, 0x87, 0xb2, 0x69,
+  0x97, 0x19, 0x94, 0xfa, 0x5c, 0x27, 0x0e, 0x11, 0x49, 0x80, 0x81, 0xce, 0x97, 0xb0, 0x86, 0xcb,
+  0xca, 0xee, 0xf6, 0x1c, 0x4c, 0x2c, 0xc4, 0xbf, 0x59, 0xf1, 0x16, 0x7f, 0x8f, 0x21, 0x91, 0x16,
+  0x76, 0x44, 0xda, 0x34, 0x23, 0xd2, 0xaa, 0x85, 0x9d, 0x78, 0xf1, 0x24, 0x82, 0x8e, 0xe3, 0x2e,
+  0x22, 0x11, 0x7c, 0x9f, 0xa0, 0x03, 0x22, 0x3d, 0x68, 0x10, 0x1b, 0xf3, 0xd6, 0xc6, 0xf3, 0x0d,
+  0x4f, 0xa0, 0x7d, 0x78, 0x80, 0x40, 0xd1, 0x8a, 0xb7, 0x96, 0x6c, 0x39, 0x73, 0xfa, 0xce, 0xf3,
+  0xf9, 0x39, 0x0e, 0x15, 0xd8, 0xcb, 0x07, 0xe8, 0x6a, 0xe4, 0x03, 0x4b, 0xb2, 0x0a, 0x74, 0x3d,
+  0xba, 0x96, 0x89, 0x44, 0xc9, 0x00, 0x34, 0x23, 0x7e, 0xc3, 0xbc, 0x6f, 0x0a, 0x53, 0x60, 0xd7,
+  0x4b, 0x81, 0x79, 0x27, 0x62, 0xda, 0xd0, 0xb2, 0xdc, 0xd4, 0x19, 0xbc, 0xde, 0x30, 0x32, 0x23,
+  0x4b, 0x1a, 0xc1, 0x5c, 0x37, 0x02, 0x65, 0x4b, 0xdb, 0xfb, 0xf0, 0x12, 0xea, 0x04, 0x37, 0x0f,
+  0x8f, 0x61, 0xf4, 0x90, 0x7e, 0x9f, 0x5c, 0xc2, 0xd0, 0xf2, 0x12, 0xb1, 0xe9, 0xf6, 0x88, 0xa2,
+  0xb4, 0x22, 0x4a, 0xd6, 0x74, 0x01, 0x7d, 0xb4, 0xfb, 0x8d, 0xc6, 0x64, 0x21, 0xc5, 0x46, 0x31,
+  0xd9, 0x33, 0x60, 0x5a, 0x68, 0x1a, 0x5d, 0x66, 0xd2, 0xec, 0x1c, 0x80, 0x06, 0x50, 0x1b, 0x3e,
+  0xa0, 0x01, 0xd8, 0x90, 0xd8, 0x06, 0xab, 0x20, 0xc6, 0xf0, 0x31, 0x8a, 0xb8, 0x62, 0xd0, 0xe1,
+  0x43, 0xd5, 0x59, 0x66, 0x89, 0xad, 0xa5, 0x36, 0x12, 0x90, 0xfb, 0xce, 0x92, 0xe9, 0x60, 0xdd,
+  0x75, 0xfa, 0x34, 0xe5, 0x7d, 0xdc, 0xab, 0x5b, 0x56, 0xdf, 0x1f, 0xd4, 0xbc, 0xcd, 0x2c, 0xb7,
+  0x8e, 0xc8, 0x3d, 0x1c, 0xd4, 0xd7, 0x02, 0xe6, 0xa3, 0xf3, 0xe9, 0xe3, 0x97, 0x6b, 0xe7, 0xa1,
+  0x07, 0x67, 0x41, 0x68, 0xf1, 0x5d, 0xa0, 0x76, 0x2a, 0x12, 0x05, 0x5b, 0x9b, 0x93, 0xe2, 0x33,
+  0x44, 0x14, 0xf1, 0x0b, 0x91, 0x90, 0xc2, 0x11, 0x1f, 0x1e, 0xdf, 0x77, 0xf8, 0x92, 0x98, 0x6f,
+  0xc5, 0x49, 0x14, 0x5d, 0x68, 0x0f, 0xb1, 0x96, 0x19, 0x04, 0x31, 0x14, 0x41, 0x16, 0x43, 0x3b,
+  0xf5, 0x56, 0x4c, 0x5f, 0x45, 0x0c, 0x3f, 0x9e, 0xdf, 0xbd, 0x0f, 0xbb, 0x5b, 0x9a, 0xf7, 0x3c,
+  0x43, 0x33, 0xaf, 0x38, 0x91, 0xce, 0x88, 0x83, 0x75, 0xe9, 0xec, 0xd5, 0xb5, 0xd4, 0x6d, 0x51,
+  0xad, 0x52, 0x14, 0x20, 0xb2, 0x14, 0x9c, 0x65, 0xb6, 0x05, 0x76, 0x1d, 0x74, 0xf4, 0x9f, 0x32,
+  0x3e, 0x10, 0x12, 0xa7, 0x39, 0x18, 0x03, 0xe8, 0xe7, 0x0a, 0x4f, 0x14, 0xc5, 0x70, 0x2c, 0x3a,
+  0x98, 0xe7, 0x79, 0x4e, 0x6f, 0xd2, 0x79, 0xe8, 0x3c, 0x98, 0xd7, 0x4a, 0x56, 0x6a, 0x35, 0xf3,
+  0x8b, 0x09, 0x81, 0x1a, 0xfc, 0x9f, 0xf2, 0xb1, 0x97, 0xde, 0x8f, 0x52, 0xfb, 0x49, 0x59, 0x69,
+  0x84, 0xf6, 0x29, 0xd9, 0x39, 0x94, 0xd8, 0x5a, 0xf3, 0x7f, 0x82, 0x7e, 0xb5, 0xdb, 0x3f, 0xae,
+  0x5e, 0x27, 0x05, 0xba, 0x9b, 0xb2, 0x10, 0xd9, 0x50, 0x06, 0x92, 0x14, 0x8b, 0x98, 0xec, 0x7a,
+  0xc2, 0x6b, 0xca, 0x76, 0x36, 0x1e, 0x91, 0x70, 0x3b, 0x1d, 0x91, 0x02, 0x50, 0xb9, 0x70, 0x93,
+  0xde, 0x8e, 0x59, 0xb0, 0xbd, 0x2f, 0xe2, 0xc5, 0x30, 0xee, 0x4d, 0x6a, 0x9a, 0x95, 0x91, 0x7b,
+  0x18, 0xa0, 0x3a, 0x9f, 0x1b, 0x38, 0xe6, 0x30, 0x70, 0x18, 0xc1, 0x9e, 0x19, 0x40, 0x77, 0xeb,
+  0x91, 0x87, 0xa7, 0xe3, 0x0b, 0x7b, 0x93, 0x07, 0x00, 0xfb, 0xa0, 0x10, 0xa8, 0x58, 0x6c, 0xc8,
+  0x55, 0xa2, 0x31, 0x31, 0x0d, 0xc3, 0x2a, 0x90, 0xd9, 0x0c, 0x72, 0x50, 0x72, 0xd2, 0xc1, 0x48,
+  0x55, 0x4c, 0x7b, 0x66, 0x70, 0xfc, 0x49, 0x63, 0xe4, 0x69, 0xed, 0x64, 0x43, 0x6a, 0xb7, 0x5e,
+  0xc7, 0x54, 0xe1, 0x36, 0x21, 0x50, 0xa6, 0x70, 0xaa, 0xbf, 0x28, 0x60, 0x4d, 0x0d, 0xa2, 0xd1,
+  0x67, 0x0d, 0xf6, 0xf7, 0x40, 0x52, 0x67, 0x32, 0x29, 0x82, 0x23, 0x59, 0x0c, 0x93, 0x06, 0x6b,
+  0x7d, 0x06, 0x33, 0x47, 0xaf, 0xbd, 0x98, 0xde, 0x76, 0xfd, 0xa3, 0x96, 0x96, 0xef, 0x56, 0x7a,
+  0x7d, 0x19, 0xdb, 0xa2, 0x5f, 0xe7, 0xca, 0x70, 0x25, 0x15, 0xb2, 0xbb, 0xc5, 0xec, 0xe3, 0x0f,
+  0x0e, 0xbe, 0xbf, 0x4d, 0x85, 0x6d, 0xe7, 0x75, 0xf1, 0x8a, 0xfc, 0x8b, 0x5c, 0x1e, 0x14, 0x07,
+  0x56, 0xef, 0x57, 0x8b, 0xa4, 0x16, 0xfb, 0xce, 0x17, 0x2d, 0x01, 0xae, 0x9b, 0x7b, 0xd7, 0xf3,
+  0xe0, 0x0a, 0x64, 0xce, 0x09, 0xdd, 0x21, 0xf0, 0xdb, 0x87, 0x98, 0xbf, 0x22, 0xce, 0xd8, 0x81,
+  0xd7, 0x5c, 0x30, 0xf7, 0x6b, 0x57, 0xb0, 0x70, 0xbc, 0x28, 0x29, 0xf0, 0xbc, 0xb6, 0xbd, 0xda,
+  0x30, 0xeb, 0x91, 0xdf, 0xd1, 0xed, 0x5f, 0xa8, 0x4c, 0x73, 0x86, 0x2a, 0x4a, 0xd3, 0xde, 0xb3,
+  0x67, 0x5b, 0x1b, 0xe0, 0xdc, 0x0b, 0x67, 0xb2, 0x9b, 0xdd, 0xcf, 0xf9, 0xe5, 0xc2, 0x34, 0x3e,
+  0x2c, 0x37, 0xb8, 0x12, 0x60, 0x9e, 0x1f, 0x35, 0x57, 0xbb, 0x34, 0xf4, 0x9a, 0xfc, 0xc4, 0xf9,
+  0x95, 0x4b, 0x78, 0x5a, 0xbc, 0xe3, 0xb7, 0x2c, 0xec, 0x0e, 0x4d, 0x68, 0xc8, 0xd7, 0x7d, 0xed,
+  0xa5, 0x76, 0x35, 0x68, 0x45, 0xcd, 0x25, 0x9a, 0xa8, 0x67, 0xfb, 0x50, 0x9b, 0xa7, 0xff, 0x56,
+  0xe0, 0xad, 0x50, 0x13, 0xfb, 0xe7, 0x0f, 0x67, 0xb2, 0x1d, 0xcb, 0x6d, 0xf3, 0xe0, 0xe5, 0x4b,
+  0xb2, 0x5b, 0x0c, 0xf7, 0x8d, 0x36, 0x98, 0x4f, 0x29, 0xb8, 0xca, 0x40, 0xfe, 0xf3, 0x8b, 0x12,
+  0x8c, 0x26, 0x30, 0xb1, 0x77, 0x63, 0xa4, 0x7b, 0x0d, 0x57, 0x58, 0x66, 0x7e, 0xc8, 0x81, 0x31,
+  0xd9, 0x33, 0x1d, 0x93, 0x30, 0x98, 0x32, 0xa4, 0xf4, 0xa9, 0xc5, 0xf6, 0xee, 0x64, 0x3a, 0x70,
+  0x5c, 0x38, 0x34, 0x19, 0x0e, 0x4e, 0xa5, 0x03, 0xa3, 0xa1, 0xfd, 0xc0, 0xb0, 0x6d, 0x56, 0x10,
+  0x14, 0x7b, 0x43, 0xce, 0xaf, 0xc7, 0xcf, 0x48, 0xd9, 0x71, 0xf0, 0xc8, 0x56, 0xa0, 0x97, 0xc7,
+  0x04, 0xdc, 0xfc, 0x56, 0xfd, 0x73, 0x51, 0x38, 0x1f, 0x94, 0x83, 0xe2, 0x25, 0x81, 0xdb, 0xce,
+  0x97, 0x95, 0x83, 0xe5, 0x2b, 0x2b, 0xe9, 0xb5, 0x01, 0xa1, 0x95, 0x9d, 0xde, 0x87, 0x8b, 0x50,
+  0xb7, 0x09, 0xa4, 0xf2, 0xea, 0x06, 0xf6, 0xae, 0xba, 0xf5, 0x02, 0xc2, 0xf6, 0xce, 0xf4, 0x7b,
+  0xfc, 0x9d, 0x03, 0xee, 0x9f, 0xdd, 0x86, 0xfe, 0x11, 0x19, 0x8e, 0xb0, 0xf5, 0x54, 0x8e, 0xd2,
+  0xfd, 0xfc, 0x97, 0x87, 0xbe, 0xfd, 0xd5, 0xf8, 0x3f, 0xe8, 0x94, 0x41, 0x6a, 0x4d, 0x16, 0x00,
+  0x00,
+};
+static const WebAsset WEB_INJECTION_200MA = {WEB_INJECTION_200MA_GZ, sizeof(WEB_INJECTION_200MA_GZ), "text/html", "\"570aaae90a9ab09d\""};
+
+// data_submission.html: 5216 -> 3621 (minify) -> 1453 byte (gzip)
+static const uint8_t WEB_DATA_SUBMISSION_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9d, 0x57, 0x5b, 0x6f, 0xdb, 0x36,
+  0x14, 0x7e, 0xd7, 0xaf, 0x60, 0x5b, 0x0c, 0x94, 0x31, 0x5f, 0x93, 0x38, 0x2e, 0x7c, 0x03, 0xd6,
+  0x26, 0x01, 0xd2, 0xa1, 0x4d, 0x10, 0xa7, 0x0f, 0xc3, 0x30, 0x0c, 0xb4, 0x48, 0xd9, 0x6c, 0x64,
+  0x51, 0x15, 0x29, 0x3b, 0x5e, 0x90, 0xff, 0xbe, 0x73, 0x48, 0x4a, 0xbe, 0x66, 0xcd, 0x8a, 0x20,
+  0x90, 0x44, 0x9e, 0xf3, 0x9d, 0xeb, 0x77, 0x48, 0x0f, 0xdf, 0x5c, 0xdc, 0x7c, 0xbc, 0xff, 0xe3,
+  0xf6, 0x92, 0xcc, 0xcd, 0x22, 0x19, 0x07, 0xc3, 0xf2, 0x21, 0x18, 0x87, 0x87, 0x91, 0x26, 0x11,
+  0xe3, 0x8f, 0x37, 0x77, 0x97, 0xe4, 0x5e, 0x68, 0x43, 0x1a, 0xe4, 0x82, 0x19, 0x46, 0x26, 0xc5,
+  0x74, 0x21, 0xb5, 0x96, 0x2a, 0x1d, 0xb6, 0x9c, 0x48, 0x30, 0x5c, 0x08, 0xd8, 0x88, 0xe6, 0x2c,
+  0xd7, 0xc2, 0x8c, 0xe8, 0xd7, 0xfb, 0xab, 0xc6, 0x7b, 0x5a, 0x2e, 0xa7, 0x6c, 0x21, 0x46, 0x74,
+  0x29, 0xc5, 0x2a, 0x53, 0xb9, 0xa1, 0x24, 0x52, 0xa9, 0x11, 0x29, 0x88, 0xad, 0x24, 0x37, 0xf3,
+  0x11, 0x17, 0x4b, 0x19, 0x89, 0x86, 0xfd, 0xa8, 0x13, 0x99, 0x4a, 0x23, 0x59, 0xd2, 0xd0, 0x11,
+  0x4b, 0xc4, 0xa8, 0xd3, 0x6c, 0x23, 0x8c, 0x36, 0x6b, 0xb4, 0x32, 0x55, 0x7c, 0x4d, 0x9e, 0x48,
+  0x0c, 0xfa, 0x8d, 0x98, 0x2d, 0x64, 0xb2, 0xee, 0x93, 0xdf, 0x72, 0x90, 0x1e, 0x90, 0x05, 0xcb,
+  0x67, 0x32, 0xed, 0x93, 0x93, 0x76, 0xf6, 0x38, 0x20, 0x53, 0x16, 0x3d, 0xcc, 0x72, 0x55, 0xa4,
+  0xbc, 0x4f, 0xde, 0xc5, 0x6d, 0xfc, 0x1b, 0x90, 0xe7, 0xa0, 0x89, 0x96, 0x99, 0x4c, 0x45, 0x0e,
+  0x28, 0x0b, 0xf6, 0xe8, 0x6c, 0xf6, 0xc9, 0x79, 0xdb, 0x6a, 0x95, 0x18, 0x6d, 0xc2, 0x0a, 0xa3,
+  0x76, 0x51, 0x56, 0x73, 0x69, 0xc4, 0x80, 0x64, 0x8c, 0x73, 0x99, 0xce, 0x2a, 0x3b, 0x2a, 0xe7,
+  0x22, 0x6f, 0xe4, 0x8c, 0xcb, 0x42, 0xf7, 0x49, 0xc7, 0x2e, 0x82, 0x9d, 0x58, 0xe5, 0x8b, 0x06,
+  0xaa, 0x66, 0xd6, 0xd0, 0xc6, 0x35, 0x62, 0xfd, 0x48, 0xd8, 0x54, 0x24, 0xb0, 0xc3, 0xa5, 0xce,
+  0x12, 0x06, 0x41, 0x4c, 0x13, 0x15, 0x3d, 0x94, 0x0e, 0x34, 0xa6, 0xca, 0x18, 0xb5, 0xe8, 0x93,
+  0x2e, 0xa2, 0xd9, 0x60, 0x57, 0x42, 0xce, 0xe6, 0x06, 0xe4, 0x54, 0xc2, 0x11, 0x40, 0xa6, 0x59,
+  0x61, 0xfe, 0x34, 0xeb, 0x0c, 0xf2, 0x6a, 0xc4, 0xa3, 0xa1, 0x7f, 0x01, 0x9a, 0x0f, 0xa6, 0xd3,
+  0x6e, 0xff, 0xb2, 0xe5, 0x68, 0x67, 0xcb, 0x51, 0xf8, 0x02, 0x17, 0xb4, 0x4a, 0x24, 0x27, 0xef,
+  0x38, 0xe7, 0x07, 0x01, 0x74, 0x9d, 0xec, 0x63, 0x43, 0xcb, 0x7f, 0xac, 0xb6, 0xdf, 0x87, 0x25,
+  0x1b, 0xd7, 0xd4, 0xa4, 0x60, 0x68, 0x83, 0x0d, 0xf2, 0xe4, 0x74, 0x27, 0x77, 0x68, 0xae, 0x84,
+  0x71, 0x26, 0x53, 0x95, 0x8a, 0xe3, 0x86, 0xa2, 0x22, 0xd7, 0x0a, 0x24, 0x32, 0x25, 0xa1, 0x21,
+  0x72, 0x1f, 0x2b, 0x98, 0x16, 0x80, 0x73, 0x9e, 0x55, 0x26, 0x1b, 0x1a, 0x1b, 0xce, 0x80, 0xe5,
+  0x9d, 0xba, 0x9e, 0xbc, 0x67, 0xbd, 0xb3, 0x2e, 0xc0, 0xa8, 0x04, 0x51, 0x7c, 0x85, 0x76, 0x54,
+  0xfa, 0x73, 0xb5, 0xb4, 0xc5, 0xde, 0x51, 0xec, 0x88, 0x9e, 0x38, 0x3d, 0xab, 0x44, 0x71, 0x6f,
+  0x5f, 0xe4, 0x3c, 0xea, 0x75, 0x7b, 0xfc, 0x08, 0xb6, 0x36, 0xcc, 0x14, 0x7a, 0x3f, 0x09, 0xc7,
+  0xe3, 0xdb, 0x2f, 0x7c, 0x55, 0x6e, 0x97, 0x12, 0x44, 0x2b, 0xa2, 0x48, 0x68, 0xbd, 0x6f, 0x9d,
+  0x9f, 0x09, 0xce, 0x59, 0x65, 0xfd, 0x5d, 0xa7, 0xdb, 0xed, 0x9d, 0x9c, 0x1d, 0xad, 0x62, 0x74,
+  0x2a, 0xce, 0xa3, 0xa9, 0x05, 0x13, 0x79, 0xae, 0x0e, 0x62, 0x8d, 0xdf, 0xf3, 0xde, 0x36, 0x54,
+  0xef, 0xa4, 0x13, 0xbd, 0x00, 0x15, 0x77, 0xa3, 0x12, 0x4a, 0xa6, 0xb1, 0x3a, 0x70, 0xaa, 0x23,
+  0xa2, 0xb8, 0xb3, 0x41, 0x6a, 0x47, 0xdd, 0xb3, 0xf3, 0xf6, 0x51, 0xa4, 0xa9, 0x10, 0x5d, 0x61,
+  0x91, 0x86, 0x2d, 0x4f, 0xdd, 0x61, 0xcb, 0xcf, 0x14, 0xe4, 0x30, 0x3c, 0xb8, 0x5c, 0x92, 0x28,
+  0x61, 0x5a, 0x8f, 0x68, 0x45, 0x4a, 0x64, 0xfa, 0xbc, 0x33, 0x3e, 0x98, 0x31, 0xb0, 0x16, 0x0c,
+  0xb3, 0xf1, 0xc4, 0x75, 0x81, 0xc1, 0x49, 0x94, 0x0b, 0x5d, 0x24, 0x46, 0x13, 0xa3, 0x00, 0x45,
+  0x15, 0x9c, 0x68, 0x91, 0x43, 0xa5, 0x87, 0xad, 0x0c, 0x44, 0x91, 0x7d, 0x44, 0xf2, 0x11, 0xe5,
+  0x80, 0x74, 0x05, 0x1f, 0x94, 0xa8, 0xd4, 0x35, 0xc4, 0x88, 0xba, 0x27, 0xda, 0x08, 0xc5, 0x12,
+  0xa6, 0x50, 0x8d, 0xee, 0x7a, 0xb3, 0xa1, 0x2e, 0x6e, 0x38, 0xa6, 0xc2, 0xda, 0x88, 0x16, 0x99,
+  0xa1, 0xe3, 0xaf, 0xb7, 0xf7, 0xfd, 0x61, 0xcb, 0xae, 0xc2, 0xae, 0xa5, 0x21, 0xd9, 0xa2, 0xa1,
+  0xb5, 0x8a, 0x82, 0x7e, 0xe6, 0xd9, 0xd7, 0x5c, 0x7c, 0x2f, 0x64, 0x2e, 0x30, 0xf8, 0x16, 0x18,
+  0x7a, 0xa5, 0xb9, 0x54, 0xc2, 0xca, 0x97, 0xeb, 0xdb, 0x1f, 0x9a, 0x43, 0x41, 0x6f, 0xce, 0xbe,
+  0xfe, 0x9c, 0xb9, 0x07, 0xc5, 0xc5, 0xa4, 0x90, 0x10, 0xe2, 0xef, 0x37, 0x17, 0x97, 0x7f, 0x4f,
+  0xbe, 0x5e, 0xff, 0x38, 0xd0, 0x4a, 0xc7, 0x9b, 0xdf, 0x7c, 0xff, 0x9c, 0x0f, 0x73, 0xa6, 0x65,
+  0x72, 0x47, 0xc7, 0x77, 0x24, 0xb4, 0xaf, 0xa4, 0xf8, 0x26, 0x6b, 0x3f, 0xf4, 0xc2, 0x6b, 0x79,
+  0x1f, 0xca, 0xaf, 0x1c, 0xba, 0x4d, 0xa5, 0xc9, 0x7a, 0xd7, 0x03, 0xdb, 0x8c, 0x4e, 0xb9, 0xc1,
+  0x12, 0x39, 0x03, 0x72, 0x46, 0xc2, 0xcd, 0x9e, 0x92, 0xac, 0xa7, 0x8e, 0xac, 0xe8, 0xda, 0xb4,
+  0x80, 0x39, 0x9c, 0x7a, 0x83, 0xae, 0x6f, 0x68, 0x19, 0x04, 0x4e, 0xc2, 0xcd, 0x9c, 0xa1, 0x65,
+  0x73, 0x62, 0x5f, 0x0d, 0x5b, 0x4e, 0x71, 0x1f, 0xc1, 0x7d, 0x1c, 0x20, 0x20, 0xc9, 0xb0, 0x41,
+  0xa3, 0x44, 0x46, 0x0f, 0xa3, 0xb7, 0x2b, 0x99, 0x72, 0xb5, 0x6a, 0xc2, 0x81, 0xc0, 0x0c, 0x74,
+  0x7f, 0x73, 0x9e, 0x8b, 0x78, 0x44, 0x5b, 0xf4, 0xed, 0xf8, 0x03, 0xce, 0x29, 0x68, 0xf8, 0xcf,
+  0x40, 0x16, 0xf2, 0x59, 0xa4, 0xc5, 0x96, 0x21, 0x1f, 0x63, 0x0b, 0x73, 0xeb, 0x63, 0xc5, 0xdc,
+  0xe8, 0x8a, 0x45, 0x13, 0x3b, 0xb7, 0x2a, 0xe3, 0x6e, 0x8c, 0xd1, 0x71, 0xa5, 0xe8, 0x1e, 0x3a,
+  0xca, 0x65, 0x66, 0x88, 0xce, 0x23, 0x30, 0x99, 0xc8, 0xa5, 0x68, 0x7e, 0xb3, 0x42, 0x6e, 0xbd,
+  0x12, 0x18, 0x07, 0x71, 0x91, 0x46, 0xe8, 0x1e, 0x39, 0xa0, 0x13, 0x79, 0x0a, 0xec, 0x4b, 0x33,
+  0xcb, 0xed, 0xf3, 0x42, 0xc4, 0x0c, 0xa8, 0x1a, 0xd6, 0x06, 0x01, 0x10, 0x1d, 0xa8, 0x8b, 0x2e,
+  0x5a, 0x8a, 0x8f, 0x48, 0x2a, 0x56, 0xe4, 0xca, 0x7f, 0x86, 0x5c, 0x45, 0xc5, 0x02, 0x15, 0x67,
+  0xc2, 0x5c, 0x26, 0x02, 0x5f, 0x3f, 0xac, 0xaf, 0x79, 0xb8, 0x61, 0x71, 0xad, 0xc2, 0xe0, 0x4e,
+  0xff, 0x29, 0x40, 0x3e, 0x56, 0x88, 0xa8, 0x19, 0x5a, 0xce, 0xd5, 0xea, 0x01, 0x52, 0x67, 0x6f,
+  0x07, 0xe9, 0x01, 0x3b, 0x9b, 0x06, 0xdf, 0xdb, 0xaf, 0xfa, 0x17, 0x84, 0xee, 0xe0, 0x1a, 0x50,
+  0x0f, 0x96, 0x2a, 0x31, 0x6c, 0x26, 0xec, 0x3b, 0x9c, 0x56, 0x39, 0xf8, 0x64, 0xdf, 0x61, 0xfc,
+  0x48, 0x48, 0x61, 0x1a, 0xb9, 0x2d, 0x23, 0x17, 0x30, 0x94, 0xd8, 0x22, 0xeb, 0xdb, 0x90, 0x00,
+  0x51, 0x84, 0xb5, 0xa6, 0x51, 0xd7, 0x93, 0x9b, 0x89, 0xc9, 0xe1, 0x94, 0x08, 0x6b, 0xc1, 0xf3,
+  0x20, 0x88, 0x85, 0x89, 0xe6, 0x21, 0x6d, 0xf9, 0xe4, 0xd7, 0x82, 0xa6, 0x99, 0x8b, 0x34, 0x04,
+  0xb0, 0x0c, 0xa2, 0x12, 0x64, 0x34, 0x26, 0xe5, 0x3b, 0xe4, 0x5d, 0xa5, 0x61, 0xad, 0x14, 0x71,
+  0x1a, 0x2e, 0x6b, 0x63, 0x08, 0x1b, 0xe3, 0x6f, 0x7a, 0xe7, 0x20, 0x0f, 0x9b, 0xed, 0x72, 0x71,
+  0xe0, 0x44, 0xbc, 0xcf, 0xbb, 0x22, 0x7e, 0xd1, 0x8b, 0x6c, 0x42, 0xd9, 0x95, 0xda, 0xac, 0x7b,
+  0xc1, 0xbb, 0x97, 0xf7, 0x5d, 0x51, 0xf2, 0x2b, 0x29, 0x12, 0x0e, 0x52, 0x2f, 0x56, 0xd2, 0x93,
+  0x13, 0xca, 0x28, 0x63, 0x12, 0x3a, 0x79, 0x6c, 0x18, 0xf7, 0xd6, 0x5c, 0xb2, 0xa4, 0x78, 0xd1,
+  0x0b, 0x48, 0xe7, 0x95, 0x7c, 0x14, 0x3c, 0x3c, 0x01, 0xf5, 0xe7, 0x2a, 0x97, 0x2c, 0x93, 0x2d,
+  0xd7, 0x83, 0x0d, 0xf4, 0x92, 0xd6, 0x01, 0x0e, 0x2e, 0x9d, 0x73, 0x05, 0x47, 0x16, 0xbd, 0xbd,
+  0x99, 0xdc, 0xd3, 0x7a, 0x80, 0x27, 0x8f, 0xc8, 0xe1, 0x54, 0x7e, 0xa2, 0x1f, 0xdd, 0xd5, 0xb3,
+  0x71, 0x0f, 0x8c, 0xa4, 0x20, 0xc1, 0xb2, 0x0c, 0x68, 0x67, 0x99, 0xd6, 0xc2, 0x94, 0xd3, 0xe7,
+  0xba, 0xbd, 0x65, 0xf6, 0xc9, 0xa7, 0xc9, 0xcd, 0x17, 0x38, 0xed, 0xb1, 0x7a, 0x32, 0x5e, 0x87,
+  0x08, 0x0e, 0x45, 0xfc, 0x1f, 0x35, 0x73, 0x47, 0x14, 0x0a, 0xb0, 0x15, 0x93, 0xe6, 0x93, 0x9a,
+  0x1e, 0x75, 0xd7, 0x89, 0x1d, 0xd1, 0x7a, 0x72, 0x49, 0xb2, 0xdf, 0xe5, 0x45, 0x01, 0x93, 0xa5,
+  0xe7, 0x6a, 0xe5, 0xd8, 0x1c, 0x52, 0xdb, 0x11, 0x0e, 0xcf, 0x08, 0x38, 0x04, 0x9d, 0x54, 0x5c,
+  0x24, 0xc9, 0xfa, 0x0d, 0xb9, 0x13, 0xb1, 0x80, 0x42, 0x43, 0x61, 0xaf, 0x2f, 0x20, 0x54, 0xf2,
+  0xab, 0xb7, 0x05, 0x49, 0xf5, 0x1b, 0xd7, 0xbc, 0x4e, 0xa8, 0x57, 0xc2, 0xaa, 0xbc, 0x82, 0x82,
+  0x58, 0x11, 0x61, 0xd9, 0xfc, 0x4c, 0x44, 0x02, 0x09, 0xd8, 0x75, 0xe8, 0x8a, 0xc9, 0x04, 0x1c,
+  0x81, 0x29, 0xe5, 0xef, 0x6c, 0xa8, 0xb9, 0x63, 0x1c, 0x98, 0xa2, 0xa1, 0x41, 0xc1, 0xb0, 0xbd,
+  0xaf, 0x50, 0x5b, 0x4d, 0xcc, 0x2b, 0x54, 0x01, 0x2a, 0xea, 0x2e, 0x31, 0x36, 0xfc, 0x6d, 0xdc,
+  0x4b, 0xbb, 0xec, 0x23, 0x85, 0x92, 0x6c, 0xe1, 0x5a, 0x8d, 0xa3, 0xb0, 0xf6, 0xff, 0x55, 0xc0,
+  0x10, 0xaf, 0x45, 0x2d, 0xf9, 0x82, 0xa7, 0x07, 0x7c, 0xeb, 0xd7, 0x58, 0xd8, 0x9a, 0x85, 0x1b,
+  0xdc, 0x4a, 0x18, 0x47, 0x3f, 0x56, 0xcd, 0x51, 0xc4, 0xdf, 0x1e, 0xff, 0x83, 0x22, 0x07, 0x13,
+  0x1b, 0x4c, 0x38, 0xad, 0x26, 0x9e, 0x5a, 0xbe, 0x7f, 0x01, 0xc1, 0x5b, 0xa8, 0x76, 0xed, 0x60,
+  0xff, 0x02, 0x67, 0x20, 0xec, 0xf9, 0xf1, 0x6e, 0x9d, 0x47, 0x07, 0x2a, 0x21, 0x7b, 0xfe, 0x35,
+  0xfd, 0x3d, 0x14, 0x05, 0xed, 0x0f, 0x0f, 0x8a, 0x51, 0x6c, 0x0d, 0xf9, 0x96, 0xbf, 0xa3, 0xb5,
+  0xdc, 0xaf, 0xc1, 0x7f, 0x01, 0xa8, 0xe8, 0xeb, 0x09, 0x25, 0x0e, 0x00, 0x00,
+};
+static const WebAsset WEB_DATA_SUBMISSION = {WEB_DATA_SUBMISSION_GZ, sizeof(WEB_DATA_SUBMISSION_GZ), "text/html", "\"70afab4717199bf2\""};
+
+// live.js: 965 -> 471 (minify) -> 290 byte (gzip)
+static const uint8_t WEB_LIVE_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x90, 0xc1, 0x6a, 0xc3, 0x30,
+  0x10, 0x44, 0xef, 0xfe, 0x8a, 0xed, 0xc9, 0x12, 0x18, 0x35, 0x97, 0x9e, 0x42, 0x7a, 0xeb, 0x25,
+  0x94, 0xa6, 0x90, 0xfe, 0x80, 0x22, 0xaf, 0x13, 0x05, 0x67, 0x65, 0xa4, 0x95, 0x53, 0x08, 0xf9,
+  0xf7, 0x4a, 0xb2, 0xe3, 0xd2, 0x1e, 0x0c, 0xf6, 0xec, 0x9b, 0xf5, 0xcc, 0x1a, 0x47, 0x81, 0xa1,
+  0xb7, 0x23, 0xc2, 0x06, 0x6e, 0xf7, 0x75, 0xd5, 0x45, 0x32, 0x6c, 0x1d, 0x81, 0x71, 0x44, 0x68,
+  0xf8, 0x6d, 0x44, 0xe2, 0x20, 0x3c, 0x52, 0x8b, 0x5e, 0xc2, 0xad, 0x32, 0xc5, 0x11, 0x5c, 0xf4,
+  0x26, 0x7b, 0x08, 0xaf, 0x50, 0x98, 0x7d, 0x51, 0x44, 0xfd, 0x8c, 0xc5, 0x51, 0xcb, 0x75, 0x35,
+  0x41, 0x4a, 0xb7, 0x6d, 0x21, 0xde, 0x6d, 0x60, 0x24, 0xf4, 0xa2, 0xf6, 0xa8, 0x5b, 0x4b, 0xc7,
+  0xba, 0x81, 0x02, 0xc3, 0xe6, 0x75, 0x59, 0xdc, 0x62, 0xcf, 0x3a, 0xed, 0xdd, 0xee, 0x77, 0x1f,
+  0x6a, 0xd0, 0x3e, 0xa0, 0x28, 0x8c, 0x6a, 0x35, 0xeb, 0xb4, 0x73, 0x77, 0x38, 0xa7, 0x54, 0x4a,
+  0x87, 0x60, 0x8f, 0x24, 0x72, 0xf0, 0x66, 0xf2, 0xa4, 0xd9, 0x14, 0xf2, 0x9f, 0x78, 0xcf, 0xcf,
+  0x6f, 0x2d, 0x7d, 0xd5, 0x96, 0xb7, 0xee, 0x20, 0xa2, 0xef, 0x1b, 0xf0, 0x18, 0x62, 0xcf, 0xb9,
+  0x96, 0xed, 0x40, 0x3c, 0x4d, 0x9f, 0x6a, 0x48, 0x7b, 0x52, 0x3c, 0x99, 0xc6, 0x1c, 0x3d, 0xc1,
+  0xa7, 0x77, 0x17, 0x1b, 0x50, 0xa5, 0xb1, 0xeb, 0x47, 0x14, 0xb3, 0x2b, 0xff, 0xb0, 0xcc, 0xf3,
+  0x0d, 0x66, 0x46, 0xcc, 0x4c, 0xae, 0x14, 0x90, 0xbf, 0xec, 0x05, 0x5d, 0xe4, 0x87, 0xda, 0xc0,
+  0xcb, 0x6a, 0x25, 0x65, 0xa5, 0xf8, 0x84, 0x24, 0x84, 0xcc, 0x54, 0x87, 0x6c, 0x4e, 0x39, 0xcd,
+  0xa2, 0x27, 0x78, 0x48, 0xb7, 0x28, 0x3b, 0x1e, 0xef, 0xea, 0x1c, 0x1c, 0x89, 0x05, 0x21, 0xfc,
+  0x2e, 0x57, 0xfb, 0xdb, 0x26, 0xab, 0xb2, 0xd4, 0xfd, 0x01, 0x6c, 0x68, 0xca, 0xb1, 0xd7, 0x01,
+  0x00, 0x00,
+};
+static const WebAsset WEB_LIVE_JS = {WEB_LIVE_JS_GZ, sizeof(WEB_LIVE_JS_GZ), "application/javascript", "\"4a2a8111e21dcfcd\""};
+
+#endif